@@ -23,6 +23,14 @@ SOURCES += \
     ufile.cc \
     utf8.cc \
     dsl.cc \
+    dslindex.cc \
+    rendercache.cc \
+    mediamanifest.cc \
+    glswriter.cc \
+    batch.cc \
+    shard.cc \
+    stats.cc \
+    slowest.cc \
     dictzip.c \
     langcoder.cc \
     fsencoding.cc \
@@ -37,6 +45,13 @@ SOURCES += \
 # deprecated API in order to know how to port your code away from it.
 DEFINES += QT_DEPRECATED_WARNINGS
 
+# 64-bit file offsets, so the multi-gigabyte dictionaries can be read
+DEFINES += _FILE_OFFSET_BITS=64 _LARGEFILE64_SOURCE
+
+# The text of the parsed articles is kept in UTF-8, as it is written out.
+# Uncomment to keep it in wide characters instead, e.g. to compare the two
+#DEFINES += DSL_WIDE_DOM
+
 # You can also make your code fail to compile if you use deprecated APIs.
 # In order to do so, uncomment the following line.
 # You can also select to disable deprecated APIs only up to a certain version of Qt.
@@ -51,10 +66,19 @@ HEADERS += \
     folding.hh \
     inc_case_folding.hh \
     inc_diacritic_folding.hh \
+    inc_character_classes.hh \
     gddebug.hh \
     ufile.hh \
     utf8.hh \
     dsl.hh \
+    dslindex.hh \
+    rendercache.hh \
+    mediamanifest.hh \
+    glswriter.hh \
+    batch.hh \
+    shard.hh \
+    stats.hh \
+    slowest.hh \
     dictzip.h \
     langcoder.hh \
     htmlescape.hh \
@@ -0,0 +1,236 @@
+#include "batch.hh"
+#include "fsencoding.hh"
+
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+
+#include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace Batch {
+
+namespace {
+
+bool isDictionary( QString const & name )
+{
+  if ( !name.endsWith( ".dsl", Qt::CaseInsensitive ) &&
+       !name.endsWith( ".dsl.dz", Qt::CaseInsensitive ) )
+    return false;
+
+  return !name.endsWith( "_abrv.dsl", Qt::CaseInsensitive ) &&
+         !name.endsWith( "_abrv.dsl.dz", Qt::CaseInsensitive );
+}
+
+/// Strips the .dsl or .dsl.dz extension
+QString baseName( QString const & name )
+{
+  return name.left( name.size() -
+                    ( name.endsWith( ".dz", Qt::CaseInsensitive ) ? 7 : 4 ) );
+}
+
+/// Finds the abbreviations file, which is named after the dictionary, with
+/// _abrv appended, compressed or not
+string findAbbreviations( QString const & dslName )
+{
+  QString name = baseName( dslName ) + "_abrv.dsl";
+
+  if ( QFileInfo( name ).exists() )
+    return FsEncoding::encode( name );
+
+  name += ".dz";
+
+  if ( QFileInfo( name ).exists() )
+    return FsEncoding::encode( name );
+
+  return string();
+}
+
+Job makeJob( QString const & dslName, QString const & glsName )
+{
+  Job job;
+
+  job.dslName = FsEncoding::encode( dslName );
+  job.abrvName = findAbbreviations( dslName );
+  job.glsName = FsEncoding::encode( QDir::toNativeSeparators( glsName ) );
+  job.size = QFileInfo( dslName ).size();
+
+  return job;
+}
+
+bool largerFirst( Job const & a, Job const & b )
+{
+  return a.size > b.size;
+}
+
+}
+
+bool findJobs( char const * input_, char const * outDir_, vector< Job > & jobs,
+               string & error )
+{
+  QString input = FsEncoding::decode( input_ );
+  QDir outDir( FsEncoding::decode( outDir_ ) );
+  QFileInfo inputInfo( input );
+
+  jobs.clear();
+
+  if ( inputInfo.isDir() )
+  {
+    QDir inputDir( input );
+    QDirIterator i( input, QStringList() << "*.dsl" << "*.dsl.dz", QDir::Files,
+                    QDirIterator::Subdirectories | QDirIterator::FollowSymlinks );
+
+    while( i.hasNext() )
+    {
+      QString name = i.next();
+
+      if ( isDictionary( name ) )
+        jobs.push_back( makeJob( name, outDir.filePath(
+                          baseName( inputDir.relativeFilePath( name ) ) + ".gls" ) ) );
+    }
+  }
+  else
+  {
+    QFile manifest( input );
+
+    if ( !manifest.open( QIODevice::ReadOnly ) )
+    {
+      error = "can't open " + string( input_ );
+      return false;
+    }
+
+    QDir manifestDir = inputInfo.absoluteDir();
+
+    while( !manifest.atEnd() )
+    {
+      QString name = QString::fromUtf8( manifest.readLine() ).trimmed();
+
+      if ( name.isEmpty() || name.startsWith( "#" ) )
+        continue;
+
+      if ( !isDictionary( name ) )
+      {
+        error = "not a .dsl or .dsl.dz file: " + FsEncoding::encode( name );
+        return false;
+      }
+
+      name = QDir::cleanPath( manifestDir.absoluteFilePath( name ) );
+
+      jobs.push_back( makeJob( name, outDir.filePath(
+                        baseName( QFileInfo( name ).fileName() ) + ".gls" ) ) );
+    }
+  }
+
+  std::set< string > outputs;
+
+  for( size_t x = 0; x < jobs.size(); ++x )
+    if ( !outputs.insert( jobs[ x ].glsName ).second )
+    {
+      error = "several dictionaries would be converted to " + jobs[ x ].glsName;
+      return false;
+    }
+
+  return true;
+}
+
+unsigned run( vector< Job > jobs, unsigned threads, Converter const & convert )
+{
+  std::stable_sort( jobs.begin(), jobs.end(), largerFirst );
+
+  if ( threads > jobs.size() )
+    threads = jobs.size();
+
+  if ( !threads )
+    threads = 1;
+
+  printf( "Converting %u dictionaries on %u threads\n", (unsigned) jobs.size(), threads );
+
+  std::atomic< size_t > nextJob( 0 );
+  std::mutex reportMutex;
+  unsigned done = 0;
+  vector< string > failures;
+
+  std::function< void() > worker = [ & ]()
+  {
+    for( size_t x; ( x = nextJob++ ) < jobs.size(); )
+    {
+      Job const & job = jobs[ x ];
+      string error;
+      int result;
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+      if ( QDir().mkpath( QFileInfo( FsEncoding::decode( job.glsName.c_str() ) ).absolutePath() ) )
+      {
+        try
+        {
+          result = convert( job, error );
+        }
+        catch( std::exception & e )
+        {
+          result = -1;
+          error = e.what();
+        }
+      }
+      else
+      {
+        result = -1;
+        error = "can't create the output directory";
+      }
+
+      double seconds = std::chrono::duration< double >(
+        std::chrono::steady_clock::now() - start ).count();
+
+      std::lock_guard< std::mutex > lock( reportMutex );
+
+      ++done;
+
+      if ( result == 0 )
+        printf( "[%u/%u] %s: done in %.1f s\n", done, (unsigned) jobs.size(),
+                job.dslName.c_str(), seconds );
+      else
+      {
+        if ( error.empty() )
+          error = "see the messages above";
+
+        printf( "[%u/%u] %s: FAILED, %s\n", done, (unsigned) jobs.size(),
+                job.dslName.c_str(), error.c_str() );
+
+        failures.push_back( job.dslName + ": " + error );
+      }
+
+      fflush( stdout );
+    }
+  };
+
+  vector< std::thread > workers;
+
+  for( unsigned x = 1; x < threads; ++x )
+    workers.push_back( std::thread( worker ) );
+
+  worker();
+
+  for( size_t x = 0; x < workers.size(); ++x )
+    workers[ x ].join();
+
+  printf( "\nConverted %u of %u dictionaries\n",
+          (unsigned) ( jobs.size() - failures.size() ), (unsigned) jobs.size() );
+
+  if ( !failures.empty() )
+  {
+    printf( "Failed:\n" );
+
+    for( size_t x = 0; x < failures.size(); ++x )
+      printf( "  %s\n", failures[ x ].c_str() );
+  }
+
+  return failures.size();
+}
+
+}
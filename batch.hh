@@ -0,0 +1,45 @@
+#ifndef __BATCH_HH_INCLUDED__
+#define __BATCH_HH_INCLUDED__
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <functional>
+
+/// Converting many dictionaries in one run, several at once.
+namespace Batch {
+
+using std::string;
+using std::vector;
+
+/// A dictionary to convert. The names are in the file system encoding.
+struct Job
+{
+  string dslName, abrvName, glsName;
+  uint64_t size;
+};
+
+/// Finds the dictionaries to convert. The input is either a directory, which
+/// is searched for .dsl and .dsl.dz files along with its subdirectories, or a
+/// manifest file listing such files one per line. The relative names in the
+/// manifest are taken from its directory, and the empty lines and the ones
+/// starting with # are skipped. The abbreviations files are found the same
+/// way as for a single dictionary. The outputs go to outDir, keeping the
+/// subdirectories of the input directory. Returns false and sets the error if
+/// the input can't be read, or some outputs would have the same name.
+bool findJobs( char const * input, char const * outDir, vector< Job > & jobs,
+               string & error );
+
+/// Converts the dictionary, returning 0 on success. If it fails, the error
+/// is set, unless it was already reported.
+typedef std::function< int ( Job const &, string & error ) > Converter;
+
+/// Runs the jobs on the given number of threads, the largest dictionaries
+/// first, so the long ones don't end up running alone in the end. Reports
+/// each dictionary as it's done or failed, and then the summary. Returns the
+/// number of the failed ones.
+unsigned run( vector< Job > jobs, unsigned threads, Converter const & );
+
+}
+
+#endif
@@ -0,0 +1,995 @@
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gendsl.hh"
+#include "dsl.hh"
+#include "dsl_details.hh"
+#include "dslindex.hh"
+#include "folding.hh"
+#include "fsencoding.hh"
+#include "glswriter.hh"
+#include "htmlescape.hh"
+#include "langcoder.hh"
+#include "language.hh"
+#include "ufile.hh"
+#include "utf8.hh"
+#include "wstring_qt.hh"
+
+using std::string;
+using std::vector;
+using gd::wstring;
+using Dsl::Details::ArticleDom;
+using Dsl::Details::DslScanner;
+using Dsl::Details::DomText;
+using Dsl::Details::OptionalPartsExpander;
+
+namespace {
+
+/// Opens the rendering steps up for the benchmarks
+class BenchDictionary: public DslDictionary
+{
+public:
+
+  using DslDictionary::loadArticle;
+  using DslDictionary::readData;
+  using DslDictionary::dslToHtml;
+  using DslDictionary::processNodeChildren;
+};
+
+double minSeconds = 0.5;
+
+/// Keeps the results of the benchmarked code alive, so it doesn't get
+/// optimized away
+size_t volatile sink;
+
+double secondsSince( std::chrono::steady_clock::time_point start )
+{
+  return std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+}
+
+/// Returns the bytes held by the text of the node and its children, to
+/// compare the text representations selected with DSL_WIDE_DOM
+uint64_t domTextBytes( ArticleDom::Node const & node )
+{
+  uint64_t result = node.text.capacity() * sizeof( DomText::value_type );
+
+  for( ArticleDom::Node::const_iterator i = node.begin(); i != node.end(); ++i )
+    result += domTextBytes( *i );
+
+  return result;
+}
+
+/// Runs the function repeatedly for at least minSeconds, and reports the
+/// throughput of one run processing the given number of bytes and items
+template< class Function >
+void measure( char const * name, uint64_t bytes, uint64_t items,
+              char const * itemName, Function const & function )
+{
+  function(); // Warm up
+
+  unsigned iterations = 0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  double seconds;
+
+  do
+  {
+    function();
+    ++iterations;
+  }
+  while( ( seconds = secondsSince( start ) ) < minSeconds );
+
+  seconds /= iterations;
+
+  printf( "  %-30s %9.1f MB/s %12.0f %s/s\n", name, bytes / seconds / 1e6,
+          items / seconds, itemName );
+  fflush( stdout );
+}
+
+uint64_t fileSize( string const & name )
+{
+  return QFileInfo( FsEncoding::decode( name.c_str() ) ).size();
+}
+
+/// Times the first lookups of the languages, which is what a conversion pays
+/// for them at startup, and then the repeated ones. Must be run before
+/// anything else looks the languages up.
+void runStartupBenchmarks()
+{
+  char const * const names[] = { "English", "Russian", "German", "Arabic", "Lojban",
+                                 "Traditional Chinese", "Klingon" };
+  size_t const count = sizeof( names ) / sizeof( names[ 0 ] );
+
+  vector< wstring > languages;
+  vector< quint32 > ids;
+  uint64_t nameBytes = 0;
+
+  for( size_t x = 0; x < count; ++x )
+  {
+    languages.push_back( gd::toWString( QString::fromLatin1( names[ x ] ) ) );
+    nameBytes += languages.back().size() * sizeof( gd::wchar );
+  }
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  quint32 id = LangCoder::findIdForLanguage( languages.front() );
+  sink = LangCoder::isLanguageRTL( id ) + Language::englishNameForId( id ).size() +
+         Language::localizedNameForId( id ).size() + Language::countryCodeForId( id ).size();
+
+  double firstSeconds = secondsSince( start );
+
+  printf( "Startup:\n" );
+  printf( "  %-30s %9.1f us\n", "first language lookups", firstSeconds * 1e6 );
+
+  measure( "LangCoder::findIdForLanguage", nameBytes, count, "lookups", [ & ]()
+  {
+    ids.clear();
+    for( size_t x = 0; x < count; ++x )
+      ids.push_back( LangCoder::findIdForLanguage( languages[ x ] ) );
+  } );
+
+  measure( "LangCoder::isLanguageRTL", 0, count, "lookups", [ & ]()
+  {
+    size_t n = 0;
+    for( size_t x = 0; x < count; ++x )
+      n += LangCoder::isLanguageRTL( ids[ x ] );
+    sink = n;
+  } );
+
+  measure( "Language::englishNameForId", 0, count, "lookups", [ & ]()
+  {
+    size_t n = 0;
+    for( size_t x = 0; x < count; ++x )
+      n += Language::englishNameForId( ids[ x ] ).size();
+    sink = n;
+  } );
+
+  measure( "Language::localizedNameForId", 0, count, "lookups", [ & ]()
+  {
+    size_t n = 0;
+    for( size_t x = 0; x < count; ++x )
+      n += Language::localizedNameForId( ids[ x ] ).size();
+    sink = n;
+  } );
+}
+
+void runMicroBenchmarks( string const & dslName, string const & abrvName )
+{
+  BenchDictionary dict;
+
+  if ( dict.setFiles( dslName, abrvName ) )
+    return;
+
+  // The samples: the headwords, and the bodies of the first articles
+  vector< wstring > headwords, bodies;
+  vector< string > utf8Bodies;
+  uint64_t headwordChars = 0, bodyBytes = 0;
+
+  for( int x = 0; x < dict.getCards().size(); ++x )
+  {
+    DslCard const & card = dict.getCards()[ x ];
+
+    headwords.push_back( card.headwords.at( 0 ) );
+    headwordChars += headwords.back().size();
+
+    if ( bodies.size() < 20000 )
+    {
+      wstring tildeValue, displayedHeadword, body;
+      unsigned headwordIndex;
+
+      dict.loadArticle( card, Folding::applySimpleCaseOnly( card.headwords.at( 0 ) ),
+                        tildeValue, displayedHeadword, headwordIndex, body );
+
+      bodies.push_back( gd::normalize( body ) );
+      utf8Bodies.push_back( Utf8::encode( bodies.back() ) );
+      bodyBytes += utf8Bodies.back().size();
+    }
+  }
+
+  printf( "Micro-benchmarks (%u headwords, %u article bodies, %.1f MB of UTF-8):\n",
+          (unsigned) headwords.size(), (unsigned) bodies.size(), bodyBytes / 1e6 );
+
+  uint64_t dslSize = fileSize( dslName );
+
+  measure( "DslScanner::readNextLine", dslSize, dict.getCards().size(), "cards", [ & ]()
+  {
+    DslScanner scanner( dslName );
+    wstring line;
+    uint64_t offset;
+    size_t total = 0;
+
+    while( scanner.readNextLine( line, offset ) )
+      total += line.size();
+
+    sink = total;
+  } );
+
+  measure( "ArticleDom", bodyBytes, bodies.size(), "articles", [ & ]()
+  {
+    for( size_t x = 0; x < bodies.size(); ++x )
+    {
+      ArticleDom dom( bodies[ x ] );
+      sink = dom.root.size();
+    }
+  } );
+
+  vector< std::unique_ptr< ArticleDom > > doms;
+  for( size_t x = 0; x < bodies.size(); ++x )
+    doms.push_back( std::unique_ptr< ArticleDom >( new ArticleDom( bodies[ x ] ) ) );
+
+  uint64_t textBytes = 0;
+  for( size_t x = 0; x < doms.size(); ++x )
+    textBytes += domTextBytes( doms[ x ]->root );
+
+  printf( "  %-30s %9.1f MB (%s)\n", "ArticleDom text", textBytes / 1e6,
+          sizeof( DomText::value_type ) == 1 ? "UTF-8" : "wide" );
+
+  measure( "nodeToHtml", bodyBytes, bodies.size(), "articles", [ & ]()
+  {
+    for( size_t x = 0; x < doms.size(); ++x )
+      sink = dict.processNodeChildren( doms[ x ]->root ).size();
+  } );
+
+  measure( "dslToHtml", bodyBytes, bodies.size(), "articles", [ & ]()
+  {
+    for( size_t x = 0; x < bodies.size(); ++x )
+      sink = dict.dslToHtml( bodies[ x ], headwords[ x ] ).size();
+  } );
+
+  measure( "Folding::apply", headwordChars * sizeof( gd::wchar ), headwords.size(),
+           "words", [ & ]()
+  {
+    for( size_t x = 0; x < headwords.size(); ++x )
+      sink = Folding::apply( headwords[ x ] ).size();
+  } );
+
+  measure( "Folding::applySimpleCaseOnly", headwordChars * sizeof( gd::wchar ),
+           headwords.size(), "words", [ & ]()
+  {
+    for( size_t x = 0; x < headwords.size(); ++x )
+      sink = Folding::applySimpleCaseOnly( headwords[ x ] ).size();
+  } );
+
+  measure( "Utf8::encode", bodyBytes, bodies.size(), "articles", [ & ]()
+  {
+    for( size_t x = 0; x < bodies.size(); ++x )
+      sink = Utf8::encode( bodies[ x ] ).size();
+  } );
+
+  measure( "Utf8::encodeAppend", bodyBytes, bodies.size(), "articles", [ & ]()
+  {
+    string buffer;
+
+    for( size_t x = 0; x < bodies.size(); ++x )
+    {
+      buffer.clear();
+      Utf8::encodeAppend( bodies[ x ], buffer );
+    }
+
+    sink = buffer.size();
+  } );
+
+  measure( "Utf8::decode", bodyBytes, bodies.size(), "articles", [ & ]()
+  {
+    for( size_t x = 0; x < utf8Bodies.size(); ++x )
+      sink = Utf8::decode( utf8Bodies[ x ] ).size();
+  } );
+
+  measure( "Html::escape", bodyBytes, bodies.size(), "articles", [ & ]()
+  {
+    for( size_t x = 0; x < utf8Bodies.size(); ++x )
+      sink = Html::escape( utf8Bodies[ x ] ).size();
+  } );
+}
+
+/// Converts the whole dictionary, like dsltogls does, into a temporary file
+void runEndToEnd( string const & dslName, string const & abrvName, unsigned threads )
+{
+  printf( "End-to-end conversion (%u threads):\n", threads );
+
+  uint64_t dslSize = fileSize( dslName );
+  string glsName = FsEncoding::encode( QDir::temp().filePath( "dsltogls-bench.gls" ) );
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  DslDictionary dict;
+  dict.setIndexingThreads( threads );
+
+  if ( dict.setFiles( dslName, abrvName ) )
+    return;
+
+  double indexSeconds = secondsSince( start );
+  unsigned cards = dict.getCards().size();
+
+  printf( "  %-30s %9.1f MB/s %12.0f cards/s\n", "indexing", dslSize / indexSeconds / 1e6,
+          cards / indexSeconds );
+
+  FILE * outFile = gd_fopen( glsName.c_str(), "wb" );
+
+  if ( !outFile )
+  {
+    printf( "Can't open %s\n", glsName.c_str() );
+    return;
+  }
+
+  std::chrono::steady_clock::time_point renderStart = std::chrono::steady_clock::now();
+  uint64_t outSize;
+
+  try
+  {
+    GlsWriter writer( fileno( outFile ) );
+    string article;
+
+    for( int x = 0; x < dict.getCards().size(); ++x )
+    {
+      DslCard const & card = dict.getCards()[ x ];
+
+      article.clear();
+      dict.getArticle( card, article );
+
+      writer.writeUtf8( card.headwords.at( 0 ) );
+      for( int y = 1; y < card.headwords.size(); ++y )
+      {
+        writer.write( '|' );
+        writer.writeUtf8( card.headwords.at( y ) );
+      }
+      writer.write( '\n' );
+      writer.write( article );
+      writer.write( "\n\n" );
+    }
+
+    writer.finish();
+    outSize = writer.getBytesWritten();
+  }
+  catch( std::exception & e )
+  {
+    printf( "Conversion failed: %s\n", e.what() );
+    fclose( outFile );
+    return;
+  }
+
+  fclose( outFile );
+  QFile::remove( FsEncoding::decode( glsName.c_str() ) );
+
+  double renderSeconds = secondsSince( renderStart );
+  double totalSeconds = secondsSince( start );
+
+  printf( "  %-30s %9.1f MB/s %12.0f cards/s\n", "rendering and writing",
+          dslSize / renderSeconds / 1e6, cards / renderSeconds );
+  printf( "  %-30s %9.1f MB/s %12.0f cards/s\n", "total", dslSize / totalSeconds / 1e6,
+          cards / totalSeconds );
+  printf( "  %.1f MB in, %.1f MB out, %u cards, %.2f s\n", dslSize / 1e6, outSize / 1e6,
+          cards, totalSeconds );
+}
+
+/// Checks that the offsets past 4 GB survive the indexing, the reading of the
+/// articles and the index file, which they wouldn't if they got cut to 32
+/// bits anywhere. The dictionary must be larger than 4 GB. Returns false if
+/// the check fails.
+bool runLargeFileCheck( string const & dslName, string const & abrvName, unsigned threads )
+{
+  uint64_t const FourGb = 1ULL << 32;
+
+  printf( "Large file check:\n" );
+
+  if ( fileSize( dslName ) <= FourGb )
+  {
+    printf( "  The dictionary isn't larger than 4 GB\n" );
+    return false;
+  }
+
+  // The index is made anew, so it's saved and then loaded back below
+  string indexName = DslIndex::nameFor( dslName );
+  QFile::remove( FsEncoding::decode( indexName.c_str() ) );
+
+  BenchDictionary dict;
+  dict.setIndexingThreads( threads );
+
+  if ( dict.setFiles( dslName, abrvName, indexName ) )
+    return false;
+
+  QVector< DslCard > const & cards = dict.getCards();
+  DslScanner scanner( dslName );
+  OptionalPartsExpander expander;
+  unsigned pastCount = 0, failures = 0;
+  wstring line, headword;
+  string article;
+
+  for( int x = 0; x < cards.size(); ++x )
+  {
+    DslCard const & card = cards[ x ];
+
+    // The cards ending past 4 GB, the one crossing it included. The embedded
+    // cards' headwords are made differently, so only the others are checked
+    if ( card.offset + card.size <= FourGb || !card.bodyOffset )
+      continue;
+
+    ++pastCount;
+
+    // The card starts with its first headword, which gave the card's first
+    // one. An offset cut to 32 bits would point at an article 4 GB earlier
+    char * data = dict.readData( card );
+
+    if ( !data )
+    {
+      printf( "  Can't read the card at %llu\n", (unsigned long long) card.offset );
+      ++failures;
+      continue;
+    }
+
+    Dsl::Details::decodeArticle( dict.getParams().encoding, data, card.bodyOffset, line );
+    free( data );
+
+    line.erase( std::min( line.find_first_of( GD_NATIVE_TO_WS( L"\n\r" ) ), line.size() ) );
+    Dsl::Details::processUnsortedParts( line, true );
+    expander.expand( line, false );
+
+    headword = expander.size() ? expander[ 0 ] : line;
+    Dsl::Details::unescapeDsl( headword );
+    Dsl::Details::normalizeHeadword( headword );
+
+    if ( headword != card.headwords.at( 0 ) )
+    {
+      printf( "  The card at %llu reads back as \"%s\" instead of \"%s\"\n",
+              (unsigned long long) card.offset, Utf8::encode( headword ).c_str(),
+              Utf8::encode( card.headwords.at( 0 ) ).c_str() );
+      ++failures;
+      continue;
+    }
+
+    // Seeking the scanner and rendering are slower, so only some are tried
+    if ( pastCount % 100 != 1 )
+      continue;
+
+    uint64_t offset;
+
+    if ( !scanner.seekToLine( card.offset ) || !scanner.readNextLine( line, offset ) ||
+         offset != card.offset )
+    {
+      printf( "  The scanner can't seek to the card at %llu\n",
+              (unsigned long long) card.offset );
+      ++failures;
+    }
+
+    article.clear();
+
+    if ( dict.getArticle( card, article ) || article.empty() )
+    {
+      printf( "  Can't render the card at %llu\n", (unsigned long long) card.offset );
+      ++failures;
+    }
+  }
+
+  printf( "  %u cards past 4 GB read back\n", pastCount );
+
+  if ( !pastCount )
+  {
+    printf( "  No cards past 4 GB\n" );
+    ++failures;
+  }
+
+  // The index must give back the same cards
+  DictParameters params;
+  QVector< DslCard > indexCards;
+  std::map< string, string > abrv;
+
+  if ( !DslIndex::load( indexName, dslName, abrvName, params, indexCards, abrv ) )
+  {
+    printf( "  Can't load the index back\n" );
+    ++failures;
+  }
+  else
+  {
+    unsigned mismatches = indexCards.size() == cards.size() ? 0 : 1;
+
+    for( int x = 0; !mismatches && x < cards.size(); ++x )
+    {
+      DslCard const & a = cards[ x ], & b = indexCards[ x ];
+
+      if ( a.offset != b.offset || a.size != b.size || a.bodyOffset != b.bodyOffset ||
+           a.headwordOffset != b.headwordOffset || a.headwordSize != b.headwordSize ||
+           a.headwordIndex != b.headwordIndex || a.headwords != b.headwords )
+        ++mismatches;
+    }
+
+    if ( mismatches )
+    {
+      printf( "  The index gives back different cards\n" );
+      ++failures;
+    }
+    else
+      printf( "  %u cards loaded back from the index\n", (unsigned) indexCards.size() );
+  }
+
+  QFile::remove( FsEncoding::decode( indexName.c_str() ) );
+
+  printf( "  %s\n", failures ? "FAILED" : "passed" );
+
+  return !failures;
+}
+
+/// The plain UTF-8 conversion Utf8 had before its vector versions, which
+/// they're checked against
+size_t referenceEncode( wchar const * in, size_t inSize, char * out_ )
+{
+  unsigned char * out = (unsigned char *) out_;
+
+  while( inSize-- )
+  {
+    if ( *in < 0x80 )
+      *out++ = *in++;
+    else
+    if ( *in < 0x800 )
+    {
+      *out++ = 0xC0 | ( *in >> 6 );
+      *out++ = 0x80 | ( *in++ & 0x3F );
+    }
+    else
+    if ( *in < 0x10000 )
+    {
+      *out++ = 0xE0 | ( *in >> 12 );
+      *out++ = 0x80 | ( ( *in >> 6 ) & 0x3F );
+      *out++ = 0x80 | ( *in++ & 0x3F );
+    }
+    else
+    {
+      *out++ = 0xF0 | ( *in >> 18 );
+      *out++ = 0x80 | ( ( *in >> 12 ) & 0x3F );
+      *out++ = 0x80 | ( ( *in >> 6 ) & 0x3F );
+      *out++ = 0x80 | ( *in++ & 0x3F );
+    }
+  }
+
+  return out - (unsigned char *) out_;
+}
+
+long referenceDecode( char const * in_, size_t inSize, wchar * out_ )
+{
+  unsigned char const * in = (unsigned char const *) in_;
+  wchar * out = out_;
+
+  while( inSize-- )
+  {
+    wchar result;
+
+    if ( *in & 0x80 )
+    {
+      if ( *in & 0x40 )
+      {
+        if ( *in & 0x20 )
+        {
+          if ( *in & 0x10 )
+          {
+            // Four-byte sequence
+            if ( *in & 8 )
+              // This can't be
+              return -1;
+
+            if ( inSize < 3 )
+              return -1;
+
+            inSize -= 3;
+
+            result = ( (wchar )*in++ & 7 ) << 18;
+
+            if ( ( *in & 0xC0 ) != 0x80 )
+              return -1;
+            result |= ( (wchar)*in++ & 0x3F ) << 12;
+
+            if ( ( *in & 0xC0 ) != 0x80 )
+              return -1;
+            result |= ( (wchar)*in++ & 0x3F ) << 6;
+
+            if ( ( *in & 0xC0 ) != 0x80 )
+              return -1;
+            result |= (wchar)*in++ & 0x3F;
+          }
+          else
+          {
+            // Three-byte sequence
+
+            if ( inSize < 2 )
+              return -1;
+
+            inSize -= 2;
+
+            result = ( (wchar )*in++ & 0xF ) << 12;
+
+            if ( ( *in & 0xC0 ) != 0x80 )
+              return -1;
+            result |= ( (wchar)*in++ & 0x3F ) << 6;
+
+            if ( ( *in & 0xC0 ) != 0x80 )
+              return -1;
+            result |= (wchar)*in++ & 0x3F;
+          }
+        }
+        else
+        {
+          // Two-byte sequence
+          if ( !inSize )
+            return -1;
+
+          --inSize;
+
+          result = ( (wchar )*in++ & 0x1F ) << 6;
+
+          if ( ( *in & 0xC0 ) != 0x80 )
+            return -1;
+          result |= (wchar)*in++ & 0x3F;
+        }
+      }
+      else
+      {
+        // This char is from the middle of encoding, it can't be leading
+        return -1;
+      }
+    }
+    else
+      // One-byte encoding
+      result = *in++;
+
+    *out++ = result;
+  }
+
+  return out - out_;
+}
+
+/// Makes random text of runs of ASCII and of the characters taking two,
+/// three and four bytes, the runs of any length, so the vector versions'
+/// blocks start and end everywhere in them
+void makeFuzzText( GenDsl::Random & random, vector< wchar > & text )
+{
+  size_t size = random.below( random.chance( 0.1 ) ? 2000 : 200 );
+
+  text.clear();
+
+  while( text.size() < size )
+  {
+    wchar first, count;
+
+    switch( random.below( 5 ) )
+    {
+      case 0:
+      case 1:
+        first = 0, count = 0x80;
+        break;
+      case 2:
+        first = 0x80, count = 0x800 - 0x80;
+        break;
+      case 3:
+        first = 0x800, count = 0x10000 - 0x800;
+        break;
+      default:
+        first = 0x10000, count = 0x110000 - 0x10000;
+    }
+
+    for( unsigned x = random.below( 40 ); x-- && text.size() < size; )
+      text.push_back( first + random.below( count ) );
+  }
+}
+
+/// Spoils the UTF-8 by overwriting a few of its bytes, cutting it short, or
+/// both, so it's usually invalid
+void corrupt( GenDsl::Random & random, vector< char > & utf8 )
+{
+  if ( utf8.empty() )
+    return;
+
+  if ( random.chance( 0.7 ) )
+    for( unsigned x = 1 + random.below( 3 ); x--; )
+    {
+      // The bytes most likely to break a sequence, and any at all
+      static unsigned char const bytes[] = { 0x80, 0xBF, 0xC2, 0xE0, 0xF0, 0xF8, 0xFF, 'a' };
+
+      utf8[ random.below( utf8.size() ) ] =
+        random.chance( 0.5 ) ? bytes[ random.below( sizeof( bytes ) ) ] : random.below( 256 );
+    }
+
+  if ( random.chance( 0.5 ) )
+    utf8.resize( random.below( utf8.size() ) );
+}
+
+/// Checks every version of Utf8::encode() and decode() the processor can run
+/// against the reference ones on the given number of random texts, valid and
+/// corrupted. The buffers are exactly as large as required, with a guard past
+/// them which must stay intact. Returns false if the check fails.
+bool runUtf8Fuzz( unsigned cases, uint32_t seed )
+{
+  static Utf8::Version const versions[] = { Utf8::Scalar, Utf8::Sse2, Utf8::Avx2 };
+  static char const * const versionNames[] = { "scalar", "SSE2", "AVX2" };
+  size_t const GuardSize = 64;
+  char const Guard = '\xA5';
+  wchar const WideGuard = 0x5A5A5A5A;
+
+  printf( "UTF-8 fuzz check:\n" );
+
+  GenDsl::Random random( seed );
+  vector< wchar > text, wide, expectedWide;
+  vector< char > utf8, narrow, expected;
+  unsigned failures = 0;
+
+  for( unsigned n = 0; n < cases && failures < 10; ++n )
+  {
+    makeFuzzText( random, text );
+
+    expected.resize( text.size() * 4 );
+    expected.resize( referenceEncode( text.data(), text.size(), expected.data() ) );
+
+    utf8 = expected;
+
+    if ( random.chance( 0.5 ) )
+      corrupt( random, utf8 );
+
+    expectedWide.resize( utf8.size() );
+    long expectedDecoded = referenceDecode( utf8.data(), utf8.size(), expectedWide.data() );
+
+    for( size_t v = 0; v < sizeof( versions ) / sizeof( *versions ); ++v )
+    {
+      if ( !Utf8::hasVersion( versions[ v ] ) )
+        continue;
+
+      narrow.assign( text.size() * 4 + GuardSize, Guard );
+
+      size_t encoded = Utf8::encodeWith( versions[ v ], text.data(), text.size(),
+                                         narrow.data() );
+
+      if ( encoded != expected.size() ||
+           !std::equal( expected.begin(), expected.end(), narrow.begin() ) ||
+           std::count( narrow.end() - GuardSize, narrow.end(), Guard ) != (long) GuardSize )
+      {
+        printf( "  %s encode() differs on case %u\n", versionNames[ v ], n );
+        ++failures;
+      }
+
+      wide.assign( utf8.size() + GuardSize, WideGuard );
+
+      long decoded = Utf8::decodeWith( versions[ v ], utf8.data(), utf8.size(), wide.data() );
+
+      if ( decoded != expectedDecoded ||
+           ( decoded > 0 && !std::equal( wide.begin(), wide.begin() + decoded,
+                                         expectedWide.begin() ) ) ||
+           std::count( wide.end() - GuardSize, wide.end(), WideGuard ) != (long) GuardSize )
+      {
+        printf( "  %s decode() differs on case %u\n", versionNames[ v ], n );
+        ++failures;
+      }
+    }
+  }
+
+  for( size_t v = 0; v < sizeof( versions ) / sizeof( *versions ); ++v )
+    if ( Utf8::hasVersion( versions[ v ] ) )
+      printf( "  %s checked\n", versionNames[ v ] );
+
+  printf( "  %u cases, %s\n", cases, failures ? "FAILED" : "passed" );
+
+  return !failures;
+}
+
+void printUsage()
+{
+  printf( "Usage: dsltogls-bench [options] [dsl_file]\n"
+          "Runs the benchmarks on the given dictionary, or on a synthetic one\n"
+          "       dsltogls-bench --generate [options] dsl_file\n"
+          "Generates a synthetic dictionary, and its abbreviations file next to it\n"
+          "Options:\n"
+          "  --startup          Run the startup benchmarks only\n"
+          "  --micro            Run the micro-benchmarks only\n"
+          "  --end-to-end       Run the end-to-end conversion only\n"
+          "  --min-time S       Run each micro-benchmark for at least S seconds\n"
+          "  --threads N        Threads to index the dictionary with\n"
+          "  --large-file       Only check that the offsets past 4 GB survive the\n"
+          "                     conversion. A synthetic dictionary is made larger\n"
+          "                     than that (4.5 GB by default)\n"
+          "  --fuzz-utf8 N      Only check the vector versions of the UTF-8\n"
+          "                     conversion against the plain one on N random texts\n"
+          "Synthetic dictionary options:\n"
+          "  --utf8             Use UTF-8 instead of UTF-16LE\n"
+          "  --articles N       Number of articles (default 100000)\n"
+          "  --min-size MB      Add more articles until the file is that large\n"
+          "  --size N           Mean article size in characters (default 400)\n"
+          "  --tags R           Share of the words in tags (default 0.15)\n"
+          "  --subcards R       Share of the articles with @ subcards (default 0.05)\n"
+          "  --optional R       Share of the headwords with (optional) parts (default 0.1)\n"
+          "  --comments R       Share of the words followed by {{comments}} (default 0.02)\n"
+          "  --abbreviations R  Share of the words which are abbreviations (default 0.03)\n"
+          "  --seed N           Random seed (default 1)\n" );
+}
+
+}
+
+int main( int argc, char ** argv )
+{
+  GenDsl::Options options;
+  bool generateOnly = false, startup = true, micro = true, endToEnd = true,
+       largeFile = false;
+  unsigned fuzzCases = 0;
+  unsigned threads = std::thread::hardware_concurrency();
+  int argPos = 1;
+
+  for( ; argPos < argc && strncmp( argv[ argPos ], "--", 2 ) == 0; ++argPos )
+  {
+    string arg = argv[ argPos ];
+    bool hasValue = argPos + 1 < argc;
+
+    if ( arg == "--generate" )
+      generateOnly = true;
+    else
+    if ( arg == "--startup" )
+      micro = endToEnd = false;
+    else
+    if ( arg == "--micro" )
+      startup = endToEnd = false;
+    else
+    if ( arg == "--end-to-end" )
+      startup = micro = false;
+    else
+    if ( arg == "--large-file" )
+    {
+      largeFile = true;
+      startup = micro = endToEnd = false;
+    }
+    else
+    if ( arg == "--utf8" )
+      options.utf16 = false;
+    else
+    if ( !hasValue )
+    {
+      printUsage();
+      return -1;
+    }
+    else
+    {
+      char const * value = argv[ ++argPos ];
+
+      if ( arg == "--min-time" )
+        minSeconds = atof( value );
+      else
+      if ( arg == "--fuzz-utf8" )
+      {
+        fuzzCases = atoi( value );
+        startup = micro = endToEnd = false;
+      }
+      else
+      if ( arg == "--threads" )
+        threads = atoi( value );
+      else
+      if ( arg == "--articles" )
+        options.articles = atoi( value );
+      else
+      if ( arg == "--min-size" )
+        options.minSize = strtoull( value, 0, 10 ) << 20;
+      else
+      if ( arg == "--size" )
+        options.meanArticleSize = atoi( value );
+      else
+      if ( arg == "--tags" )
+        options.tagDensity = atof( value );
+      else
+      if ( arg == "--subcards" )
+        options.subcardRate = atof( value );
+      else
+      if ( arg == "--optional" )
+        options.optionalRate = atof( value );
+      else
+      if ( arg == "--comments" )
+        options.commentRate = atof( value );
+      else
+      if ( arg == "--abbreviations" )
+        options.abbreviationRate = atof( value );
+      else
+      if ( arg == "--seed" )
+        options.seed = atoi( value );
+      else
+      {
+        printUsage();
+        return -1;
+      }
+    }
+  }
+
+  // Before anything else looks the languages up
+  if ( startup && !generateOnly )
+    runStartupBenchmarks();
+
+  if ( fuzzCases && !runUtf8Fuzz( fuzzCases, options.seed ) )
+    return -1;
+
+  if ( !micro && !endToEnd && !largeFile )
+    return 0;
+
+  string dslName, abrvName;
+  bool synthetic = argPos == argc;
+
+  if ( generateOnly && synthetic )
+  {
+    printUsage();
+    return -1;
+  }
+
+  if ( synthetic )
+    dslName = FsEncoding::encode( QDir::temp().filePath( "dsltogls-bench.dsl" ) );
+  else
+    dslName = argv[ argPos ];
+
+  if ( generateOnly || synthetic )
+  {
+    if ( dslName.size() < 4 || dslName.compare( dslName.size() - 4, 4, ".dsl" ) != 0 )
+    {
+      printf( "The name of the dictionary must end with .dsl\n" );
+      return -1;
+    }
+
+    if ( largeFile && !options.minSize )
+      options.minSize = 4608ULL << 20;
+
+    printf( "Generating %s...\n", dslName.c_str() );
+
+    if ( !GenDsl::generate( dslName, options ) )
+    {
+      printf( "Can't write %s\n", dslName.c_str() );
+      return -1;
+    }
+
+    if ( generateOnly )
+      return 0;
+  }
+
+  // The abbreviations are found the same way dsltogls does it
+  size_t n = dslName.size();
+  string base;
+
+  if ( n > 4 && dslName.compare( n - 4, 4, ".dsl" ) == 0 )
+    base = dslName.substr( 0, n - 4 );
+  else
+  if ( n > 7 && dslName.compare( n - 7, 7, ".dsl.dz" ) == 0 )
+    base = dslName.substr( 0, n - 7 );
+
+  if ( !base.empty() )
+  {
+    if ( QFileInfo( FsEncoding::decode( ( base + "_abrv.dsl" ).c_str() ) ).exists() )
+      abrvName = base + "_abrv.dsl";
+    else
+    if ( QFileInfo( FsEncoding::decode( ( base + "_abrv.dsl.dz" ).c_str() ) ).exists() )
+      abrvName = base + "_abrv.dsl.dz";
+  }
+
+  int result = 0;
+
+  try
+  {
+    if ( micro )
+      runMicroBenchmarks( dslName, abrvName );
+
+    if ( endToEnd )
+      runEndToEnd( dslName, abrvName, threads ? threads : 1 );
+
+    if ( largeFile && !runLargeFileCheck( dslName, abrvName, threads ? threads : 1 ) )
+      result = -1;
+  }
+  catch( std::exception & e )
+  {
+    printf( "Benchmark failed: %s\n", e.what() );
+    result = -1;
+  }
+
+  if ( synthetic )
+  {
+    QFile::remove( FsEncoding::decode( dslName.c_str() ) );
+    QFile::remove( FsEncoding::decode( ( base + "_abrv.dsl" ).c_str() ) );
+  }
+
+  return result;
+}
@@ -0,0 +1,62 @@
+# The benchmarks of the conversion steps. Build with
+#   qmake bench/bench.pro && make
+QT += core
+
+CONFIG += c++11
+
+TARGET = dsltogls-bench
+CONFIG += console
+CONFIG -= app_bundle
+
+OBJECTS_DIR = build
+
+TEMPLATE = app
+
+INCLUDEPATH += . ..
+LIBS += -lz
+
+SOURCES += \
+    bench.cc \
+    gendsl.cc \
+    ../dsl_details.cc \
+    ../wstring.cc \
+    ../wstring_qt.cc \
+    ../iconv.cc \
+    ../folding.cc \
+    ../ufile.cc \
+    ../utf8.cc \
+    ../dsl.cc \
+    ../dslindex.cc \
+    ../rendercache.cc \
+    ../mediamanifest.cc \
+    ../glswriter.cc \
+    ../stats.cc \
+    ../dictzip.c \
+    ../langcoder.cc \
+    ../fsencoding.cc \
+    ../filetype.cc \
+    ../audiolink.cc \
+    ../language.cc \
+    ../htmlescape.cc
+
+HEADERS += \
+    gendsl.hh
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# 64-bit file offsets, so the multi-gigabyte dictionaries can be read
+DEFINES += _FILE_OFFSET_BITS=64 _LARGEFILE64_SOURCE
+
+# The text of the parsed articles is kept in UTF-8, as it is written out.
+# Uncomment to keep it in wide characters instead, e.g. to compare the two
+#DEFINES += DSL_WIDE_DOM
+
+win32 {
+    INCLUDEPATH += ../winlibs/include
+
+    LIBS += -liconv
+    LIBS += -L$${PWD}/../winlibs/lib
+
+    DEFINES += UNICODE
+    DEFINES += _UNICODE
+}
@@ -0,0 +1,247 @@
+#include "gendsl.hh"
+#include "utf8.hh"
+#include "ufile.hh"
+
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+
+namespace GenDsl {
+
+namespace {
+
+char const * const Syllables[] =
+{
+  "ka", "ro", "mi", "te", "sun", "lo", "ver", "an", "is", "tor", "pe", "qua",
+  "ва", "ни", "ко", "сто", "пре", "ла", "ми", "ру", "жи", "ть", "ёж", "ща",
+  "ä", "ös", "ße", "çe", "ñu", "ø"
+};
+
+/// Tags with their attributes. The ones without the closing tag are added
+/// as is.
+char const * const Tags[][ 2 ] =
+{
+  { "[b]", "[/b]" }, { "[i]", "[/i]" }, { "[u]", "[/u]" },
+  { "[c]", "[/c]" }, { "[c red]", "[/c]" }, { "[c darkgreen]", "[/c]" },
+  { "[trn]", "[/trn]" }, { "[ex]", "[/ex]" }, { "[com]", "[/com]" },
+  { "[lang id=1033]", "[/lang]" }, { "[lang name=\"Russian\"]", "[/lang]" },
+  { "[sup]", "[/sup]" }, { "[sub]", "[/sub]" }, { "[ref]", "[/ref]" },
+  { "[url]", "[/url]" }, { "[*]", "[/*]" }, { "[']", "[/']" },
+  { "[t]", "[/t]" }, { "[s]", ".wav[/s]" }, { "[s]", ".png[/s]" }
+};
+
+char const * const Abbreviations[][ 2 ] =
+{
+  { "adj", "adjective" }, { "n", "noun" }, { "v", "verb" }, { "pl", "plural" },
+  { "obs", "obsolete" }, { "colloq", "colloquial" }, { "жарг.", "жаргонное" },
+  { "устар.", "устаревшее" }, { "перен.", "в переносном значении" }
+};
+
+template< class T, size_t N >
+size_t countOf( T const ( & )[ N ] )
+{ return N; }
+
+/// Writes the UTF-8 text in the dictionary's encoding
+class Output
+{
+  FILE * f;
+  bool utf16;
+  uint64_t size;
+  std::vector< gd::wchar > wide;
+  std::vector< unsigned char > bytes;
+
+public:
+
+  Output( string const & name, bool utf16_ ):
+    f( gd_fopen( name.c_str(), "wb" ) ), utf16( utf16_ ), size( 0 )
+  {
+    // The BOM tells the scanner the encoding, there's no #SOURCE_CODE_PAGE
+    if ( f )
+      size = utf16 ? fwrite( "\xFF\xFE", 1, 2, f ) : fwrite( "\xEF\xBB\xBF", 1, 3, f );
+  }
+
+  ~Output()
+  {
+    if ( f )
+      fclose( f );
+  }
+
+  bool isOpen() const
+  { return f != 0; }
+
+  uint64_t getSize() const
+  { return size; }
+
+  void put( string const & str )
+  {
+    if ( !utf16 )
+    {
+      size += fwrite( str.data(), 1, str.size(), f );
+      return;
+    }
+
+    wide.resize( str.size() );
+    long n = Utf8::decode( str.data(), str.size(), &wide.front() );
+
+    bytes.clear();
+    for( long x = 0; x < n; ++x )
+    {
+      bytes.push_back( wide[ x ] & 0xFF );
+      bytes.push_back( ( wide[ x ] >> 8 ) & 0xFF );
+    }
+
+    size += fwrite( &bytes.front(), 1, bytes.size(), f );
+  }
+
+  bool close()
+  {
+    bool ok = !ferror( f );
+    ok = fclose( f ) == 0 && ok;
+    f = 0;
+    return ok;
+  }
+};
+
+string makeWord( Random & random )
+{
+  string word;
+
+  for( unsigned x = 1 + random.below( 4 ); x--; )
+    word += Syllables[ random.below( countOf( Syllables ) ) ];
+
+  return word;
+}
+
+string makeHeadword( Random & random, Options const & options )
+{
+  string headword = makeWord( random );
+
+  if ( random.chance( options.optionalRate ) )
+  {
+    headword += "(" + makeWord( random ) + ")";
+
+    if ( random.chance( 0.3 ) )
+      headword += " " + makeWord( random ) + "{(}" + makeWord( random ) + "{)}";
+  }
+  else
+  if ( random.chance( 0.2 ) )
+    headword += " " + makeWord( random );
+
+  return headword;
+}
+
+/// Makes a body line of about the given number of characters
+string makeLine( Random & random, Options const & options, size_t size )
+{
+  string line = "\t";
+
+  if ( random.chance( 0.5 ) )
+    line += "[m" + string( 1, '1' + random.below( 3 ) ) + "]";
+
+  for( size_t chars = 0; chars < size; )
+  {
+    string word;
+
+    if ( random.chance( options.abbreviationRate ) )
+      word = string( "[p]" ) + Abbreviations[ random.below( countOf( Abbreviations ) ) ][ 0 ] + "[/p]";
+    else
+    if ( random.chance( options.tagDensity ) )
+    {
+      unsigned tag = random.below( countOf( Tags ) );
+      word = Tags[ tag ][ 0 ] + makeWord( random ) + Tags[ tag ][ 1 ];
+    }
+    else
+    {
+      word = makeWord( random );
+
+      if ( random.chance( 0.05 ) )
+        word += "~"; // Gets replaced with the headword
+      else
+      if ( random.chance( 0.02 ) )
+        word += "\\[" + makeWord( random ) + "\\]";
+    }
+
+    if ( random.chance( options.commentRate ) )
+      word += " {{" + makeWord( random ) + " " + makeWord( random ) + "}}";
+
+    chars += word.size() + 1;
+    line += word;
+    line += random.chance( 0.1 ) ? ", " : " ";
+  }
+
+  if ( line.size() > 1 && line[ line.size() - 1 ] == ' ' )
+    line.erase( line.size() - 1 );
+
+  if ( line.compare( 1, 2, "[m" ) == 0 )
+    line += "[/m]";
+
+  return line + "\n";
+}
+
+string makeBody( Random & random, Options const & options, size_t size )
+{
+  string body;
+
+  while( body.size() < size )
+    body += makeLine( random, options, 30 + random.below( 120 ) );
+
+  return body;
+}
+
+}
+
+bool generate( string const & dslName, Options const & options )
+{
+  Random random( options.seed );
+
+  Output dsl( dslName, options.utf16 );
+
+  if ( !dsl.isOpen() )
+    return false;
+
+  dsl.put( "#NAME \"Synthetic benchmark dictionary\"\n"
+           "#INDEX_LANGUAGE \"English\"\n"
+           "#CONTENTS_LANGUAGE \"Russian\"\n\n" );
+
+  for( unsigned article = 0; article < options.articles || dsl.getSize() < options.minSize;
+       ++article )
+  {
+    dsl.put( makeHeadword( random, options ) + "\n" );
+
+    // Some articles share the body between several headwords
+    if ( random.chance( 0.05 ) )
+      dsl.put( makeHeadword( random, options ) + "\n" );
+
+    dsl.put( makeBody( random, options,
+                       1 + (size_t) random.exponential( options.meanArticleSize ) ) );
+
+    if ( random.chance( options.subcardRate ) )
+      for( unsigned x = 1 + random.below( 3 ); x--; )
+      {
+        dsl.put( "\t@ " + makeWord( random ) + " " + makeWord( random ) + "\n" );
+        dsl.put( makeBody( random, options, 50 + random.below( 200 ) ) );
+        dsl.put( "\t@\n" );
+      }
+
+    dsl.put( "\n" );
+  }
+
+  if ( !dsl.close() )
+    return false;
+
+  Output abrv( dslName.substr( 0, dslName.size() - 4 ) + "_abrv.dsl", options.utf16 );
+
+  if ( !abrv.isOpen() )
+    return false;
+
+  abrv.put( "#NAME \"Abbreviations\"\n"
+            "#INDEX_LANGUAGE \"Russian\"\n"
+            "#CONTENTS_LANGUAGE \"Russian\"\n\n" );
+
+  for( size_t x = 0; x < countOf( Abbreviations ); ++x )
+    abrv.put( string( Abbreviations[ x ][ 0 ] ) + "\n\t" + Abbreviations[ x ][ 1 ] + "\n\n" );
+
+  return abrv.close();
+}
+
+}
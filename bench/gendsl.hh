@@ -0,0 +1,80 @@
+#ifndef __GENDSL_HH_INCLUDED__
+#define __GENDSL_HH_INCLUDED__
+
+#include <math.h>
+#include <stdint.h>
+#include <string>
+
+/// Generates synthetic DSL dictionaries for the benchmarks. The articles are
+/// made of random words, with the markup, the embedded cards, the optional
+/// headword parts, the comments and the abbreviations mixed in at the given
+/// rates, so the corpus exercises the same code the real ones do.
+namespace GenDsl {
+
+using std::string;
+
+/// A xorshift generator, so the corpus is the same everywhere for the seed
+class Random
+{
+  uint32_t state;
+
+public:
+
+  explicit Random( uint32_t seed ): state( seed ? seed : 1 )
+  {}
+
+  uint32_t next()
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  }
+
+  unsigned below( unsigned n )
+  { return next() % n; }
+
+  bool chance( double p )
+  { return next() < p * 4294967296.0; }
+
+  double exponential( double mean )
+  { return -mean * log( ( next() + 1.0 ) / 4294967297.0 ); }
+};
+
+struct Options
+{
+  /// UTF-16LE, as most of the real dictionaries are, or UTF-8
+  bool utf16;
+  unsigned articles;
+  /// More articles are added, past the count, until the file is at least
+  /// this large. Used to make the dictionaries larger than 4 GB
+  uint64_t minSize;
+  /// The mean size of the article body in characters. The sizes are spread
+  /// exponentially, so there are a few much larger ones.
+  unsigned meanArticleSize;
+  /// The share of the words wrapped in a tag
+  double tagDensity;
+  /// The share of the articles having embedded (@) cards
+  double subcardRate;
+  /// The share of the headwords having (optional) parts
+  double optionalRate;
+  /// The share of the lines having a {{comment}}
+  double commentRate;
+  /// The share of the words which are [p]abbreviations[/p]
+  double abbreviationRate;
+  uint32_t seed;
+
+  Options():
+    utf16( true ), articles( 100000 ), minSize( 0 ), meanArticleSize( 400 ),
+    tagDensity( 0.15 ), subcardRate( 0.05 ), optionalRate( 0.1 ),
+    commentRate( 0.02 ), abbreviationRate( 0.03 ), seed( 1 )
+  {}
+};
+
+/// Writes the dictionary, and its _abrv file next to it. The name must end
+/// with .dsl. Returns false if the files can't be written.
+bool generate( string const & dslName, Options const & );
+
+}
+
+#endif
@@ -139,6 +139,19 @@
 
 #include <sys/stat.h>
 
+/* 64-bit file positions. Elsewhere they come with _FILE_OFFSET_BITS=64 */
+#ifdef __WIN32
+#define dz_fseek _fseeki64
+#define dz_ftell _ftelli64
+#define dz_fstat _fstati64
+typedef struct _stati64 dz_stat_t;
+#else
+#define dz_fseek fseeko
+#define dz_ftell ftello
+#define dz_fstat fstat
+typedef struct stat dz_stat_t;
+#endif
+
 #define USE_CACHE 1
 
 #define dict_data_filter( ... )
@@ -268,10 +281,10 @@ static enum  DZ_ERRORS dict_read_header( const char *filename,
    int           i;
    char          *pt;
    int           c;
-   struct stat   sb;
+   dz_stat_t     sb;
    unsigned long crc   = crc32( 0L, Z_NULL, 0 );
    int           count;
-   unsigned long offset;
+   uint64_t      offset;
 
    if (!(str = gd_fopen( filename, "rb" )))
    {
@@ -289,7 +302,7 @@ static enum  DZ_ERRORS dict_read_header( const char *filename,
 
    if (id1 != GZ_MAGIC1 || id2 != GZ_MAGIC2) {
       header->type = DICT_TEXT;
-      fstat( fileno( str ), &sb );
+      dz_fstat( fileno( str ), &sb );
       header->compressedLength = header->length = sb.st_size;
       header->origFilename     = NULL;//str_find( filename );
       header->mtime            = sb.st_mtime;
@@ -359,7 +372,7 @@ static enum  DZ_ERRORS dict_read_header( const char *filename,
 	 }
 	 header->type = DICT_DZIP;
       } else {
-	 fseek( str, header->headerLength, SEEK_SET );
+	 dz_fseek( str, header->headerLength, SEEK_SET );
       }
    }
    
@@ -404,7 +417,7 @@ static enum  DZ_ERRORS dict_read_header( const char *filename,
 
       *pt = '\0';
       header->comment = NULL;//str_find( buffer );
-      header->headerLength += strlen( header->comment ) + 1;
+      header->headerLength += strlen( buffer ) + 1;
    } else {
       header->comment = NULL;
    }
@@ -415,18 +428,18 @@ static enum  DZ_ERRORS dict_read_header( const char *filename,
       header->headerLength += 2;
    }
 
-   if (ftell( str ) != header->headerLength + 1)
+   if (dz_ftell( str ) != header->headerLength + 1)
    {
       err_internal( __func__,
-		    "File position (%lu) != header length + 1 (%d)\n",
-		    ftell( str ), header->headerLength + 1 );
+		    "File position (%llu) != header length + 1 (%d)\n",
+		    (unsigned long long) dz_ftell( str ), header->headerLength + 1 );
       fclose( str );
       if( header->chunks )
         free( header->chunks );
       return DZ_ERR_INVALID_FORMAT;
    }
 
-   fseek( str, -8, SEEK_END );
+   dz_fseek( str, -8, SEEK_END );
    header->crc     = getc( str ) <<  0;
    header->crc    |= getc( str ) <<  8;
    header->crc    |= getc( str ) << 16;
@@ -435,7 +448,7 @@ static enum  DZ_ERRORS dict_read_header( const char *filename,
    header->length |= getc( str ) <<  8;
    header->length |= getc( str ) << 16;
    header->length |= getc( str ) << 24;
-   header->compressedLength = ftell( str );
+   header->compressedLength = dz_ftell( str );
 
 				/* Compute offsets */
    header->offsets = xmalloc( sizeof( header->offsets[0] )
@@ -512,7 +525,11 @@ dictData *dict_data_open( const char *filename,
        break;
      }
 
-     h->size = GetFileSize( h->fd, 0 );
+     {
+       DWORD sizeHigh = 0;
+       DWORD sizeLow = GetFileSize( h->fd, &sizeHigh );
+       h->size = ( (uint64_t) sizeHigh << 32 ) | sizeLow;
+     }
 #else
      h->fd = gd_fopen( filename, "rb" );
 
@@ -524,9 +541,9 @@ dictData *dict_data_open( const char *filename,
              "Cannot open data file \"%s\"\n", filename );*/
       }
 
-     fseek( h->fd, 0, SEEK_END );
+     dz_fseek( h->fd, 0, SEEK_END );
 
-     h->size = ftell( h->fd );
+     h->size = dz_ftell( h->fd );
 #endif
 
      for (j = 0; j < DICT_CACHE_SIZE; j++) {
@@ -578,12 +595,12 @@ void dict_data_close( dictData *header )
 }
 
 char *dict_data_read_ (
-   dictData *h, unsigned long start, unsigned long size,
+   dictData *h, uint64_t start, size_t size,
    const char *preFilter, const char *postFilter )
 {
    char * buffer;
    char * pt;
-   unsigned long end;
+   uint64_t      end;
    int           count;
    char          *inBuffer;
    char          outBuffer[OUT_BUFFER_SIZE];
@@ -610,8 +627,8 @@ char *dict_data_read_ (
    }
 
    PRINTF(DBG_UNZIP,
-	  ("dict_data_read( %p, %lu, %lu, %s, %s )\n",
-	   h, start, size, preFilter, postFilter ));
+	  ("dict_data_read( %p, %llu, %lu, %s, %s )\n",
+	   h, (unsigned long long) start, (unsigned long) size, preFilter, postFilter ));
 
    assert( h != NULL);
    switch (h->type) {
@@ -629,14 +646,14 @@ char *dict_data_read_ (
    case DICT_TEXT:
    {
 #ifdef __WIN32
-     long hiPtr = 0;
-     DWORD pos = SetFilePointer( h->fd, start, &hiPtr, FILE_BEGIN );
+     LONG hiPtr = (LONG)( start >> 32 );
+     DWORD pos = SetFilePointer( h->fd, (LONG)( start & 0xFFFFFFFF ), &hiPtr, FILE_BEGIN );
      DWORD readed = 0;
      if( pos != INVALID_SET_FILE_POINTER || GetLastError() != NO_ERROR )
        ReadFile( h->fd, buffer, size, &readed, 0 );
      if( size != readed )
 #else
-     if ( fseek( h->fd, start, SEEK_SET ) != 0 ||
+     if ( dz_fseek( h->fd, start, SEEK_SET ) != 0 ||
           fread( buffer, size, 1, h->fd ) != 1 )
 #endif
      {
@@ -675,10 +692,11 @@ char *dict_data_read_ (
       lastChunk   = end / h->chunkLength;
       lastOffset  = end - lastChunk * h->chunkLength;
       PRINTF(DBG_UNZIP,
-	     ("   start = %lu, end = %lu\n"
+	     ("   start = %llu, end = %llu\n"
 	      "firstChunk = %d, firstOffset = %d,"
 	      " lastChunk = %d, lastOffset = %d\n",
-	      start, end, firstChunk, firstOffset, lastChunk, lastOffset ));
+	      (unsigned long long) start, (unsigned long long) end,
+	      firstChunk, firstOffset, lastChunk, lastOffset ));
       for (pt = buffer, i = firstChunk; i <= lastChunk; i++) {
 
 				/* Access cache */
@@ -707,13 +725,16 @@ char *dict_data_read_ (
 	      h->cache[j].stamp = -1;
 	 }
 	 if (found) {
+	    ++h->cacheHits;
 	    count = h->cache[target].count;
 	    inBuffer = h->cache[target].inBuffer;
 	 } else {
 #ifdef __WIN32
         DWORD pos ;
         DWORD readed;
+        LONG hiPtr;
 #endif
+	    ++h->cacheMisses;
 	    h->cache[target].chunk = -1;
 	    if (!h->cache[target].inBuffer)
 	       h->cache[target].inBuffer = xmalloc( h->chunkLength );
@@ -738,13 +759,14 @@ char *dict_data_read_ (
 	    }
 
 #ifdef __WIN32
-      pos = SetFilePointer( h->fd, h->offsets[ i ], 0, FILE_BEGIN );
+      hiPtr = (LONG)( h->offsets[ i ] >> 32 );
+      pos = SetFilePointer( h->fd, (LONG)( h->offsets[ i ] & 0xFFFFFFFF ), &hiPtr, FILE_BEGIN );
       readed = 0;
       if( pos != INVALID_SET_FILE_POINTER || GetLastError() != NO_ERROR )
         ReadFile( h->fd, outBuffer, h->chunks[ i ], &readed, 0 );
       if( h->chunks[ i ] != (int)readed )
 #else
-      if ( fseek( h->fd, h->offsets[ i ], SEEK_SET ) != 0 ||
+      if ( dz_fseek( h->fd, h->offsets[ i ], SEEK_SET ) != 0 ||
            fread( outBuffer, h->chunks[ i ], 1, h->fd ) != 1 )
 #endif
       {
@@ -25,6 +25,7 @@
 #define _DICTZIP_H_
 
 #include <stdio.h>
+#include <stdint.h>
 #include <zlib.h>
 
 #ifdef __WIN32
@@ -65,7 +66,7 @@ typedef struct dictData {
    FILE *        fd;		/* file descriptor */
 #endif
 
-   unsigned long size;		/* size of file */
+   uint64_t      size;		/* size of file */
    
    int           type;
    const char    *filename;
@@ -82,14 +83,16 @@ typedef struct dictData {
    int           chunkLength;
    int           chunkCount;
    int           *chunks;
-   unsigned long *offsets;	/* Sum-scan of chunks. */
+   uint64_t      *offsets;	/* Sum-scan of chunks. */
    const char    *origFilename;
    const char    *comment;
    unsigned long crc;
-   unsigned long length;
-   unsigned long compressedLength;
+   uint64_t      length;
+   uint64_t      compressedLength;
    int           stamp;
    dictCache     cache[DICT_CACHE_SIZE];
+   uint64_t      cacheHits;	/* Chunks found in the cache */
+   uint64_t      cacheMisses;	/* Chunks inflated */
    char          errorString[512];
 } dictData;
 
@@ -103,7 +106,7 @@ extern void dict_data_close (
 
 extern char *dict_data_read_ (
    dictData *data,
-   unsigned long start, unsigned long end,
+   uint64_t start, size_t size,
    const char *preFilter,
    const char *postFilter );
 
@@ -12,7 +12,12 @@
 #include "wstring_qt.hh"
 #include "gddebug.hh"
 #include "fsencoding.hh"
+#include "dslindex.hh"
+#include "stats.hh"
 #include <wctype.h>
+#include <chrono>
+#include <thread>
+#include <exception>
 
 #include <QTextStream>
 #include <QDir>
@@ -30,173 +35,304 @@ bool isDslWs( wchar ch )
   }
 }
 
-string DslDictionary::getId()
+namespace {
+
+uint64_t const EndOfFile = ~uint64_t( 0 );
+
+/// The files are only indexed in parallel if each thread gets this much.
+uint64_t const MinScanRangeSize = 4 * 1024 * 1024;
+
+struct HeadwordLine
 {
-  return string( "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx");
-}
+  uint64_t offset, end; // end is 0 until the next line is read
+  size_t firstVariant; // Index of the line's first variant
+};
 
-DslDictionary::~DslDictionary()
+void addHeadwordLine( vector< HeadwordLine > & lines, vector< wstring > & variants,
+                      uint64_t offset, OptionalPartsExpander const & expander )
 {
-  if( dz )
-    dict_data_close( dz );
+  HeadwordLine line;
+  line.offset = offset;
+  line.end = 0;
+  line.firstVariant = variants.size();
+  lines.push_back( line );
+
+  for( size_t x = 0; x < expander.size(); ++x )
+    variants.push_back( expander[ x ] );
 }
 
-int DslDictionary::setFiles( string const & dsl_name, string const & abr_name )
+/// Finds the first headword line having a variant which matches the given
+/// headword in the same way loadArticle() matches them, i.e. ignoring case.
+/// Returns -1 if there is none.
+int findDisplayedHeadwordLine( vector< HeadwordLine > const & lines,
+                               vector< wstring > & variants,
+                               wstring const & headword )
 {
-  int atLine = 0;
+  wstring headwordFolded = Folding::applySimpleCaseOnly( headword );
+  wstring folded;
 
-  try
+  size_t line = 0;
+
+  for( size_t x = 0; x < variants.size(); ++x )
   {
-    if( !abr_name.empty() )
-    {
-      DslScanner abrvScanner( abr_name );
+    while( line + 1 < lines.size() && lines[ line + 1 ].firstVariant <= x )
+      ++line;
 
-      wstring curString;
-      size_t curOffset;
+    wstring & str = variants[ x ];
 
-      for( ; ; )
-      {
-        // Skip any whitespace
-        if ( !abrvScanner.readNextLineWithoutComments( curString, curOffset ) )
-          break;
-        if ( curString.empty() || isDslWs( curString[ 0 ] ) )
-          continue;
+    unescapeDsl( str );
+    normalizeHeadword( str );
 
-        list< wstring > keys;
+    wchar const * word = str.data();
+    size_t wordSize = str.size();
 
-        bool eof = false;
+    Folding::trimWhitespace( word, wordSize );
 
-        // Insert the key and read more, or get to the definition
-        for( ; ; )
-        {
-          processUnsortedParts( curString, true );
+    if ( wordSize != headwordFolded.size() )
+      continue;
 
-          if ( keys.size() )
-            expandTildes( curString, keys.front() );
+    folded.resize( wordSize );
+    Folding::applySimpleCaseOnly( word, wordSize, &folded[ 0 ] );
 
-          expandOptionalParts( curString, &keys );
+    if ( folded == headwordFolded )
+      return line;
+  }
 
-          if ( !abrvScanner.readNextLineWithoutComments( curString, curOffset ) || curString.empty() )
-          {
-            gdWarning( "Warning: premature end of file %s\n", abr_name.c_str() );
-            eof = true;
-            break;
-          }
+  return -1;
+}
 
-          if ( isDslWs( curString[ 0 ] ) )
-            break;
-        }
 
-        if ( eof )
-          break;
+/// Builds the cards of the articles the scanner reads, adding them to the
+/// given table. Stops before the first article starting at or past the given
+/// offset and returns its offset, or EndOfFile if the file ends first.
+uint64_t scanArticles( DslScanner & scanner, uint64_t stopAt,
+                       QVector< DslCard > & cards )
+{
+  // Reused for all the headwords to avoid reallocating its buffers
+  OptionalPartsExpander expander;
 
-        curString.erase( 0, curString.find_first_not_of( GD_NATIVE_TO_WS( L" \t" ) ) );
+  bool hasString = false;
+  wstring curString;
+  uint64_t curOffset;
 
-        if ( keys.size() )
-          expandTildes( curString, keys.front() );
+  uint32_t articleCount = 0, wordCount = 0;
 
-        // If the string has any dsl markup, we strip it
-        string value = Utf8::encode( ArticleDom( curString ).root.renderAsText() );
+  // Headword lines of the current article, and their variants, used to
+  // find the line the article is to be displayed by
+  vector< HeadwordLine > headwordLines;
+  vector< wstring > headwordVariants;
 
-        for( list< wstring >::iterator i = keys.begin(); i != keys.end();
-             ++i )
-        {
-          unescapeDsl( *i );
-          normalizeHeadword( *i );
+  for( ; ; )
+  {
+    // Find the main headword
 
-          abrv[ Utf8::encode( Folding::trimWhitespace( *i ) ) ] = value;
+    if ( !hasString && !scanner.readNextLineWithoutComments( curString, curOffset ) )
+      break; // Clean end of file
+
+    hasString = false;
+
+    // The line read should either consist of pure whitespace, or be a
+    // headword
+
+    if ( curString.empty() )
+      continue;
+
+    if ( isDslWs( curString[ 0 ] ) )
+    {
+      // The first character is blank. Let's make sure that all other
+      // characters are blank, too.
+      for( size_t x = 1; x < curString.size(); ++x )
+      {
+        if ( !isDslWs( curString[ x ] ) )
+        {
+          printf( "Warning: garbage string at offset 0x%llX\n", (unsigned long long) curOffset );
+          break;
         }
       }
+      continue;
     }
 
-    DslScanner scanner( dsl_name );
+    // Ok, got the headword
 
-    params.name = scanner.getDictionaryName();
-    params.langFrom = scanner.getLangFrom();
-    params.langTo = scanner.getLangTo();
-    params.encoding = scanner.getEncoding();
-    params.langFromRTL = LangCoder::isLanguageRTL( LangCoder::findIdForLanguage( params.langFrom ) );
-    params.langToRTL = LangCoder::isLanguageRTL( LangCoder::findIdForLanguage( params.langTo ) );
+    if ( curOffset >= stopAt )
+      return curOffset; // It belongs to the next range
 
+    list< wstring > allEntryWords;
 
-    try
-    {
-      bool hasString = false;
-      wstring curString;
-      size_t curOffset;
+    headwordLines.clear();
+    headwordVariants.clear();
 
-      uint32_t articleCount = 0, wordCount = 0;
+    processUnsortedParts( curString, true );
+    expander.expand( curString );
+    expander.appendTo( allEntryWords );
+    addHeadwordLine( headwordLines, headwordVariants, curOffset, expander );
 
-      for( ; ; )
+    uint64_t articleOffset = curOffset;
+
+    //DPRINTF( "Headword: %ls\n", curString.c_str() );
+
+    // More headwords may follow
+
+    for( ; ; )
+    {
+      if ( ! ( hasString = scanner.readNextLineWithoutComments( curString, curOffset ) ) )
       {
-        // Find the main headword
+        printf( "Warning: premature end of file\n" );
+        break;
+      }
 
-        if ( !hasString && !scanner.readNextLineWithoutComments( curString, curOffset ) )
-          break; // Clean end of file
+      if ( !headwordLines.back().end )
+        headwordLines.back().end = curOffset;
 
-        hasString = false;
+      // Lingvo skips empty strings between the headwords
+      if ( curString.empty() )
+        continue;
 
-        // The line read should either consist of pure whitespace, or be a
-        // headword
+      if ( isDslWs( curString[ 0 ] ) )
+        break; // No more headwords
 
-        if ( curString.empty() )
-          continue;
+      processUnsortedParts( curString, true );
+      expandTildes( curString, allEntryWords.front() );
+      expander.expand( curString );
+      expander.appendTo( allEntryWords );
+      addHeadwordLine( headwordLines, headwordVariants, curOffset, expander );
+    }
+
+    if ( !hasString )
+      break;
 
-        if ( isDslWs( curString[ 0 ] ) )
+    // Insert new entry
+
+    DslCard newCard;
+    newCard.offset = articleOffset;
+
+    for( list< wstring >::iterator j = allEntryWords.begin();
+         j != allEntryWords.end(); ++j )
+    {
+      unescapeDsl( *j );
+      normalizeHeadword( *j );
+      newCard.headwords.push_back( *j );
+    }
+
+    newCard.bodyOffset = curOffset - articleOffset;
+
+    int line = findDisplayedHeadwordLine( headwordLines, headwordVariants,
+                                          newCard.headwords.front() );
+    if ( line >= 0 )
+    {
+      newCard.headwordIndex = line;
+      newCard.headwordOffset = headwordLines[ line ].offset - articleOffset;
+      newCard.headwordSize = headwordLines[ line ].end - headwordLines[ line ].offset;
+    }
+
+    ++articleCount;
+    wordCount += allEntryWords.size();
+    allEntryWords.clear();
+
+    int insideInsided = 0;
+    wstring headword;
+    QVector< InsidedCard > insidedCards;
+    uint64_t offset = curOffset;
+    QVector< wstring > insidedHeadwords;
+    unsigned linesInsideCard = 0;
+    int dogLine = 0;
+
+    // Handle the article's body
+    for( ; ; )
+    {
+
+      if ( ! ( hasString = scanner.readNextLineWithoutComments( curString, curOffset ) )
+           || ( curString.size() && !isDslWs( curString[ 0 ] ) ) )
+      {
+        if( insideInsided )
         {
-          // The first character is blank. Let's make sure that all other
-          // characters are blank, too.
-          for( size_t x = 1; x < curString.size(); ++x )
-          {
-            if ( !isDslWs( curString[ x ] ) )
-            {
-              printf( "Warning: garbage string at offset 0x%lX\n", (unsigned long) curOffset );
-              break;
-            }
-          }
-          continue;
+          gdWarning( "Unclosed tag '@' at line %i\n", dogLine );
+          insidedCards.append( InsidedCard( offset, curOffset - offset, insidedHeadwords ) );
         }
+        break;
+      }
+
+      // Find embedded cards
 
-        // Ok, got the headword
+      wstring::size_type n = curString.find( L'@' );
+      if( n == wstring::npos || curString[ n - 1 ] == L'\\' )
+      {
+        if( insideInsided )
+          linesInsideCard++;
 
-        list< wstring > allEntryWords;
+        continue;
+      }
+      else
+      {
+        // Embedded card tag must be placed at first position in line after spaces
+        if( !isAtSignFirst( curString ) )
+        {
+          gdWarning( "Unescaped '@' symbol at line %i\n", scanner.getLinesRead() - 1 );
 
-        processUnsortedParts( curString, true );
-        expandOptionalParts( curString, &allEntryWords );
+          if( insideInsided )
+            linesInsideCard++;
 
-        unsigned articleOffset = curOffset;
+          continue;
+        }
+      }
 
-        //DPRINTF( "Headword: %ls\n", curString.c_str() );
+      dogLine = scanner.getLinesRead() - 1;
 
-        // More headwords may follow
+      // Handle embedded card
 
-        for( ; ; )
+      if( insideInsided )
+      {
+        if( linesInsideCard )
         {
-          if ( ! ( hasString = scanner.readNextLineWithoutComments( curString, curOffset ) ) )
-          {
-            printf( "Warning: premature end of file\n" );
-            break;
-          }
+          insidedCards.append( InsidedCard( offset, curOffset - offset, insidedHeadwords ) );
 
-          // Lingvo skips empty strings between the headwords
-          if ( curString.empty() )
-            continue;
+          insidedHeadwords.clear();
+          linesInsideCard = 0;
+          offset = curOffset;
+        }
+      }
+      else
+      {
+        offset = curOffset;
+        linesInsideCard = 0;
+      }
 
-          if ( isDslWs( curString[ 0 ] ) )
-            break; // No more headwords
+      headword = Folding::trimWhitespace( curString.substr( n + 1 ) );
 
-          processUnsortedParts( curString, true );
-          expandTildes( curString, allEntryWords.front() );
-          expandOptionalParts( curString, &allEntryWords );
-        }
+      if( !headword.empty() )
+      {
+        processUnsortedParts( headword, true );
+        expandTildes( headword, allEntryWords.front() );
+        insidedHeadwords.append( headword );
+        insideInsided = true;
+      }
+      else
+        insideInsided = false;
+    }
 
-        if ( !hasString )
-          break;
+    // Now that we're having read the first string after the article
+    // itself, we can use its offset to calculate the article's size.
+    // An end of file works here, too.
+
+    uint32_t articleSize = ( curOffset - articleOffset );
+    newCard.size = articleSize;
+    cards.push_back( newCard );
 
-        // Insert new entry
+    // The embedded cards are left for loadArticle() to scan
+    newCard.headwordOffset = newCard.headwordSize = newCard.headwordIndex = 0;
+    newCard.bodyOffset = 0;
 
-        DslCard newCard;
-        newCard.offset = articleOffset;
+    for( QVector< InsidedCard >::iterator i = insidedCards.begin(); i != insidedCards.end(); ++i )
+    {
+      newCard.headwords.clear();
+      newCard.offset = (*i).offset;
+      newCard.size = (*i).size;
+
+      for( int x = 0; x < (*i).headwords.size(); x++ )
+      {
+        allEntryWords.clear();
+        expander.expand( (*i).headwords[ x ] );
+        expander.appendTo( allEntryWords );
 
         for( list< wstring >::iterator j = allEntryWords.begin();
              j != allEntryWords.end(); ++j )
@@ -206,136 +342,392 @@ int DslDictionary::setFiles( string const & dsl_name, string const & abr_name )
           newCard.headwords.push_back( *j );
         }
 
-        ++articleCount;
+        cards.push_back( newCard );
         wordCount += allEntryWords.size();
-        allEntryWords.clear();
+      }
+      ++articleCount;
+    }
 
-        int insideInsided = 0;
-        wstring headword;
-        QVector< InsidedCard > insidedCards;
-        uint32_t offset = curOffset;
-        QVector< wstring > insidedHeadwords;
-        unsigned linesInsideCard = 0;
-        int dogLine = 0;
+    if ( !hasString )
+      break;
+  }
 
-        // Handle the article's body
-        for( ; ; )
-        {
+  return EndOfFile;
+}
 
-          if ( ! ( hasString = scanner.readNextLineWithoutComments( curString, curOffset ) )
-               || ( curString.size() && !isDslWs( curString[ 0 ] ) ) )
-          {
-            if( insideInsided )
-            {
-              gdWarning( "Unclosed tag '@' at line %i\n", dogLine );
-              insidedCards.append( InsidedCard( offset, curOffset - offset, insidedHeadwords ) );
-            }
-            break;
-          }
+/// A part of the file indexed on its own thread
+struct ScanRange
+{
+  uint64_t start, end; // start is where the first article begins
+  QVector< DslCard > cards;
+  uint64_t stopOffset; // Where the first article not in the range begins
+  std::exception_ptr error;
+};
+
+/// Finds an article beginning at or past the given offset. Since there's no
+/// telling whether a line is inside a multi-line comment or not, it might be
+/// wrong -- the caller has to check that. Returns EndOfFile if none is found.
+uint64_t findArticleStart( DslScanner & scanner, uint64_t offset )
+{
+  if ( !scanner.seekToLine( offset ) )
+    return EndOfFile;
 
-          // Find embedded cards
+  // An article begins with a headword line following the body of the
+  // previous one
+  bool hadBody = false;
 
-          wstring::size_type n = curString.find( L'@' );
-          if( n == wstring::npos || curString[ n - 1 ] == L'\\' )
-          {
-            if( insideInsided )
-              linesInsideCard++;
+  wstring str;
+  uint64_t lineOffset;
 
-            continue;
-          }
-          else
-          {
-            // Embedded card tag must be placed at first position in line after spaces
-            if( !isAtSignFirst( curString ) )
-            {
-              gdWarning( "Unescaped '@' symbol at line %i\n", scanner.getLinesRead() - 1 );
+  while( scanner.readNextLineWithoutComments( str, lineOffset ) )
+  {
+    if ( str.empty() )
+      continue;
 
-              if( insideInsided )
-                linesInsideCard++;
+    if ( !isDslWs( str[ 0 ] ) && hadBody )
+      return lineOffset;
 
-              continue;
-            }
-          }
+    hadBody = isDslWs( str[ 0 ] );
+  }
 
-          dogLine = scanner.getLinesRead() - 1;
+  return EndOfFile;
+}
 
-          // Handle embedded card
+void scanRange( string const & dslName, ScanRange & range )
+{
+  try
+  {
+    DslScanner scanner( dslName );
 
-          if( insideInsided )
-          {
-            if( linesInsideCard )
-            {
-              insidedCards.append( InsidedCard( offset, curOffset - offset, insidedHeadwords ) );
-
-              insidedHeadwords.clear();
-              linesInsideCard = 0;
-              offset = curOffset;
-            }
-          }
-          else
-          {
-            offset = curOffset;
-            linesInsideCard = 0;
-          }
+    if ( scanner.seekToLine( range.start ) )
+      range.stopOffset = scanArticles( scanner, range.end, range.cards );
+    else
+      range.stopOffset = EndOfFile;
+  }
+  catch( ... )
+  {
+    range.error = std::current_exception();
+  }
+}
 
-          headword = Folding::trimWhitespace( curString.substr( n + 1 ) );
+/// Same as scanArticles() till the end of file, but splits the file into
+/// ranges indexed on their own threads. The ranges' borders are guessed, and
+/// each range is checked to begin right where the previous one actually
+/// ended. The ones which don't are indexed again, so the result is always
+/// the same as with the serial scan.
+void scanInParallel( string const & dslName, DslScanner & scanner,
+                     unsigned threads, QVector< DslCard > & cards )
+{
+  // Where the articles begin, right past the headers
+  uint64_t firstOffset;
+  wstring str;
 
-          if( !headword.empty() )
-          {
-            processUnsortedParts( headword, true );
-            expandTildes( headword, allEntryWords.front() );
-            insidedHeadwords.append( headword );
-            insideInsided = true;
-          }
-          else
-            insideInsided = false;
-        }
+  uint64_t fileSize = QFileInfo( FsEncoding::decode( dslName.c_str() ) ).size();
+
+  {
+    DslScanner headers( dslName );
+
+    if ( !headers.readNextLine( str, firstOffset ) )
+      return;
+  }
 
-        // Now that we're having read the first string after the article
-        // itself, we can use its offset to calculate the article's size.
-        // An end of file works here, too.
+  uint64_t rangeSize = ( fileSize - firstOffset ) / threads;
 
-        uint32_t articleSize = ( curOffset - articleOffset );
-        newCard.size = articleSize;
-        allCards.push_back( newCard );
+  if ( rangeSize < MinScanRangeSize )
+  {
+    scanArticles( scanner, EndOfFile, cards );
+    return;
+  }
+
+  vector< ScanRange > ranges( 1 );
+
+  ranges[ 0 ].start = firstOffset;
+
+  {
+    DslScanner snapper( dslName );
+
+    for( unsigned x = 1; x < threads; ++x )
+    {
+      uint64_t start = findArticleStart( snapper, firstOffset + rangeSize * x );
+
+      if ( start == EndOfFile )
+        break;
+
+      if ( start <= ranges.back().start )
+        continue;
+
+      ranges.push_back( ScanRange() );
+      ranges.back().start = start;
+    }
+  }
+
+  for( size_t x = 0; x < ranges.size(); ++x )
+    ranges[ x ].end = x + 1 < ranges.size() ? ranges[ x + 1 ].start : EndOfFile;
+
+  // The first range goes on this thread, with the scanner given
+  vector< std::thread > workers;
+
+  for( size_t x = 1; x < ranges.size(); ++x )
+    workers.push_back( std::thread( scanRange, std::cref( dslName ),
+                                    std::ref( ranges[ x ] ) ) );
+
+  try
+  {
+    ranges[ 0 ].stopOffset = scanArticles( scanner, ranges[ 0 ].end, ranges[ 0 ].cards );
+  }
+  catch( ... )
+  {
+    ranges[ 0 ].error = std::current_exception();
+  }
+
+  for( size_t x = 0; x < workers.size(); ++x )
+    workers[ x ].join();
+
+  for( size_t x = 0; x < ranges.size(); ++x )
+  {
+    ScanRange & range = ranges[ x ];
+
+    if ( x )
+    {
+      uint64_t actualStart = ranges[ x - 1 ].stopOffset;
+
+      if ( actualStart == EndOfFile )
+        break;
 
-        for( QVector< InsidedCard >::iterator i = insidedCards.begin(); i != insidedCards.end(); ++i )
+      if ( actualStart != range.start )
+      {
+        // The guess was wrong, do it again from the right place
+        range.start = actualStart;
+        range.cards.clear();
+        range.error = std::exception_ptr();
+
+        scanRange( dslName, range );
+      }
+    }
+
+    if ( range.error )
+      std::rethrow_exception( range.error );
+
+    cards += range.cards;
+  }
+}
+
+/// Counts the dictionary just indexed or loaded for the stats.
+void addIndexingStats( string const & dslName, string const & abrvName,
+                       QVector< DslCard > const & cards )
+{
+  if ( !Stats::isEnabled() )
+    return;
+
+  Stats::add( Stats::InputBytes, QFileInfo( FsEncoding::decode( dslName.c_str() ) ).size() );
+
+  if ( !abrvName.empty() )
+    Stats::add( Stats::InputBytes, QFileInfo( FsEncoding::decode( abrvName.c_str() ) ).size() );
+
+  uint64_t variants = 0;
+  for( int x = 0; x < cards.size(); ++x )
+    variants += cards[ x ].headwords.size();
+
+  Stats::add( Stats::Cards, cards.size() );
+  Stats::add( Stats::HeadwordVariants, variants );
+}
+
+}
+
+ArticleCache::Entry * ArticleCache::find( uint64_t offset, uint32_t size )
+{
+  ++lookups;
+
+  Entry * entry = peek( offset, size );
+
+  if ( entry )
+  {
+    ++hits;
+    bytesSaved += size;
+  }
+
+  return entry;
+}
+
+ArticleCache::Entry * ArticleCache::peek( uint64_t offset, uint32_t size )
+{
+  for( size_t x = 0; x < entries.size(); ++x )
+    if ( entries[ x ].offset == offset && entries[ x ].size == size )
+      return &entries[ x ];
+
+  return 0;
+}
+
+ArticleCache::Entry & ArticleCache::insert( uint64_t offset, uint32_t size,
+                                            wstring const & data )
+{
+  if ( entries.size() < Capacity )
+    entries.push_back( Entry() );
+  else
+    entries[ next ] = Entry();
+
+  Entry & entry = entries[ next ];
+  next = ( next + 1 ) % Capacity;
+
+  entry.offset = offset;
+  entry.size = size;
+  entry.data = data;
+
+  return entry;
+}
+
+string DslDictionary::getId()
+{
+  return string( "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx");
+}
+
+DslDictionary::~DslDictionary()
+{
+  if( dz )
+    dict_data_close( dz );
+}
+
+int DslDictionary::openData( string const & dsl_name )
+{
+  DZ_ERRORS error;
+  dz = dict_data_open( dsl_name.c_str(), &error, 0 );
+  if( !dz )
+  {
+    printf( "\nInput file opening error: %s\n", dz_error_str( error ) );
+    return -1;
+  }
+
+  return 0;
+}
+
+char * DslDictionary::readData( DslCard const & card )
+{
+  Stats::Timer timer( Stats::Reading );
+
+  uint64_t hits = dz->cacheHits, misses = dz->cacheMisses;
+
+  char * data = dict_data_read_( dz, card.offset, card.size, 0, 0 );
+
+  if ( data )
+    Stats::add( Stats::ArticleBytes, card.size );
+  Stats::add( Stats::ChunkCacheHits, dz->cacheHits - hits );
+  Stats::add( Stats::ChunkCacheMisses, dz->cacheMisses - misses );
+
+  return data;
+}
+
+int DslDictionary::setFiles( string const & dsl_name, string const & abr_name,
+                             string const & index_name )
+{
+  Stats::Timer timer( Stats::Indexing );
+
+  int atLine = 0;
+
+  if ( !index_name.empty()
+       && DslIndex::load( index_name, dsl_name, abr_name, params, allCards, abrv ) )
+  {
+    if ( openData( dsl_name ) )
+      return -1;
+
+    addIndexingStats( dsl_name, abr_name, allCards );
+    return 0;
+  }
+
+  allCards.clear();
+  abrv.clear();
+
+  // Reused for all the headwords to avoid reallocating its buffers
+  OptionalPartsExpander expander;
+
+  try
+  {
+    if( !abr_name.empty() )
+    {
+      DslScanner abrvScanner( abr_name );
+
+      wstring curString;
+      uint64_t curOffset;
+
+      for( ; ; )
+      {
+        // Skip any whitespace
+        if ( !abrvScanner.readNextLineWithoutComments( curString, curOffset ) )
+          break;
+        if ( curString.empty() || isDslWs( curString[ 0 ] ) )
+          continue;
+
+        list< wstring > keys;
+
+        bool eof = false;
+
+        // Insert the key and read more, or get to the definition
+        for( ; ; )
         {
-          newCard.headwords.clear();
-          newCard.offset = (*i).offset;
-          newCard.size = (*i).size;
+          processUnsortedParts( curString, true );
+
+          if ( keys.size() )
+            expandTildes( curString, keys.front() );
 
-          for( int x = 0; x < (*i).headwords.size(); x++ )
+          expander.expand( curString );
+          expander.appendTo( keys );
+
+          if ( !abrvScanner.readNextLineWithoutComments( curString, curOffset ) || curString.empty() )
           {
-            allEntryWords.clear();
-            expandOptionalParts( (*i).headwords[ x ], &allEntryWords );
-
-            for( list< wstring >::iterator j = allEntryWords.begin();
-                 j != allEntryWords.end(); ++j )
-            {
-              unescapeDsl( *j );
-              normalizeHeadword( *j );
-              newCard.headwords.push_back( *j );
-            }
-
-            allCards.push_back( newCard );
-            wordCount += allEntryWords.size();
+            gdWarning( "Warning: premature end of file %s\n", abr_name.c_str() );
+            eof = true;
+            break;
           }
-          ++articleCount;
+
+          if ( isDslWs( curString[ 0 ] ) )
+            break;
         }
 
-        if ( !hasString )
+        if ( eof )
           break;
+
+        curString.erase( 0, curString.find_first_not_of( GD_NATIVE_TO_WS( L" \t" ) ) );
+
+        if ( keys.size() )
+          expandTildes( curString, keys.front() );
+
+        // If the string has any dsl markup, we strip it
+        string value = ArticleDom( curString ).root.renderAsUtf8();
+
+        for( list< wstring >::iterator i = keys.begin(); i != keys.end();
+             ++i )
+        {
+          unescapeDsl( *i );
+          normalizeHeadword( *i );
+
+          abrv[ Utf8::encode( Folding::trimWhitespace( *i ) ) ] = value;
+        }
       }
+    }
 
-      DZ_ERRORS error;
-      dz = dict_data_open( dsl_name.c_str(), &error, 0 );
-      if( !dz )
-      {
-        printf( "\nInput file opening error: %s\n", dz_error_str( error ) );
+    DslScanner scanner( dsl_name );
+
+    params.name = scanner.getDictionaryName();
+    params.langFrom = scanner.getLangFrom();
+    params.langTo = scanner.getLangTo();
+    params.encoding = scanner.getEncoding();
+    params.langFromRTL = LangCoder::isLanguageRTL( LangCoder::findIdForLanguage( params.langFrom ) );
+    params.langToRTL = LangCoder::isLanguageRTL( LangCoder::findIdForLanguage( params.langTo ) );
+
+
+    try
+    {
+      if ( indexingThreads > 1 && !scanner.isCompressed() )
+        scanInParallel( dsl_name, scanner, indexingThreads, allCards );
+      else
+        scanArticles( scanner, EndOfFile, allCards );
+
+      if ( openData( dsl_name ) )
         return -1;
-      }
 
+      if ( !index_name.empty() )
+        DslIndex::save( index_name, dsl_name, abr_name, params, allCards, abrv );
+
+      addIndexingStats( dsl_name, abr_name, allCards );
       return 0;
     }
     catch( ... )
@@ -357,17 +749,90 @@ void DslDictionary::loadArticle( DslCard const & card,
                                  wstring & tildeValue,
                                  wstring & displayedHeadword,
                                  unsigned & headwordIndex,
-                                 wstring & articleText )
+                                 wstring & articleText,
+                                 char const * rawData )
 {
+  Stats::Timer timer( Stats::Loading );
+
   wstring articleData;
 
   if( !dz )
     return;
 
+  if ( card.bodyOffset )
   {
-    char * articleBody;
+    // The headwords were matched while indexing, only decode the parts needed
+    char * readBody = rawData ? 0 : readData( card );
+    char const * articleBody = rawData ? rawData : readBody;
+
+    if ( !articleBody )
+    {
+      printf( "\nDICTZIP error: %s\n", dict_error_str( dz ) );
+      articleText.clear();
+      return;
+    }
 
-    articleBody = dict_data_read_( dz, card.offset, card.size, 0, 0 );
+    try
+    {
+      decodeArticle( params.encoding, articleBody + card.bodyOffset,
+                     card.size - card.bodyOffset, articleText );
+
+      // Tildes get expanded to the first variant of the first headword,
+      // which the card starts with. Only the headword lines are decoded
+      wstring firstHeadword;
+      decodeArticle( params.encoding, articleBody, card.bodyOffset, firstHeadword );
+      firstHeadword.erase( std::min( firstHeadword.find_first_of( GD_NATIVE_TO_WS( L"\n\r" ) ),
+                                     firstHeadword.size() ) );
+
+      OptionalPartsExpander expander;
+      expander.expand( firstHeadword, false );
+
+      wstring tildeValueWithUnsorted = expander.size() ? expander[ 0 ] : firstHeadword;
+      tildeValue = tildeValueWithUnsorted;
+      processUnsortedParts( tildeValue, false );
+
+      headwordIndex = card.headwordIndex;
+
+      if ( card.headwordSize )
+      {
+        // The first line is the displayed one unless headwordIndex says
+        // otherwise
+        if ( headwordIndex )
+        {
+          decodeArticle( params.encoding, articleBody + card.headwordOffset,
+                         card.headwordSize, displayedHeadword );
+
+          size_t end = displayedHeadword.find_first_of( GD_NATIVE_TO_WS( L"\n\r" ) );
+          if ( end != wstring::npos )
+            displayedHeadword.erase( end );
+
+          expandTildes( displayedHeadword, tildeValueWithUnsorted );
+        }
+        else
+          displayedHeadword = firstHeadword;
+
+        processUnsortedParts( displayedHeadword, false );
+      }
+      else
+        displayedHeadword = tildeValue;
+
+      free( readBody );
+    }
+    catch( ... )
+    {
+      free( readBody );
+      throw;
+    }
+
+    return;
+  }
+
+  if ( ArticleCache::Entry * entry = embeddedCards.find( card.offset, card.size ) )
+    articleData = entry->data;
+  else
+  {
+    char * readBody = rawData ? 0 : readData( card );
+    char const * articleBody = rawData ? rawData : readBody;
 
     if ( !articleBody )
     {
@@ -379,19 +844,15 @@ void DslDictionary::loadArticle( DslCard const & card,
     {
       try
       {
-        articleData =
-          DslIconv::toWstring(
-            DslIconv::getEncodingNameFor( params.encoding ),
-            articleBody, card.size );
-        free( articleBody );
-
-        // Strip DSL comments
-        bool b = false;
-        stripComments( articleData, b );
+        // DSL comments are stripped while decoding
+        decodeArticle( params.encoding, articleBody, card.size, articleData );
+        free( readBody );
+
+        embeddedCards.insert( card.offset, card.size, articleData );
       }
       catch( ... )
       {
-        free( articleBody );
+        free( readBody );
         throw;
       }
     }
@@ -426,7 +887,12 @@ void DslDictionary::loadArticle( DslCard const & card,
         wstring::size_type hpos = rawHeadword.find( L'@' );
         if( hpos != string::npos )
         {
-          wstring head = Folding::trimWhitespace( rawHeadword.substr( hpos + 1 ) );
+          wchar const * headBegin = rawHeadword.data() + hpos + 1;
+          size_t headSize = rawHeadword.size() - hpos - 1;
+
+          Folding::trimWhitespace( headBegin, headSize );
+
+          wstring head( headBegin, headSize );
           hpos = head.find( L'~' );
           while( hpos != string::npos )
           {
@@ -466,7 +932,7 @@ void DslDictionary::loadArticle( DslCard const & card,
 
         processUnsortedParts( str, true );
 
-        str = Folding::applySimpleCaseOnly( str );
+        Folding::applySimpleCaseOnly( str.data(), str.size(), &str[ 0 ] );
 
         list< wstring > lst;
         expandOptionalParts( str, &lst );
@@ -479,7 +945,12 @@ void DslDictionary::loadArticle( DslCard const & card,
           unescapeDsl( *i );
           normalizeHeadword( *i );
 
-          if ( Folding::trimWhitespace( *i ) == requestedHeadwordFolded )
+          wchar const * word = i->data();
+          size_t wordSize = i->size();
+
+          Folding::trimWhitespace( word, wordSize );
+
+          if ( requestedHeadwordFolded.compare( 0, wstring::npos, word, wordSize ) == 0 )
           {
             // Found it. Now we should make a displayed headword for it.
             if ( hadFirstHeadword )
@@ -565,19 +1036,25 @@ string DslDictionary::nodeToHtml( ArticleDom::Node const & node )
 
   if ( !node.isTag )
   {
-    result = Html::escape( Utf8::encode( node.text ) );
+    string const & text = textToUtf8( node.text );
+
+    // Escape the text line by line, stripping all '\r' and replacing all '\n'
+
+    for( string::size_type begin = 0; ; )
+    {
+      string::size_type n = text.find_first_of( "\r\n", begin );
 
-    // Handle all end-of-line
+      Html::escapeAppend( result, text.data() + begin,
+                          ( n == string::npos ? text.size() : n ) - begin );
 
-    string::size_type n;
+      if ( n == string::npos )
+        break;
 
-    // Strip all '\r'
-    while( ( n = result.find( '\r' ) ) != string::npos )
-      result.erase( n, 1 );
+      if ( text[ n ] == '\n' )
+        result += "<p></p>";
 
-    // Replace all '\n'
-    while( ( n = result.find( '\n' ) ) != string::npos )
-      result.replace( n, 1, "<p></p>" );
+      begin = n + 1;
+    }
 
     return result;
   }
@@ -608,8 +1085,14 @@ string DslDictionary::nodeToHtml( ArticleDom::Node const & node )
   else
   if ( node.tagName == GD_NATIVE_TO_WS( L"*" ) )
   {
-      string id = string( "O" ) + "xxxxxxx" + "_" + "0" +
-                "_opt_" + QString::number( optionalPartNom++ ).toStdString();
+      string id = string( "O" ) + "xxxxxxx" + "_" + "0" + "_opt_";
+      if ( optionalPartMarkers )
+      {
+        id.push_back( (char) OptionalPartMarker );
+        ++optionalPartNom;
+      }
+      else
+        id += QString::number( optionalPartNom++ ).toStdString();
     result += "<span class=\"dsl_opt\" id=\"" + id + "\">" + processNodeChildren( node ) + "</span>";
   }
   else
@@ -631,9 +1114,14 @@ string DslDictionary::nodeToHtml( ArticleDom::Node const & node )
   else
   if ( node.tagName == GD_NATIVE_TO_WS( L"s" ) || node.tagName == GD_NATIVE_TO_WS( L"video" ) )
   {
-    string filename = Utf8::encode( node.renderAsText() );
+    string filename = node.renderAsUtf8();
+
+    if ( mediaManifest )
+      mediaManifest->add( filename );
 
-    if ( Filetype::isNameOfSound( filename ) )
+    Filetype::Type type = Filetype::classify( filename );
+
+    if ( type == Filetype::Sound )
     {
       // If we have the file here, do the exact reference to this dictionary.
       // Otherwise, make a global 'search' one.
@@ -651,7 +1139,7 @@ string DslDictionary::nodeToHtml( ArticleDom::Node const & node )
          + "><img src=\"qrcx://localhost/icons/playsound.png\" border=\"0\" align=\"absmiddle\" alt=\"Play\"/></a></span>";
     }
     else
-    if ( Filetype::isNameOfPicture( filename ) )
+    if ( Filetype::isPicture( type ) )
     {
       QUrl url;
       url.setScheme( "bres" );
@@ -662,7 +1150,7 @@ string DslDictionary::nodeToHtml( ArticleDom::Node const & node )
                 + "\" alt=\"" + Html::escape( filename ) + "\"/>";
     }
     else
-    if ( Filetype::isNameOfVideo( filename ) ) {
+    if ( type == Filetype::Video ) {
       QUrl url;
       url.setScheme( "gdvideo" );
       url.setHost( QString::fromUtf8( getId().c_str() ) );
@@ -688,7 +1176,7 @@ string DslDictionary::nodeToHtml( ArticleDom::Node const & node )
   else
   if ( node.tagName == GD_NATIVE_TO_WS( L"url" ) )
   {
-    string link = Html::escape( Utf8::encode( node.renderAsText() ) );
+    string link = Html::escape( node.renderAsUtf8() );
     if( QUrl::fromEncoded( link.c_str() ).scheme().isEmpty() )
       link = "http://" + link;
 
@@ -720,7 +1208,7 @@ string DslDictionary::nodeToHtml( ArticleDom::Node const & node )
   {
     result += "<span class=\"dsl_p\"";
 
-    string val = Utf8::encode( node.renderAsText() );
+    string val = node.renderAsUtf8();
 
     // If we have such a key, display a title
     map< string, string >::const_iterator i = abrv.find( val );
@@ -777,33 +1265,7 @@ string DslDictionary::nodeToHtml( ArticleDom::Node const & node )
   {
     result += "<span class=\"dsl_lang\"";
     if( !node.tagAttrs.empty() )
-    {
-      // Find ISO 639-1 code
-      string langcode;
-      QString attr = gd::toQString( node.tagAttrs );
-      int n = attr.indexOf( "id=" );
-      if( n >= 0 )
-      {
-        int id = attr.mid( n + 3 ).toInt();
-        if( id )
-          langcode = findCodeForDslId( id );
-      }
-      else
-      {
-        n = attr.indexOf( "name=\"" );
-        if( n >= 0 )
-        {
-          int n2 = attr.indexOf( '\"', n + 6 );
-          if( n2 > 0 )
-          {
-            quint32 id = dslLanguageToId( gd::toWString( attr.mid( n + 6, n2 - n - 6 ) ) );
-            langcode = LangCoder::intToCode2( id ).toStdString();
-          }
-        }
-      }
-      if( !langcode.empty() )
-        result += " lang=\"" + langcode + "\"";
-    }
+      result += langAttribute( node.tagAttrs );
     result += ">" + processNodeChildren( node ) + "</span>";
   }
   else
@@ -871,6 +1333,45 @@ string DslDictionary::nodeToHtml( ArticleDom::Node const & node )
   return result;
 }
 
+string const & DslDictionary::langAttribute( wstring const & attrs )
+{
+  map< wstring, string >::const_iterator i = langAttributes.find( attrs );
+
+  if ( i != langAttributes.end() )
+    return i->second;
+
+  // Find ISO 639-1 code
+  string langcode;
+  QString attr = gd::toQString( attrs );
+  int n = attr.indexOf( "id=" );
+  if( n >= 0 )
+  {
+    int id = attr.mid( n + 3 ).toInt();
+    if( id )
+      langcode = findCodeForDslId( id );
+  }
+  else
+  {
+    n = attr.indexOf( "name=\"" );
+    if( n >= 0 )
+    {
+      int n2 = attr.indexOf( '\"', n + 6 );
+      if( n2 > 0 )
+      {
+        quint32 id = dslLanguageToId( gd::toWString( attr.mid( n + 6, n2 - n - 6 ) ) );
+        langcode = LangCoder::intToCode2( id ).toStdString();
+      }
+    }
+  }
+
+  string & fragment = langAttributes[ attrs ];
+
+  if( !langcode.empty() )
+    fragment = " lang=\"" + langcode + "\"";
+
+  return fragment;
+}
+
 string DslDictionary::processNodeChildren(ArticleDom::Node const & node )
 {
   string result;
@@ -887,17 +1388,129 @@ string DslDictionary::dslToHtml( wstring const & str, wstring const & headword )
  // Normalize the string
   wstring normalizedStr = gd::normalize( str );
 
+  Stats::Timer parsing( Stats::Parsing );
+
   ArticleDom dom( normalizedStr, string(), headword );
 
+  parsing.stop();
+
+  Stats::Timer rendering( Stats::Rendering );
+
   string html = processNodeChildren( dom.root );
 
   return html;
 }
 
+string DslDictionary::embeddedBodyToHtml( DslCard const & card, wstring const & str,
+                                          wstring const & headword )
+{
+  // loadArticle() has just put the card into the cache. The lookup is not
+  // counted, the hit was counted there already
+  ArticleCache::Entry * entry = embeddedCards.peek( card.offset, card.size );
+
+  if ( !entry )
+    return dslToHtml( str, headword );
+
+  if ( !entry->bodyDom )
+  {
+    Stats::Timer timer( Stats::Parsing );
+    entry->bodyDom = std::make_shared< ArticleDom >( gd::normalize( str ), string(), headword );
+  }
+
+  Stats::Timer timer( Stats::Rendering );
+
+  return processNodeChildren( entry->bodyDom->root );
+}
+
+void DslDictionary::setRenderCache( RenderCache * cache )
+{
+  renderCache = cache;
+
+  // The abbreviations affect the rendering of every article
+  RenderCache::Hasher hasher;
+
+  for( map< string, string >::const_iterator i = abrv.begin(); i != abrv.end(); ++i )
+    hasher.add( i->first ).add( i->second );
+
+  abrvKey = hasher.result();
+}
+
+RenderCache::Key DslDictionary::makeRenderKey( DslCard const & card,
+                                               char const * rawData )
+{
+  RenderCache::Hasher hasher;
+
+  hasher.add( RendererVersion ).add( params.encoding )
+        .add( params.langFromRTL ).add( params.langToRTL )
+        .add( &abrvKey, sizeof( abrvKey ) )
+        .add( Utf8::encode( card.headwords.at( 0 ) ) )
+        .add( rawData, card.size );
+
+  return hasher.result();
+}
+
 int DslDictionary::getArticle( DslCard const & card, string & article )
 {
-  wstring word = card.headwords.at( 0 );
-  wstring wordCaseFolded = Folding::applySimpleCaseOnly( word );
+  if ( !renderCache )
+    return renderArticle( card, article );
+
+  // The data is read once, for the key and then for the rendering
+  char * rawData = readData( card );
+
+  if ( !rawData )
+    return renderArticle( card, article );
+
+  int result;
+
+  try
+  {
+    result = getCachedArticle( card, rawData, article );
+  }
+  catch( ... )
+  {
+    free( rawData );
+    throw;
+  }
+
+  free( rawData );
+
+  return result;
+}
+
+int DslDictionary::getCachedArticle( DslCard const & card, char const * rawData,
+                                     string & article )
+{
+  RenderCache::Key key = makeRenderKey( card, rawData );
+
+  if ( renderCache->get( key, article ) )
+    return 0;
+
+  int firstOptionalPart = optionalPartNom;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  int result = renderArticle( card, article, rawData );
+
+  double seconds = std::chrono::duration< double >( std::chrono::steady_clock::now()
+                                                    - start ).count();
+
+  // The ids of the optional parts are numbered through all the articles, so
+  // the ones having them can't be reused
+  if ( result == 0 && optionalPartNom == firstOptionalPart )
+    renderCache->put( key, article, seconds );
+  else
+    renderCache->skip();
+
+  return result;
+}
+
+int DslDictionary::renderArticle( DslCard const & card, string & article,
+                                  char const * rawData )
+{
+  wstring const & word = card.headwords.at( 0 );
+
+  foldedHeadword.resize( word.size() );
+  Folding::applySimpleCaseOnly( word.data(), word.size(), &foldedHeadword[ 0 ] );
 
   // Grab that article
 
@@ -910,8 +1523,8 @@ int DslDictionary::getArticle( DslCard const & card, string & article )
 
   try
   {
-    loadArticle( card, wordCaseFolded, tildeValue,
-                 displayedHeadword, headwordIndex, articleBody );
+    loadArticle( card, foldedHeadword, tildeValue,
+                 displayedHeadword, headwordIndex, articleBody, rawData );
 
     if( displayedHeadword.empty() || isDslWs( displayedHeadword[ 0 ] ) )
       displayedHeadword = word; // Special case - insided card
@@ -941,7 +1554,10 @@ int DslDictionary::getArticle( DslCard const & card, string & article )
 
     int optionalPartNom = 0;
 
-    articleAfter += dslToHtml( articleBody, displayedHeadword );
+    if ( card.bodyOffset )
+      articleAfter += dslToHtml( articleBody, displayedHeadword );
+    else
+      articleAfter += embeddedBodyToHtml( card, articleBody, displayedHeadword );
     articleAfter += "</div>";
     articleAfter += "</div>";
 
@@ -966,6 +1582,8 @@ int DslDictionary::getArticle( DslCard const & card, string & article )
     articleText = string( "<span class=\"dsl_article\">" )
                   + string( "Article loading error" )
                   + "</span>";
+    article = articleText;
+    return -1;
   }
 
   article = articleText;
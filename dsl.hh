@@ -4,11 +4,15 @@
 #include <stdint.h>
 #include <string>
 #include <map>
+#include <vector>
+#include <memory>
 #include <QVector>
 
 #include "wstring.hh"
 #include "dsl_details.hh"
 #include "dictzip.h"
+#include "rendercache.hh"
+#include "mediamanifest.hh"
 
 using gd::wstring;
 using std::string;
@@ -18,10 +22,10 @@ using namespace Dsl::Details;
 
 struct InsidedCard
 {
-  uint32_t offset;
+  uint64_t offset;
   uint32_t size;
   QVector< wstring > headwords;
-  InsidedCard( uint32_t _offset, uint32_t _size, QVector< wstring > const & words ) :
+  InsidedCard( uint64_t _offset, uint32_t _size, QVector< wstring > const & words ) :
   offset( _offset ), size( _size ), headwords( words )
   {}
   InsidedCard( InsidedCard const & e ) :
@@ -31,19 +35,89 @@ struct InsidedCard
 
 };
 
+/// Only the card's own offset in the file is 64-bit. Articles don't grow
+/// that large, so its size and the positions inside it are kept as 32-bit
+/// deltas from that offset, to keep the card table small.
 struct DslCard
 {
-  uint32_t offset;
-  uint32_t size;
+  uint64_t offset;
   QVector< wstring > headwords;
+  uint32_t size;
 
-  DslCard( uint32_t _offset, uint32_t _size, QVector< wstring > const & words ) :
-  offset( _offset ), size( _size ), headwords( words )
+  // Those are found by the indexer, so loadArticle() doesn't have to scan the
+  // headwords again. The offsets are relative to the card's offset, whose
+  // line is the first headword, giving the tilde value. A zero bodyOffset
+  // means they are unknown (as for the embedded cards).
+  uint32_t headwordOffset; // The headword line to display the article by
+  uint32_t headwordSize; // 0 if none of the lines matched
+  uint32_t headwordIndex; // Number of that line among the headword lines
+  uint32_t bodyOffset; // The first line of the article's body
+
+  DslCard( uint64_t _offset, uint32_t _size, QVector< wstring > const & words ) :
+  offset( _offset ), headwords( words ), size( _size ),
+  headwordOffset( 0 ), headwordSize( 0 ), headwordIndex( 0 ), bodyOffset( 0 )
   {}
   DslCard( DslCard const & e ) :
-  offset( e.offset ), size( e.size ), headwords( e.headwords )
+  offset( e.offset ), headwords( e.headwords ), size( e.size ), headwordOffset( e.headwordOffset ),
+  headwordSize( e.headwordSize ), headwordIndex( e.headwordIndex ),
+  bodyOffset( e.bodyOffset )
+  {}
+  DslCard():
+  headwordOffset( 0 ), headwordSize( 0 ), headwordIndex( 0 ), bodyOffset( 0 )
+  {}
+};
+
+/// Keeps the few embedded (@) cards decoded last. Every headword variant of
+/// an embedded card becomes a card of its own sharing the same byte range,
+/// and those follow each other, so the range gets read, decoded and parsed
+/// only once.
+class ArticleCache
+{
+public:
+
+  struct Entry
+  {
+    uint64_t offset;
+    uint32_t size;
+    wstring data; // Decoded article, without comments
+    std::shared_ptr< ArticleDom > bodyDom; // Parsed body, if it was requested
+  };
+
+  enum
+  {
+    Capacity = 4
+  };
+
+  ArticleCache(): next( 0 ), lookups( 0 ), hits( 0 ), bytesSaved( 0 )
   {}
-  DslCard() {}
+
+  /// Returns the entry for the given range, or 0 if there's none. The saved
+  /// bytes are counted on each hit.
+  Entry * find( uint64_t offset, uint32_t size );
+
+  /// Same as find(), but doesn't count anything.
+  Entry * peek( uint64_t offset, uint32_t size );
+
+  /// Adds the entry for the given range, evicting the oldest one if needed.
+  Entry & insert( uint64_t offset, uint32_t size, wstring const & data );
+
+  unsigned getLookups() const
+  { return lookups; }
+
+  unsigned getHits() const
+  { return hits; }
+
+  /// Total size of the article data which didn't have to be read and
+  /// decoded again.
+  uint64_t getBytesSaved() const
+  { return bytesSaved; }
+
+private:
+
+  std::vector< Entry > entries;
+  size_t next; // The entry to be replaced next
+  unsigned lookups, hits;
+  uint64_t bytesSaved;
 };
 
 struct DictParameters
@@ -63,12 +137,38 @@ class DslDictionary
   DictParameters params;
   map< string, string > abrv;
   dictData * dz;
+  ArticleCache embeddedCards;
+  RenderCache * renderCache;
+  MediaManifest * mediaManifest;
+  RenderCache::Key abrvKey;
+  unsigned indexingThreads;
+  bool optionalPartMarkers;
+  wstring foldedHeadword; // Reused by renderArticle()
+  map< wstring, string > langAttributes; // See langAttribute()
 
 public:
 
+  /// Bump this each time the html produced for the same article changes, so
+  /// the render caches made by the previous versions don't get used.
+  enum
+  {
+    RendererVersion = 1
+  };
+
+  /// Stands for the numbers of the optional parts' ids when the markers are
+  /// on. It's a byte which can't occur in UTF-8.
+  enum
+  {
+    OptionalPartMarker = 0xFF
+  };
+
   DslDictionary() :
     optionalPartNom( 0 ),
-    dz( 0 )
+    dz( 0 ),
+    renderCache( 0 ),
+    mediaManifest( 0 ),
+    indexingThreads( 1 ),
+    optionalPartMarkers( false )
   {};
 
   ~DslDictionary();
@@ -81,26 +181,88 @@ public:
   DictParameters const & getParams() const
   { return params; }
 
-  int setFiles( string const & dsl_name, string const & abr_name );
+  /// Reads the dictionary's headers and builds the card table. If the index
+  /// file name is given, the table is loaded from there when it's up to date,
+  /// and saved there otherwise.
+  int setFiles( string const & dsl_name, string const & abr_name,
+                string const & index_name = string() );
 
+  /// Renders the article. Returns 0 on success. The error message is put
+  /// into the article on failure.
   int getArticle( DslCard const & card, string & article );
 
+  /// Sets the number of threads setFiles() may use to index the uncompressed
+  /// files. The default is 1.
+  void setIndexingThreads( unsigned threads )
+  { indexingThreads = threads ? threads : 1; }
+
+  /// Makes the optional parts' ids have the OptionalPartMarker in place of
+  /// their numbers. The numbers run through all the articles, so the parts of
+  /// the output converted separately get numbered when they are put together.
+  void setOptionalPartMarkers( bool markers )
+  { optionalPartMarkers = markers; }
+
+  /// Makes getArticle() use the given cache. Must be called after setFiles(),
+  /// since the abbreviations are a part of the cache keys.
+  void setRenderCache( RenderCache * );
+
+  /// Makes the rendering add the media files of the [s] tags to the given
+  /// manifest. The articles taken from the render cache aren't rendered, so
+  /// the two shouldn't be used together.
+  void setMediaManifest( MediaManifest * manifest )
+  { mediaManifest = manifest; }
+
   QString getDescription( string const & dsl_name );
 
+  ArticleCache const & getEmbeddedCardsCache() const
+  { return embeddedCards; }
+
 protected:
 
+  /// Opens the dictionary's data for reading the articles.
+  int openData( string const & dsl_name );
+
+  /// The card's raw data may be given if it was read already, otherwise it
+  /// is read here.
+  int renderArticle( DslCard const & card, string & article,
+                     char const * rawData = 0 );
+
+  /// Reads the card's raw data with dict_data_read_(), counting it for the
+  /// stats. The result is to be freed.
+  char * readData( DslCard const & card );
+
+  /// Makes the render cache key for the card out of its raw data and all the
+  /// settings the rendering depends on.
+  RenderCache::Key makeRenderKey( DslCard const & card, char const * rawData );
+
+  /// Takes the article from the render cache, or renders it from the given
+  /// raw data and puts it there.
+  int getCachedArticle( DslCard const & card, char const * rawData, string & article );
+
+  /// Same as renderArticle() about the raw data.
   void loadArticle( DslCard const & card,
                     wstring const & requestedHeadwordFolded,
                     wstring & tildeValue,
                     wstring & displayedHeadword,
                     unsigned & headwordIndex,
-                    wstring & articleText );
+                    wstring & articleText,
+                    char const * rawData = 0 );
 
   string dslToHtml( wstring const & str, wstring const & headword );
 
+  /// Same as dslToHtml(), but parses the given embedded card's body only once.
+  string embeddedBodyToHtml( DslCard const & card, wstring const & str,
+                             wstring const & headword );
+
   string processNodeChildren( ArticleDom::Node const & node );
 
   string nodeToHtml( ArticleDom::Node const & node );
+
+  /// Returns the html attribute for the given attributes of a [lang] tag,
+  /// i.e. ` lang="xx"`, or nothing if the language is unknown. The results
+  /// are kept, since the same few attributes are usually found all over the
+  /// dictionary.
+  string const & langAttribute( wstring const & attrs );
 };
 
 
@@ -5,8 +5,11 @@
 
 #include "wstring_qt.hh"
 #include <stdio.h>
+#include <string.h>
 #include <wctype.h>
 #include <zlib.h>
+#include <algorithm>
+#include <limits>
 #include "folding.hh"
 #include "gddebug.hh"
 #include "ufile.hh"
@@ -40,7 +43,7 @@ int wcscasecmp( const wchar *s1, const wchar *s2 )
 
 #endif
 
-static DSLLangCode LangCodes[] =
+static DSLLangCode const LangCodes[] =
 {
   { 1, "en" },
   { 1033, "en" },
@@ -126,17 +129,43 @@ static DSLLangCode LangCodes[] =
   { 0, "" },
 };
 
-string findCodeForDslId( int id )
+namespace {
+
+/// Maps the DSL language ids to their LangCodes entries, counting from one,
+/// so the codes are found with a single lookup. Zero stands for none.
+struct DslIdIndex
 {
-  for( DSLLangCode const * lc = LangCodes; lc->code_id; ++lc )
+  vector< unsigned char > entries;
+
+  static_assert( sizeof( LangCodes ) / sizeof( *LangCodes ) <= 255,
+                 "The LangCodes entries don't fit in the index" );
+
+  DslIdIndex()
   {
-    if ( id == lc->code_id )
-    {
-      // We've got a match
-      return string( lc->code );
-    }
+    int maxId = 0;
+
+    for( DSLLangCode const * lc = LangCodes; lc->code_id; ++lc )
+      maxId = std::max( maxId, lc->code_id );
+
+    entries.resize( maxId + 1 );
+
+    // The first entry wins, as it did when the table was searched in order
+    for( DSLLangCode const * lc = LangCodes; lc->code_id; ++lc )
+      if ( !entries[ lc->code_id ] )
+        entries[ lc->code_id ] = lc - LangCodes + 1;
   }
-  return string();
+};
+
+}
+
+string findCodeForDslId( int id )
+{
+  static DslIdIndex const index;
+
+  if ( id <= 0 || (size_t) id >= index.entries.size() || !index.entries[ id ] )
+    return string();
+
+  return string( LangCodes[ index.entries[ id ] - 1 ].code );
 }
 
 bool isAtSignFirst( wstring const & str )
@@ -151,7 +180,7 @@ bool isAtSignFirst( wstring const & str )
 wstring ArticleDom::Node::renderAsText( bool stripTrsTag ) const
 {
   if ( !isTag )
-    return text;
+    return textToWide( text );
 
   wstring result;
 
@@ -162,6 +191,20 @@ wstring ArticleDom::Node::renderAsText( bool stripTrsTag ) const
   return result;
 }
 
+string ArticleDom::Node::renderAsUtf8( bool stripTrsTag ) const
+{
+  if ( !isTag )
+    return textToUtf8( text );
+
+  string result;
+
+  for( list< Node >::const_iterator i = begin(); i != end(); ++i )
+    if( !stripTrsTag || i->tagName != GD_NATIVE_TO_WS( L"!trs" ) )
+      result += i->renderAsUtf8( stripTrsTag );
+
+  return result;
+}
+
 // Returns true if src == 'm' and dest is 'mX', where X is a digit
 static inline bool checkM( wstring const & dest, wstring const & src )
 {
@@ -223,7 +266,7 @@ ArticleDom::ArticleDom( wstring const & str, string const & dictName,
             {
               if ( !textNode )
               {
-                Node text = Node( Node::Text(), wstring() );
+                Node text = Node( Node::Text() );
 
                 if ( stack.empty() )
                 {
@@ -238,8 +281,8 @@ ArticleDom::ArticleDom( wstring const & str, string const & dictName,
 
                 textNode = stack.back();
               }
-              textNode->text.push_back( L'-' );
-              textNode->text.push_back( L' ' );
+              appendToText( textNode->text, L'-' );
+              appendToText( textNode->text, L' ' );
 
               // Close the currently opened text node
               stack.pop_back();
@@ -495,7 +538,7 @@ ArticleDom::ArticleDom( wstring const & str, string const & dictName,
       // If there's currently no text node, open one
       if ( !textNode )
       {
-        Node text = Node( Node::Text(), wstring() );
+        Node text = Node( Node::Text() );
 
         if ( stack.empty() )
         {
@@ -552,17 +595,17 @@ ArticleDom::ArticleDom( wstring const & str, string const & dictName,
           case 0x2018: ch = 0x251; break;
           case 0x457: ch = 0x265; break;
           case 0x458: ch = 0x153; break;
-          case 0x405: textNode->text.push_back( 0x153 ); ch = 0x303; break;
+          case 0x405: appendToText( textNode->text, 0x153 ); ch = 0x303; break;
           case 0x441: ch = 0x272; break;
-          case 0x442: textNode->text.push_back( 0x254 ); ch = 0x303; break;
+          case 0x442: appendToText( textNode->text, 0x254 ); ch = 0x303; break;
           case 0x443: ch = 0xF8; break;
-          case 0x445: textNode->text.push_back(0x25B ); ch = 0x303; break;
+          case 0x445: appendToText( textNode->text, 0x25B ); ch = 0x303; break;
           case 0x446: ch = 0xE7; break;
-          case 0x44C: textNode->text.push_back( 0x251 ); ch = 0x303; break;
+          case 0x44C: appendToText( textNode->text, 0x251 ); ch = 0x303; break;
           case 0x44D: ch = 0x26A; break;
           case 0x44F: ch = 0x252; break;
           case 0x30: ch = 0x3B2; break;
-          case 0x31: textNode->text.push_back( 0x65 ); ch = 0x303; break;
+          case 0x31: appendToText( textNode->text, 0x65 ); ch = 0x303; break;
           case 0x32: ch = 0x25C; break;
           case 0x33: ch = 0x129; break;
           case 0x34: ch = 0xF5; break;
@@ -576,22 +619,22 @@ ArticleDom::ArticleDom( wstring const & str, string const & dictName,
 
           case 0x00a0: ch = 0x02A7; break;
           //case 0x00b1: ch = 0x0261; break;
-          case 0x0402: textNode->text.push_back( 0x0069 ); ch = L':'; break;
-          case 0x0403: textNode->text.push_back( 0x0251 ); ch = L':'; break;
+          case 0x0402: appendToText( textNode->text, 0x0069 ); ch = L':'; break;
+          case 0x0403: appendToText( textNode->text, 0x0251 ); ch = L':'; break;
           //case 0x040b: ch = 0x03b8; break;
           //case 0x040e: ch = 0x026a; break;
           case 0x0428: ch = 0x0061; break;
-          case 0x0453: textNode->text.push_back( 0x0075 ); ch = L':'; break;
+          case 0x0453: appendToText( textNode->text, 0x0075 ); ch = L':'; break;
           case 0x201a: ch = 0x0254; break;
           case 0x201e: ch = 0x0259; break;
-          case 0x2039: textNode->text.push_back( 0x0064 ); ch = 0x0292; break;
+          case 0x2039: appendToText( textNode->text, 0x0064 ); ch = 0x0292; break;
         }
       }
 
       if ( escaped && ch == L' ' )
         ch = 0xA0; // Escaped spaces turn into non-breakable ones in Lingvo
 
-      textNode->text.push_back( ch );
+      appendToText( textNode->text, ch );
     } // for( ; ; )
   }
   catch( eot )
@@ -800,8 +843,244 @@ bool ArticleDom::atSignFirstInLine()
 
 /////////////// DslScanner
 
+namespace {
+
+/// The chars of a single-byte code page, made once by iconv
+struct SingleByteTable
+{
+  enum { Undefined = 0xFFFF }; // No code page has that
+
+  wchar chars[ 256 ];
+
+  explicit SingleByteTable( DslEncoding );
+};
+
+SingleByteTable::SingleByteTable( DslEncoding encoding )
+{
+  DslIconv iconv( encoding );
+
+  for( unsigned x = 0; x < 256; ++x )
+  {
+    char byte = (char) x;
+
+    void const * inPtr = &byte;
+    size_t inLeft = 1;
+    void * outPtr = chars + x;
+    size_t outLeft = sizeof( wchar );
+
+    try
+    {
+      if ( iconv.convert( inPtr, inLeft, outPtr, outLeft ) != Iconv::Success || outLeft )
+        chars[ x ] = Undefined;
+    }
+    catch( Iconv::exIncorrectSeq & )
+    {
+      chars[ x ] = Undefined;
+    }
+  }
+}
+
+/// Finds the line breaks in the file's bytes and decodes them, for the
+/// scanner's readLineIn() and seekToLineIn(). Each encoding has its own, so
+/// none of that is done a char at a time through iconv. findLineBreak()
+/// returns the start of the first line break in the given bytes, or 0 if
+/// there is none. decode() decodes the complete chars in [in, end), leaving
+/// 'in' at the incomplete one cut by the end, if any, and returns the new
+/// end of the output. It stores at most one char per Unit bytes.
+///
+/// This one is for the single-byte code pages.
+template< DslEncoding encoding >
+struct DslDecoder
+{
+  enum { Unit = 1 };
+
+  static char const * findLineBreak( char const * begin, char const * end )
+  { return (char const *) memchr( begin, '\n', end - begin ); }
+
+  static wchar * decode( char const * & in, char const * end, wchar * out )
+    throw( Iconv::Ex )
+  {
+    static SingleByteTable const table( encoding );
+
+    for( ; in != end; ++in )
+    {
+      wchar ch = table.chars[ (unsigned char) *in ];
+
+      if ( ch == SingleByteTable::Undefined )
+        throw Iconv::exIncorrectSeq();
+
+      *out++ = ch;
+    }
+
+    return out;
+  }
+};
+
+template<>
+struct DslDecoder< Utf8 >
+{
+  enum { Unit = 1 };
+
+  // No byte of a multibyte sequence is ever '\n'
+  static char const * findLineBreak( char const * begin, char const * end )
+  { return (char const *) memchr( begin, '\n', end - begin ); }
+
+  static wchar * decode( char const * & in, char const * end, wchar * out )
+    throw( Iconv::Ex )
+  {
+    // Leave out the last sequence if it's cut. Its lead byte is found by
+    // going back over at most three continuation bytes
+    char const * complete = end;
+
+    for( int x = 0; x < 3 && complete != in && ( complete[ -1 ] & 0xC0 ) == 0x80; ++x )
+      --complete;
+
+    if ( complete != in )
+    {
+      unsigned char lead = complete[ -1 ];
+
+      size_t length = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+
+      if ( (size_t)( end - complete ) + 1 < length )
+        end = complete - 1;
+    }
+
+    long result = ::Utf8::decode( in, end - in, out );
+
+    if ( result < 0 )
+      throw Iconv::exIncorrectSeq();
+
+    in = end;
+
+    return out + result;
+  }
+};
+
+template< bool bigEndian >
+struct Utf16Decoder
+{
+  enum { Unit = 2 };
+
+  static unsigned unitAt( char const * p )
+  {
+    unsigned char const * bytes = (unsigned char const *) p;
+
+    return bigEndian ? ( bytes[ 0 ] << 8 ) | bytes[ 1 ] : bytes[ 0 ] | ( bytes[ 1 ] << 8 );
+  }
+
+  static char const * findLineBreak( char const * begin, char const * end )
+  {
+    size_t const low = bigEndian; // The byte of the unit which holds '\n'
+
+    end = begin + ( end - begin ) / 2 * 2;
+
+    for( char const * p = begin + low; p < end; ++p )
+    {
+      p = (char const *) memchr( p, '\n', end - p );
+
+      if ( !p )
+        break;
+
+      if ( (size_t)( ( p - begin ) & 1 ) == low && !p[ low ? -1 : 1 ] )
+        return p - low;
+    }
+
+    return 0;
+  }
+
+  static wchar * decode( char const * & in, char const * end, wchar * out )
+    throw( Iconv::Ex )
+  {
+    for( ; end - in >= 2; in += 2 )
+    {
+      unsigned ch = unitAt( in );
+
+      if ( ch - 0xD800 < 0x800 )
+      {
+        // A surrogate pair
+        if ( ch >= 0xDC00 )
+          throw Iconv::exIncorrectSeq();
+
+        if ( end - in < 4 )
+          break;
+
+        unsigned low = unitAt( in + 2 );
+
+        if ( low - 0xDC00 >= 0x400 )
+          throw Iconv::exIncorrectSeq();
+
+        ch = 0x10000 + ( ( ch - 0xD800 ) << 10 ) + ( low - 0xDC00 );
+        in += 2;
+      }
+
+      *out++ = ch;
+    }
+
+    return out;
+  }
+};
+
+template<>
+struct DslDecoder< Utf16LE >: public Utf16Decoder< false >
+{};
+
+template<>
+struct DslDecoder< Utf16BE >: public Utf16Decoder< true >
+{};
+
+}
+
+namespace {
+
+// gzseek() and gztell() take and return a long, which is only 32 bits on
+// Windows. The 64-bit versions are used where zlib declares them; on Linux
+// _FILE_OFFSET_BITS=64 makes the plain ones 64-bit already. If neither is
+// the case, the positions past 2 GB can't be told and are reported as such
+#ifdef Z_LARGE64
+
+typedef z_off64_t GzOffset;
+
+GzOffset gzSeekTo( gzFile f, uint64_t offset )
+{ return gzseek64( f, offset, SEEK_SET ); }
+
+GzOffset gzTell( gzFile f )
+{ return gztell64( f ); }
+
+#else
+
+typedef z_off_t GzOffset;
+
+GzOffset gzSeekTo( gzFile f, uint64_t offset )
+{ return gzseek( f, offset, SEEK_SET ); }
+
+GzOffset gzTell( gzFile f )
+{ return gztell( f ); }
+
+#endif
+
+uint64_t const MaxGzOffset = std::numeric_limits< GzOffset >::max();
+
+/// Seeks to the given offset, rewinding the uncompressed files first. Without
+/// the rewind ZLib 1.2.7 gzread() returns 0 after gzseek() on them. The
+/// rewind makes zlib look for the gzip header again, though, and until it
+/// reads something gzseek() skips forward by reading the whole file up to
+/// the offset. Reading a byte puts it back into copying the file, where
+/// gzseek() just seeks it.
+GzOffset gzRewindAndSeek( gzFile f, uint64_t offset )
+{
+  if( gzdirect( f ) )
+  {
+    gzrewind( f );
+    gzgetc( f );
+  }
+
+  return gzSeekTo( f, offset );
+}
+
+}
+
 DslScanner::DslScanner( string const & fileName ) throw( Ex, Iconv::Ex ):
-  encoding( Windows1252 ), iconv( encoding ), readBufferPtr( readBuffer ),
+  encoding( Windows1252 ), readBufferPtr( readBuffer ),
   readBufferLeft( 0 ), wcharBuffer( 64 ), linesRead( 0 )
 {
   // Since .dz is backwards-compatible with .gz, we use gz- functions to
@@ -868,12 +1147,12 @@ DslScanner::DslScanner( string const & fileName ) throw( Ex, Iconv::Ex ):
     }
   }
 
-  iconv.reinit( encoding );
+  selectReader();
 
   // We now can use our own readNextLine() function
 
   wstring str;
-  size_t offset;
+  uint64_t offset;
 
   for( ; ; )
   {
@@ -951,14 +1230,12 @@ DslScanner::DslScanner( string const & fileName ) throw( Ex, Iconv::Ex ):
   // We need to rewind to that line so readNextLine() would return it again
   // next time it's called. To do that, we just use the slow gzseek() and
   // empty the read buffer.
-  if( gzdirect( f ) )                    // Without this ZLib 1.2.7 gzread() return 0
-    gzrewind( f );                       // after gzseek() call on uncompressed files
-  gzseek( f, offset, SEEK_SET );
+  gzRewindAndSeek( f, offset );
   readBufferPtr = readBuffer;
   readBufferLeft = 0;
 
   if ( needExactEncoding )
-    iconv.reinit( encoding );
+    selectReader();
 }
 
 DslScanner::~DslScanner() throw()
@@ -966,138 +1243,232 @@ DslScanner::~DslScanner() throw()
   gzclose( f );
 }
 
-bool DslScanner::readNextLine( wstring & out, size_t & offset ) throw( Ex,
-                                                                       Iconv::Ex )
+void DslScanner::selectReader()
 {
-  offset = (size_t)( gztell( f ) - readBufferLeft );
+  switch( encoding )
+  {
+    case Utf16LE:
+      readLineFunction = &DslScanner::readLineIn< Utf16LE >;
+      seekToLineFunction = &DslScanner::seekToLineIn< Utf16LE >;
+      break;
+    case Utf16BE:
+      readLineFunction = &DslScanner::readLineIn< Utf16BE >;
+      seekToLineFunction = &DslScanner::seekToLineIn< Utf16BE >;
+      break;
+    case Windows1252:
+      readLineFunction = &DslScanner::readLineIn< Windows1252 >;
+      seekToLineFunction = &DslScanner::seekToLineIn< Windows1252 >;
+      break;
+    case Windows1251:
+      readLineFunction = &DslScanner::readLineIn< Windows1251 >;
+      seekToLineFunction = &DslScanner::seekToLineIn< Windows1251 >;
+      break;
+    case Utf8:
+      readLineFunction = &DslScanner::readLineIn< Utf8 >;
+      seekToLineFunction = &DslScanner::seekToLineIn< Utf8 >;
+      break;
+    case Windows1250:
+    default:
+      readLineFunction = &DslScanner::readLineIn< Windows1250 >;
+      seekToLineFunction = &DslScanner::seekToLineIn< Windows1250 >;
+  }
+}
 
-  // For now we just read one char at a time
-  size_t readMultiple = distanceToBytes( 1 );
+bool DslScanner::seekToLine( uint64_t offset ) throw( Ex )
+{
+  return ( this->*seekToLineFunction )( offset );
+}
+
+template< DslEncoding Encoding >
+bool DslScanner::seekToLineIn( uint64_t offset ) throw( Ex )
+{
+  typedef DslDecoder< Encoding > Decoder;
+
+  size_t const unit = Decoder::Unit;
+
+  // UTF-16 text always starts at an even offset, with or without the BOM.
+  // We look for a line break ending right before the offset or after it
+  offset -= offset % unit;
 
-  size_t leftInOut = wcharBuffer.size();
+  uint64_t pos = offset >= unit ? offset - unit : 0;
+
+  if ( pos > MaxGzOffset )
+    throw exDslFileTooLarge();
+
+  if ( gzRewindAndSeek( f, pos ) < 0 )
+    throw exCantReadDslFile();
+
+  readBufferPtr = readBuffer;
+  readBufferLeft = 0;
+  linesRead = 0;
+  commentFilter.reset();
 
-  wchar * outPtr = &wcharBuffer.front();
+  if ( !pos )
+    return true;
 
   for( ; ; )
   {
-    // Check that we have bytes to read
-    if ( readBufferLeft < 4 ) // To convert one char, we need at most 4 bytes
-    {
-      if ( !gzeof( f ) )
-      {
-        // To avoid having to deal with ring logic, we move the remaining bytes
-        // to the beginning
-        memmove( readBuffer, readBufferPtr, readBufferLeft );
+    // The buffer's size is even, so the chars never get split between reads
+    int result = gzread( f, readBuffer, sizeof( readBuffer ) );
 
-        // Read some more bytes to readBuffer
-        int result = gzread( f, readBuffer + readBufferLeft,
-                             sizeof( readBuffer ) - readBufferLeft );
+    if ( result == -1 )
+      throw exCantReadDslFile();
 
-        if ( result == -1 )
-          throw exCantReadDslFile();
+    if ( result == 0 )
+      return false;
 
-        readBufferPtr = readBuffer;
-        readBufferLeft += (size_t) result;
-      }
+    if ( char const * lineBreak = Decoder::findLineBreak( readBuffer, readBuffer + result ) )
+    {
+      size_t x = lineBreak - readBuffer;
+
+      readBufferPtr = readBuffer + x + unit;
+      readBufferLeft = result - x - unit;
+
+      return readBufferLeft || !gzeof( f );
     }
+  }
+}
 
-    if ( readBufferLeft < readMultiple )
-    {
-      // No more data. Return what we've got so far, forget the last byte if
-      // it was a 16-bit Unicode and a file had an odd number of bytes.
-      readBufferLeft = 0;
+bool DslScanner::readNextLine( wstring & out, uint64_t & offset ) throw( Ex,
+                                                                       Iconv::Ex )
+{
+  return ( this->*readLineFunction )( out, offset, false );
+}
 
-      if ( outPtr != &wcharBuffer.front() )
-      {
-        // If there was a stray \r, remove it
-        if ( outPtr[ -1 ] == L'\r' )
-          --outPtr;
+bool DslScanner::readNextLineWithoutComments( wstring & out, uint64_t & offset )
+                 throw( Ex, Iconv::Ex )
+{
+  return ( this->*readLineFunction )( out, offset, true );
+}
 
-        out = wstring( &wcharBuffer.front(), outPtr - &wcharBuffer.front() );
+template< DslEncoding Encoding >
+bool DslScanner::readLineIn( wstring & out, uint64_t & offset, bool stripComments )
+                 throw( Ex, Iconv::Ex )
+{
+  typedef DslDecoder< Encoding > Decoder;
 
-        ++linesRead;
+  GzOffset position = gzTell( f );
 
-        return true;
-      }
-      else
-        return false;
-    }
+  if ( position < 0 )
+    throw exDslFileTooLarge();
 
-    // Check that we have chars to write
-    if ( leftInOut < 2 ) // With 16-bit wchars, 2 is needed for a surrogate pair
-    {
-      wcharBuffer.resize( wcharBuffer.size() + 64 );
-      outPtr = &wcharBuffer.front() + wcharBuffer.size() - 64 - leftInOut;
-      leftInOut += 64;
-    }
+  offset = (uint64_t) position - readBufferLeft;
+
+  size_t used = 0; // The chars in wcharBuffer
+
+  bool gotChars = false;
+
+  commentFilter.reset();
+
+  for( ; ; )
+  {
+    char const * end = readBufferPtr + readBufferLeft;
+    char const * lineBreak = Decoder::findLineBreak( readBufferPtr, end );
+
+    if ( lineBreak )
+      end = lineBreak;
+
+    // Make room for the chars of the run, at most one per unit
+    size_t maxChars = ( end - readBufferPtr ) / Decoder::Unit;
+
+    if ( wcharBuffer.size() < used + maxChars )
+      wcharBuffer.resize( used + maxChars + 64 );
+
+    wchar * charPtr = &wcharBuffer.front() + used;
+    char const * inPtr = readBufferPtr;
+
+    wchar * outPtr = Decoder::decode( inPtr, end, charPtr );
 
-    // Ok, now convert one char
-    size_t outBytesLeft = sizeof( wchar );
+    if ( lineBreak && inPtr != lineBreak )
+      throw Iconv::exIncorrectSeq(); // A char cut by the line break
 
-    Iconv::Result r =
-      iconv.convert( (void const *&)readBufferPtr, readBufferLeft,
-                     (void *&)outPtr, outBytesLeft );
+    if ( inPtr != readBufferPtr )
+      gotChars = true;
 
-    if ( r == Iconv::NeedMoreOut && outBytesLeft == sizeof( wchar ) )
+    if ( stripComments )
     {
-      // Seems to be a surrogate pair with a 16-bit target wchar
+      // Pass the chars just decoded through the comment filter
+      wchar * decodedEnd = outPtr;
 
-      outBytesLeft *= 2;
-      r = iconv.convert( (void const *&)readBufferPtr, readBufferLeft,
-                     (void *&)outPtr, outBytesLeft );
-      --leftInOut; // Complements the next decremention
-    }
+      outPtr = charPtr;
 
-    if ( outBytesLeft )
-      throw exEncodingError();
+      for( wchar * c = charPtr; c != decodedEnd; ++c )
+        outPtr = commentFilter.put( *c, outPtr );
+    }
 
-    --leftInOut;
+    used = outPtr - &wcharBuffer.front();
 
-    // Have we got \n?
-    if ( outPtr[ -1 ] == L'\n' )
+    if ( lineBreak )
     {
-      --outPtr;
+      size_t consumed = inPtr - readBufferPtr + Decoder::Unit;
+
+      readBufferPtr += consumed;
+      readBufferLeft -= consumed;
+
+      gotChars = true;
+
+      if ( stripComments && commentFilter.isInComment() )
+      {
+        // The comment goes on, and so does the line
+        ++linesRead;
+        commentFilter.breakLine();
+        continue;
+      }
 
       // Now kill a \r if there is one, and return the result.
-      if ( outPtr != &wcharBuffer.front() && outPtr[ -1 ] == L'\r' )
-          --outPtr;
+      if ( used && wcharBuffer[ used - 1 ] == L'\r' )
+        --used;
 
-      out = wstring( &wcharBuffer.front(), outPtr - &wcharBuffer.front() );
+      out.assign( &wcharBuffer.front(), used );
 
       ++linesRead;
 
       return true;
     }
-  }
-}
 
-bool DslScanner::readNextLineWithoutComments( wstring & out, size_t & offset )
-                 throw( Ex, Iconv::Ex )
-{
-  wstring str;
-  bool commentToNextLine = false;
-  size_t currentOffset;
+    readBufferLeft -= inPtr - readBufferPtr;
 
-  out.erase();
-  offset = 0;
+    // What is left, if anything, is a char cut by the end of the buffer. To
+    // avoid having to deal with ring logic, we move it to the beginning, and
+    // read some more bytes after it
+    memmove( readBuffer, inPtr, readBufferLeft );
+    readBufferPtr = readBuffer;
 
-  do
-  {
-    bool b = readNextLine( str, currentOffset );
+    int result = gzread( f, readBuffer + readBufferLeft,
+                         sizeof( readBuffer ) - readBufferLeft );
 
-    if( offset == 0 )
-      offset = currentOffset;
+    if ( result == -1 )
+      throw exCantReadDslFile();
 
-    if( !b )
-      return false;
+    if ( result )
+    {
+      readBufferLeft += (size_t) result;
+      continue;
+    }
 
-    stripComments( str, commentToNextLine);
+    // No more data. Return what we've got so far, forget the last byte if
+    // it was a 16-bit Unicode and a file had an odd number of bytes.
+    if ( readBufferLeft >= Decoder::Unit )
+      throw exEncodingError(); // The file ends in the middle of a char
 
-    out += str;
-  }
-  while( commentToNextLine );
+    readBufferLeft = 0;
 
-  return true;
+    // A comment which is never closed spoils the whole line
+    if ( gotChars && !commentFilter.isInComment() )
+    {
+      // If there was a stray \r, remove it
+      if ( used && wcharBuffer[ used - 1 ] == L'\r' )
+        --used;
+
+      out.assign( &wcharBuffer.front(), used );
+
+      ++linesRead;
+
+      return true;
+    }
+    else
+      return false;
+  }
 }
 
 /////////////// DslScanner
@@ -1209,130 +1580,236 @@ void processUnsortedParts( wstring & str, bool strip )
   }
 }
 
-void expandOptionalParts( wstring & str, list< wstring > * result,
-                          size_t x, bool inside_recurse )
+namespace
+{
+  unsigned optionalPartsLimit = 32;
+
+  /// Every pass over the headword costs the same, whether it produces a new
+  /// variant or a duplicate one. Without this bound a headword like
+  /// "a(b)(b)(b)..." would make us go through all 2^n combinations while
+  /// producing only n+1 distinct variants.
+  enum { MaxPassesPerVariant = 16 };
+}
+
+void setOptionalPartsLimit( unsigned limit )
 {
-  list< wstring > expanded;
-  list< wstring > * headwords;
-  headwords = inside_recurse ? result : &expanded;
+  optionalPartsLimit = limit ? limit : 1;
+}
+
+unsigned getOptionalPartsLimit()
+{
+  return optionalPartsLimit;
+}
+
+OptionalPartsExpander::OptionalPartsExpander( unsigned maxVariants_ ):
+  maxVariants( maxVariants_ ? maxVariants_ : getOptionalPartsLimit() ),
+  starts( 1, 0 ), truncated( false )
+{
+}
+
+size_t OptionalPartsExpander::expand( wstring const & str, bool warn )
+{
+  arena.clear();
+  starts.resize( 1 );
+  removed.clear();
+  seen.clear();
+  truncated = false;
+
+  // Match all the parens in one go, so the passes don't have to search for
+  // the closing ones over and over again
+
+  closingParens.assign( str.size(), wstring::npos );
+  openParens.clear();
 
-  for( ; x < str.size(); )
+  for( size_t x = 0; x < str.size(); ++x )
+  {
+    if ( str[ x ] == L'\\' )
+      ++x; // Escape code
+    else
+    if ( str[ x ] == L'(' )
+      openParens.push_back( x );
+    else
+    if ( str[ x ] == L')' && !openParens.empty() )
+    {
+      closingParens[ openParens.back() ] = x;
+      openParens.pop_back();
+    }
+  }
+
+  // Go through the combinations depth-first, trying to remove each part
+  // before keeping it
+
+  size_t passesLeft = (size_t) maxVariants * MaxPassesPerVariant;
+
+  for( ; ; )
+  {
+    generate( str );
+    commit();
+
+    // Backtrack to the last removed part, it is to be kept next time
+    while( !removed.empty() && !removed.back() )
+      removed.pop_back();
+
+    if ( removed.empty() )
+      break;
+
+    if ( size() >= maxVariants || !--passesLeft )
+    {
+      truncated = true;
+
+      if ( warn )
+        gdWarning( "Warning: too many optional parts combinations in headword \"%s\", only %u used.\n",
+                   gd::toQString( str ).toUtf8().data(), (unsigned) size() );
+      break;
+    }
+
+    removed.back() = false;
+  }
+
+  return size();
+}
+
+void OptionalPartsExpander::generate( wstring const & str )
+{
+  size_t part = 0; // Number of optional parts met so far
+
+  for( size_t x = 0; x < str.size(); )
   {
     wchar ch = str[ x ];
 
     if ( ch == L'\\' )
     {
       // Escape code
+      arena.append( str, x, 2 );
       x += 2;
     }
     else
     if ( ch == L'(' )
     {
-      // First, handle the case where this block is removed
+      size_t closing = closingParens[ x ];
 
+      // Empty parens, and an unclosed one at the very end, have nothing
+      // to remove
+      bool optional = ( closing == wstring::npos ) ? x != str.size() - 1 :
+                                                     closing != x + 1;
+      if ( optional )
       {
-        int refCount = 1;
-
-        for( size_t y = x + 1; y < str.size(); ++y )
-        {
-          wchar ch = str[ y ];
+        if ( part == removed.size() )
+          removed.push_back( true );
 
-          if ( ch == L'\\' )
-          {
-            // Escape code
-            ++y;
-          }
-          else
-          if ( ch == L'(' )
-            ++refCount;
-          else
-          if ( ch == L')' )
-          {
-            if ( !--refCount )
-            {
-              // Now that the closing parenthesis is found,
-              // cut the whole thing out and be done.
-
-              if ( y != x + 1 ) // Only do for non-empty cases
-              {
-                wstring removed( str, 0, x );
-                removed.append( str, y + 1, str.size() - y - 1 );
-
-                expandOptionalParts( removed, headwords, x, true );
-              }
-
-              break;
-            }
-          }
-        }
-
-        if ( refCount && x != str.size() - 1 )
+        if ( removed[ part++ ] )
         {
-          // Closing paren not found? Chop it.
+          if ( closing == wstring::npos )
+            return; // Closing paren not found? Chop it.
 
-          wstring removed( str, 0, x );
-
-          // Limit the amount of results to avoid excessive resource consumption
-          if ( headwords->size() < 32 )
-            headwords->push_back( removed );
-          else
-          {
-            if( !inside_recurse )
-              result->merge( expanded );
-            return;
-          }
+          x = closing + 1;
+          continue;
         }
       }
 
-      // Now, handling the case where it is kept -- we just erase
-      // the paren and go on
-
-      str.erase( x, 1 );
+      // The part is kept -- we just skip the paren and go on
+      ++x;
     }
     else
     if ( ch == L')' )
     {
-      // Closing paren doesn't mean much -- just erase it
-      str.erase( x, 1 );
+      // Closing paren doesn't mean much -- just skip it
+      ++x;
     }
     else
+    {
+      arena.push_back( ch );
       ++x;
+    }
   }
+}
 
-  // Limit the amount of results to avoid excessive resource consumption
-  if ( headwords->size() < 32 )
-    headwords->push_back( str );
-  if( !inside_recurse )
-    result->merge( expanded );
+void OptionalPartsExpander::commit()
+{
+  size_t begin = starts.back();
+  size_t len = arena.size() - begin;
+
+  // FNV-1a
+  size_t hash = 2166136261u;
+  for( size_t x = begin; x < arena.size(); ++x )
+    hash = ( hash ^ (size_t) arena[ x ] ) * 16777619u;
+
+  typedef std::unordered_multimap< size_t, size_t >::const_iterator Iter;
+  std::pair< Iter, Iter > range = seen.equal_range( hash );
+
+  for( Iter i = range.first; i != range.second; ++i )
+  {
+    if ( length( i->second ) == len &&
+         arena.compare( starts[ i->second ], len, arena, begin, len ) == 0 )
+    {
+      // Seen that already
+      arena.resize( begin );
+      return;
+    }
+  }
+
+  seen.insert( std::make_pair( hash, starts.size() - 1 ) );
+  starts.push_back( arena.size() );
 }
 
-static const wstring openBraces( GD_NATIVE_TO_WS( L"{{" ) );
-static const wstring closeBraces( GD_NATIVE_TO_WS( L"}}" ) );
+void OptionalPartsExpander::appendTo( list< wstring > & result ) const
+{
+  list< wstring > expanded;
+
+  for( size_t x = 0; x < size(); ++x )
+    expanded.push_back( (*this)[ x ] );
+
+  result.merge( expanded );
+}
 
-void stripComments( wstring & str, bool & nextLine )
+void expandOptionalParts( wstring const & str, list< wstring > * result )
 {
-  string::size_type n = 0, n2 = 0;
+  OptionalPartsExpander expander;
+
+  expander.expand( str );
+  expander.appendTo( *result );
+}
+
+void decodeArticle( DslEncoding encoding, char const * data, size_t size,
+                    wstring & out ) throw( Iconv::Ex )
+{
+  out.clear();
+
+  if ( !size )
+    return;
+
+  // No supported encoding takes less than a byte per char
+  out.resize( size );
+
+  DslIconv iconv( encoding );
+  CommentFilter commentFilter;
+
+  wchar * const outBegin = &out[ 0 ];
+  wchar * outEnd = outBegin;
+
+  void const * inPtr = data;
+  size_t inLeft = size;
+
+  wchar buf[ 1024 ];
 
   for( ; ; )
   {
-    if( nextLine )
-    {
-      n = str.find( closeBraces, n2 );
-      if( n == string::npos )
-      {
-        str.erase( n2, n );
-        return;
-      }
-      str.erase( n2, n - n2 + 2 );
-      nextLine = false;
-    }
+    void * bufPtr = buf;
+    size_t bufLeft = sizeof( buf );
 
-    n = str.find( openBraces, n2 );
-    if( n == string::npos )
-      return;
-    nextLine = true;
-    n2 = n;
+    Iconv::Result r = iconv.convert( inPtr, inLeft, bufPtr, bufLeft );
+
+    for( wchar const * c = buf; c != (wchar const *) bufPtr; ++c )
+      outEnd = commentFilter.put( *c, outEnd );
+
+    if ( r == Iconv::Success )
+      break;
+
+    if ( r == Iconv::NeedMoreIn )
+      throw Iconv::exPrematureEnd();
   }
+
+  out.resize( outEnd - outBegin );
 }
 
 void expandTildes( wstring & str, wstring const & tildeReplacement )
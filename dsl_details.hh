@@ -7,8 +7,10 @@
 #include <string>
 #include <list>
 #include <vector>
+#include <unordered_map>
 #include <zlib.h>
 #include "iconv.hh"
+#include "utf8.hh"
 #include "wstring.hh"
 #include "stdint.h"
 
@@ -43,6 +45,44 @@ string findCodeForDslId( int id );
 
 bool isAtSignFirst( wstring const & str );
 
+/// The text the ArticleDom's text nodes hold. It's UTF-8, which is what the
+/// html is made of, and which takes a quarter of the memory of the wide
+/// characters for the Latin text, and a half for most of the rest. Defining
+/// DSL_WIDE_DOM keeps it as the wide characters it's parsed from. The
+/// functions below work with either, so the code using the nodes' text
+/// doesn't depend on the choice.
+#ifdef DSL_WIDE_DOM
+typedef wstring DomText;
+#else
+typedef string DomText;
+#endif
+
+inline void appendToText( wstring & text, wchar ch )
+{ text.push_back( ch ); }
+
+inline void appendToText( string & text, wchar ch )
+{
+  if ( (uint32_t) ch < 0x80 )
+    text.push_back( ch );
+  else
+  {
+    char buffer[ 4 ];
+    text.append( buffer, ::Utf8::encode( &ch, 1, buffer ) );
+  }
+}
+
+inline wstring const & textToWide( wstring const & text )
+{ return text; }
+
+inline wstring textToWide( string const & text )
+{ return ::Utf8::decode( text ); }
+
+inline string textToUtf8( wstring const & text )
+{ return ::Utf8::encode( text ); }
+
+inline string const & textToUtf8( string const & text )
+{ return text; }
+
 /// Parses the DSL language, representing it in its structural DOM form.
 struct ArticleDom
 {
@@ -53,7 +93,7 @@ struct ArticleDom
     // Those are only used if isTag is true
     wstring tagName;
     wstring tagAttrs;
-    wstring text; // This is only used if isTag is false
+    DomText text; // This is only used if isTag is false
 
     class Text {};
     class Tag {};
@@ -62,12 +102,15 @@ struct ArticleDom
       tagName( name ), tagAttrs( attrs )
     {}
 
-    Node( Text, wstring const & text_ ): isTag( false ), text( text_ )
+    explicit Node( Text ): isTag( false )
     {}
 
     /// Concatenates all childen text nodes recursively to form all text
     /// the node contains stripped of any markup.
     wstring renderAsText( bool stripTrsTag = false ) const;
+
+    /// The same as renderAsText(), in UTF-8.
+    string renderAsUtf8( bool stripTrsTag = false ) const;
   };
 
   /// Does the parse at construction. Refer to the 'root' member variable
@@ -113,13 +156,66 @@ public:
   static char const * getEncodingNameFor( DslEncoding );
 };
 
+/// Elides DSL {{...}} comments from the text as it is being produced, so
+/// their contents never get stored anywhere. The state is kept between the
+/// calls, so the comments may span several lines or buffers.
+class CommentFilter
+{
+  bool inComment;
+  bool brace; // The last char seen was '{' outside or '}' inside a comment
+
+public:
+
+  CommentFilter(): inComment( false ), brace( false )
+  {}
+
+  bool isInComment() const
+  { return inComment; }
+
+  /// Braces separated by a line break don't make a comment mark.
+  void breakLine()
+  { brace = false; }
+
+  void reset()
+  { inComment = brace = false; }
+
+  /// Appends the given char to the text ending at 'out', unless it belongs to
+  /// a comment. Returns the new end of the text.
+  inline wchar * put( wchar ch, wchar * out );
+};
+
+inline wchar * CommentFilter::put( wchar ch, wchar * out )
+{
+  if ( inComment )
+  {
+    if ( ch == L'}' && brace )
+      inComment = brace = false;
+    else
+      brace = ( ch == L'}' );
+
+    return out;
+  }
+
+  if ( ch == L'{' && brace )
+  {
+    // The first brace was stored already, take it back
+    inComment = true;
+    brace = false;
+    return out - 1;
+  }
+
+  brace = ( ch == L'{' );
+  *out++ = ch;
+
+  return out;
+}
+
 /// Opens the .dsl or .dsl.dz file and allows line-by-line reading. Auto-detects
 /// the encoding, and reads all headers by itself.
 class DslScanner
 {
   gzFile f;
   DslEncoding encoding;
-  DslIconv iconv;
   wstring dictionaryName;
   wstring langFrom, langTo;
   char readBuffer[ 65536 ];
@@ -127,12 +223,15 @@ class DslScanner
   size_t readBufferLeft;
   vector< wchar > wcharBuffer;
   unsigned linesRead;
+  CommentFilter commentFilter;
 
 public:
 
   DEF_EX( Ex, "Dsl scanner exception", std::exception )
   DEF_EX_STR( exCantOpen, "Can't open .dsl file", Ex )
   DEF_EX( exCantReadDslFile, "Can't read .dsl file", Ex )
+  DEF_EX( exDslFileTooLarge, "The .dsl file is larger than the zlib this program "
+                             "was built with can seek in (2 GB)", Ex )
   DEF_EX_STR( exMalformedDslFile, "The .dsl file is malformed:", Ex )
   DEF_EX( exUnknownCodePage, "The .dsl file specified an unknown code page", Ex )
   DEF_EX( exEncodingError, "Encoding error", Ex ) // Should never happen really
@@ -162,19 +261,51 @@ public:
   /// If end of file is reached, false is returned.
   /// Reading begins from the first line after the headers (ones which start
   /// with #).
-  bool readNextLine( wstring &, size_t & offset ) throw( Ex, Iconv::Ex );
+  bool readNextLine( wstring &, uint64_t & offset ) throw( Ex, Iconv::Ex );
 
-  /// Similar readNextLine but strip all DSL comments {{...}}
-  bool readNextLineWithoutComments( wstring &, size_t & offset ) throw( Ex, Iconv::Ex );
+  /// Similar readNextLine but strip all DSL comments {{...}}. The comments
+  /// are dropped while decoding. A line with a comment going past its end
+  /// gets joined with the following ones up to where the comment ends.
+  bool readNextLineWithoutComments( wstring &, uint64_t & offset ) throw( Ex, Iconv::Ex );
 
   /// Returns the number of lines read so far from the file.
   unsigned getLinesRead() const
   { return linesRead; }
 
+  /// Returns true if the file is compressed. Only the uncompressed ones can
+  /// be seeked fast.
+  bool isCompressed() const
+  { return !gzdirect( f ); }
+
+  /// Moves to the beginning of the first line starting at or after the given
+  /// offset, so that readNextLine() would read it next. The line numbers are
+  /// not known after that, so they are counted from that line on. Returns
+  /// false if there are no more lines.
+  bool seekToLine( uint64_t offset ) throw( Ex );
+
   /// Converts the given number of characters to the number of bytes they
   /// would occupy in the file, knowing its encoding. It's possible to know
   /// that because no multibyte encodings are supported in .dsls.
   inline size_t distanceToBytes( size_t ) const;
+
+private:
+
+  /// The readLineIn() and seekToLineIn() for the encoding, chosen by
+  /// selectReader(), so the encoding is only looked at once.
+  bool ( DslScanner::*readLineFunction )( wstring &, uint64_t &, bool );
+  bool ( DslScanner::*seekToLineFunction )( uint64_t );
+
+  /// Chooses the functions for the current encoding. Must be called each
+  /// time it changes.
+  void selectReader();
+
+  /// Reads the lines, decoding them a run of bytes at a time, with the
+  /// line breaks and the incomplete chars found the way the encoding has it.
+  template< DslEncoding >
+  bool readLineIn( wstring &, uint64_t & offset, bool stripComments ) throw( Ex, Iconv::Ex );
+
+  template< DslEncoding >
+  bool seekToLineIn( uint64_t offset ) throw( Ex );
 };
 
 /// This function either removes parts of string enclosed in braces, or leaves
@@ -183,8 +314,69 @@ void processUnsortedParts( wstring & str, bool strip );
 
 /// Expands optional parts of a headword (ones marked with parentheses),
 /// producing all possible combinations where they are present or absent.
-void expandOptionalParts( wstring & str, list< wstring > * result,
-                          size_t x = 0, bool inside_recurse = false );
+/// The variants are generated iteratively, one pass over the headword per
+/// variant, into an arena which is reused between the calls. Duplicates are
+/// dropped as they appear, and the number of variants is capped, so a single
+/// broken headword with lots of parentheses can't blow up time or memory.
+class OptionalPartsExpander
+{
+  unsigned maxVariants;
+  wstring arena; // All the variants, back to back
+  vector< size_t > starts; // Start of each variant in the arena, plus the end
+  vector< size_t > closingParens; // Matching ')' for each '(', or npos
+  vector< size_t > openParens; // Used while matching the parens
+  vector< char > removed; // Choices made at each optional part, true if removed
+  std::unordered_multimap< size_t, size_t > seen; // Variant hash -> index
+  bool truncated;
+
+public:
+
+  /// Uses getOptionalPartsLimit() if maxVariants is 0.
+  explicit OptionalPartsExpander( unsigned maxVariants = 0 );
+
+  /// Expands the given headword, replacing the previous results. Returns the
+  /// number of variants produced. If the limit is hit, a warning is printed
+  /// unless warn is false.
+  size_t expand( wstring const & str, bool warn = true );
+
+  size_t size() const
+  { return starts.size() - 1; }
+
+  wchar const * data( size_t n ) const
+  { return arena.data() + starts[ n ]; }
+
+  size_t length( size_t n ) const
+  { return starts[ n + 1 ] - starts[ n ]; }
+
+  wstring operator [] ( size_t n ) const
+  { return wstring( data( n ), length( n ) ); }
+
+  /// Returns true if the last expansion hit the limit and some variants were
+  /// dropped.
+  bool wasTruncated() const
+  { return truncated; }
+
+  /// Adds the variants of the last expansion to the given list.
+  void appendTo( list< wstring > & ) const;
+
+private:
+
+  /// Makes one pass over the headword following the choices recorded so far,
+  /// storing the resulting variant at the end of the arena.
+  void generate( wstring const & str );
+
+  /// Keeps the variant just generated unless it duplicates an earlier one.
+  void commit();
+};
+
+/// Sets the maximum number of variants produced from a single headword by
+/// expandOptionalParts(). The default is 32.
+void setOptionalPartsLimit( unsigned );
+unsigned getOptionalPartsLimit();
+
+/// A shortcut to OptionalPartsExpander for the code which is not
+/// time-critical.
+void expandOptionalParts( wstring const & str, list< wstring > * result );
 
 /// Expands all unescaped tildes, inserting tildeReplacement text instead of
 /// them.
@@ -198,8 +390,10 @@ void unescapeDsl( wstring & str );
 /// into a single space.
 void normalizeHeadword( wstring & );
 
-/// Strip DSL {{...}} comments
-void stripComments( wstring &, bool & );
+/// Decodes the article's data from the given dsl encoding, dropping all DSL
+/// {{...}} comments on the way.
+void decodeArticle( DslEncoding, char const * data, size_t size, wstring & out )
+  throw( Iconv::Ex );
 
 inline size_t DslScanner::distanceToBytes( size_t x ) const
 {
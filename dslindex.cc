@@ -0,0 +1,422 @@
+#include "dslindex.hh"
+#include "utf8.hh"
+#include "fsencoding.hh"
+#include "gddebug.hh"
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
+
+#include <string.h>
+
+namespace DslIndex {
+
+using std::vector;
+using gd::wstring;
+using gd::wchar;
+
+namespace {
+
+enum
+{
+  Signature = 0x49475444, // DTGI on little-endian machines
+  CurrentFormatVersion = 2,
+  HashedBytes = 65536 // At both ends of the file
+};
+
+struct IndexHeader
+{
+  uint32_t signature;
+  uint32_t formatVersion;
+  uint32_t optionalPartsLimit; // Affects the headwords produced
+  uint32_t encoding;
+  FileStamp dsl, abrv; // abrv is all zeroes if there's no abbreviations file
+  uint32_t langFromRTL, langToRTL;
+  uint32_t cardCount;
+  uint32_t abrvCount;
+  uint64_t cardsOffset; // IndexCard[ cardCount ]
+  uint64_t stringsOffset; // Name, langFrom, langTo, then abrvCount key/value pairs
+  uint64_t fileSize; // The whole index file, to detect truncated ones
+};
+
+struct IndexCard
+{
+  uint64_t offset;
+  uint64_t strings; // headwordCount headwords
+  uint32_t size;
+  uint32_t headwordOffset;
+  uint32_t headwordSize;
+  uint32_t headwordIndex;
+  uint32_t bodyOffset;
+  uint32_t headwordCount;
+};
+
+// Each string is stored as a 32-bit byte length followed by that many bytes
+// of utf8, with no alignment
+
+uint64_t fnv1a( uint64_t hash, char const * data, size_t size )
+{
+  for( size_t x = 0; x < size; ++x )
+  {
+    hash ^= (unsigned char) data[ x ];
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+}
+
+FileStamp stampFor( string const & fileName )
+{
+  FileStamp stamp;
+  memset( &stamp, 0, sizeof( stamp ) );
+
+  if ( fileName.empty() )
+    return stamp;
+
+  QString name = FsEncoding::decode( fileName.c_str() );
+  QFileInfo info( name );
+
+  stamp.size = info.size();
+  stamp.mtime = info.lastModified().toMSecsSinceEpoch();
+  stamp.hash = 14695981039346656037ULL;
+
+  QFile f( name );
+
+  if ( !f.open( QIODevice::ReadOnly ) )
+    return stamp;
+
+  vector< char > buffer( HashedBytes );
+
+  qint64 got = f.read( &buffer.front(), HashedBytes );
+  if ( got > 0 )
+    stamp.hash = fnv1a( stamp.hash, &buffer.front(), got );
+
+  if ( stamp.size > HashedBytes && f.seek( stamp.size - HashedBytes ) )
+  {
+    got = f.read( &buffer.front(), HashedBytes );
+    if ( got > 0 )
+      stamp.hash = fnv1a( stamp.hash, &buffer.front(), got );
+  }
+
+  return stamp;
+}
+
+namespace {
+
+/// Reads the strings from the mapped index, checking the bounds
+class StringReader
+{
+  uchar const * begin, * ptr, * end;
+  vector< wchar > buffer;
+
+public:
+
+  StringReader( uchar const * begin_, uchar const * end_ ):
+    begin( begin_ ), ptr( end_ ), end( end_ )
+  {}
+
+  void seek( uint64_t offset )
+  { ptr = offset < uint64_t( end - begin ) ? begin + offset : end; }
+
+  bool read( string & str )
+  {
+    char const * data;
+    uint32_t size;
+
+    if ( !read( data, size ) )
+      return false;
+
+    str.assign( data, size );
+
+    return true;
+  }
+
+  bool read( wstring & str )
+  {
+    char const * data;
+    uint32_t size;
+
+    if ( !read( data, size ) )
+      return false;
+
+    if ( buffer.size() < size + 1 )
+      buffer.resize( size + 1 );
+
+    long result = Utf8::decode( data, size, &buffer.front() );
+
+    if ( result < 0 )
+      return false;
+
+    str.assign( &buffer.front(), result );
+
+    return true;
+  }
+
+private:
+
+  bool read( char const * & data, uint32_t & size )
+  {
+    if ( end - ptr < (ptrdiff_t) sizeof( size ) )
+      return false;
+
+    memcpy( &size, ptr, sizeof( size ) );
+    ptr += sizeof( size );
+
+    if ( uint64_t( end - ptr ) < size )
+      return false;
+
+    data = (char const *) ptr;
+    ptr += size;
+
+    return true;
+  }
+};
+
+/// Accumulates the strings and writes them out in large blocks
+class StringWriter
+{
+  QFile & f;
+  string buffer;
+  uint64_t offset;
+
+public:
+
+  StringWriter( QFile & f_, uint64_t offset_ ): f( f_ ), offset( offset_ )
+  {}
+
+  uint64_t getOffset() const
+  { return offset; }
+
+  bool write( string const & str )
+  {
+    uint32_t size = str.size();
+
+    buffer.append( (char const *) &size, sizeof( size ) );
+    buffer.append( str );
+    offset += sizeof( size ) + size;
+
+    if ( buffer.size() >= 1048576 )
+      return flush();
+
+    return true;
+  }
+
+  bool write( wstring const & str )
+  { return write( Utf8::encode( str ) ); }
+
+  bool flush()
+  {
+    bool result = f.write( buffer.data(), buffer.size() ) == (qint64) buffer.size();
+    buffer.clear();
+    return result;
+  }
+};
+
+}
+
+string nameFor( string const & dslName )
+{
+  return dslName + ".dsltogls.idx";
+}
+
+bool load( string const & indexName, string const & dslName,
+           string const & abrvName, DictParameters & params,
+           QVector< DslCard > & cards, map< string, string > & abrv )
+{
+  QFile f( FsEncoding::decode( indexName.c_str() ) );
+
+  if ( !f.open( QIODevice::ReadOnly ) )
+    return false;
+
+  qint64 fileSize = f.size();
+
+  if ( fileSize < (qint64) sizeof( IndexHeader ) )
+    return false;
+
+  uchar const * data = f.map( 0, fileSize );
+
+  if ( !data )
+    return false;
+
+  uchar const * end = data + fileSize;
+
+  IndexHeader header;
+  memcpy( &header, data, sizeof( header ) );
+
+  if ( header.signature != Signature
+       || header.formatVersion != CurrentFormatVersion
+       || header.optionalPartsLimit != getOptionalPartsLimit()
+       || header.fileSize != (uint64_t) fileSize
+       || header.cardsOffset > header.fileSize
+       || ( header.fileSize - header.cardsOffset ) / sizeof( IndexCard ) < header.cardCount
+       || header.stringsOffset > header.fileSize )
+    return false;
+
+  if ( !( header.dsl == stampFor( dslName ) ) || !( header.abrv == stampFor( abrvName ) ) )
+    return false;
+
+  StringReader strings( data, end );
+  strings.seek( header.stringsOffset );
+
+  params.encoding = (DslEncoding) header.encoding;
+  params.langFromRTL = header.langFromRTL;
+  params.langToRTL = header.langToRTL;
+
+  if ( !strings.read( params.name ) || !strings.read( params.langFrom )
+       || !strings.read( params.langTo ) )
+    return false;
+
+  abrv.clear();
+
+  for( uint32_t x = 0; x < header.abrvCount; ++x )
+  {
+    string key, value;
+
+    if ( !strings.read( key ) || !strings.read( value ) )
+      return false;
+
+    abrv[ key ] = value;
+  }
+
+  cards.clear();
+  cards.reserve( header.cardCount );
+
+  IndexCard const * indexCards = (IndexCard const *)( data + header.cardsOffset );
+
+  DslCard card;
+  wstring headword;
+
+  for( uint32_t x = 0; x < header.cardCount; ++x )
+  {
+    IndexCard indexCard;
+    memcpy( &indexCard, indexCards + x, sizeof( indexCard ) );
+
+    card.offset = indexCard.offset;
+    card.size = indexCard.size;
+    card.headwordOffset = indexCard.headwordOffset;
+    card.headwordSize = indexCard.headwordSize;
+    card.headwordIndex = indexCard.headwordIndex;
+    card.bodyOffset = indexCard.bodyOffset;
+    card.headwords.clear();
+
+    strings.seek( indexCard.strings );
+
+    for( uint32_t y = 0; y < indexCard.headwordCount; ++y )
+    {
+      if ( !strings.read( headword ) )
+        return false;
+
+      card.headwords.push_back( headword );
+    }
+
+    if ( card.headwords.isEmpty() )
+      return false;
+
+    cards.push_back( card );
+  }
+
+  return true;
+}
+
+bool save( string const & indexName, string const & dslName,
+           string const & abrvName, DictParameters const & params,
+           QVector< DslCard > const & cards, map< string, string > const & abrv )
+{
+  QString name = FsEncoding::decode( indexName.c_str() );
+  // The shards of a plan may be indexing the same dictionary at once, so
+  // each process writes its own temporary file
+  QString tempName = name + QString( ".%1.tmp" ).arg( QCoreApplication::applicationPid() );
+
+  QFile f( tempName );
+
+  if ( !f.open( QIODevice::WriteOnly | QIODevice::Truncate ) )
+  {
+    gdWarning( "Warning: can't create index file %s\n", indexName.c_str() );
+    return false;
+  }
+
+  IndexHeader header;
+  memset( &header, 0, sizeof( header ) );
+
+  header.signature = Signature;
+  header.formatVersion = CurrentFormatVersion;
+  header.optionalPartsLimit = getOptionalPartsLimit();
+  header.encoding = params.encoding;
+  header.dsl = stampFor( dslName );
+  header.abrv = stampFor( abrvName );
+  header.langFromRTL = params.langFromRTL;
+  header.langToRTL = params.langToRTL;
+  header.cardCount = cards.size();
+  header.abrvCount = abrv.size();
+  header.cardsOffset = sizeof( header );
+  header.stringsOffset = header.cardsOffset + sizeof( IndexCard ) * cards.size();
+
+  // The strings go first, the header and the cards are written once their
+  // offsets are known
+
+  bool ok = f.seek( header.stringsOffset );
+
+  StringWriter strings( f, header.stringsOffset );
+
+  ok = ok && strings.write( params.name ) && strings.write( params.langFrom )
+       && strings.write( params.langTo );
+
+  // The abbreviations are in utf8 already
+  for( map< string, string >::const_iterator i = abrv.begin(); ok && i != abrv.end(); ++i )
+    ok = strings.write( i->first ) && strings.write( i->second );
+
+  vector< IndexCard > indexCards( cards.size() );
+
+  for( int x = 0; ok && x < cards.size(); ++x )
+  {
+    DslCard const & card = cards[ x ];
+    IndexCard & indexCard = indexCards[ x ];
+
+    memset( &indexCard, 0, sizeof( indexCard ) );
+
+    indexCard.offset = card.offset;
+    indexCard.strings = strings.getOffset();
+    indexCard.size = card.size;
+    indexCard.headwordOffset = card.headwordOffset;
+    indexCard.headwordSize = card.headwordSize;
+    indexCard.headwordIndex = card.headwordIndex;
+    indexCard.bodyOffset = card.bodyOffset;
+    indexCard.headwordCount = card.headwords.size();
+
+    for( int y = 0; ok && y < card.headwords.size(); ++y )
+      ok = strings.write( card.headwords[ y ] );
+  }
+
+  ok = ok && strings.flush();
+
+  header.fileSize = strings.getOffset();
+
+  ok = ok && f.seek( 0 )
+       && f.write( (char const *) &header, sizeof( header ) ) == (qint64) sizeof( header );
+
+  if ( ok && !indexCards.empty() )
+    ok = f.write( (char const *) &indexCards.front(),
+                  sizeof( IndexCard ) * indexCards.size() )
+         == (qint64)( sizeof( IndexCard ) * indexCards.size() );
+
+  f.close();
+
+  if ( ok )
+  {
+    QFile::remove( name );
+    ok = QFile::rename( tempName, name );
+  }
+
+  if ( !ok )
+  {
+    QFile::remove( tempName );
+    gdWarning( "Warning: can't write index file %s\n", indexName.c_str() );
+  }
+
+  return ok;
+}
+
+}
@@ -0,0 +1,53 @@
+#ifndef __DSLINDEX_HH_INCLUDED__
+#define __DSLINDEX_HH_INCLUDED__
+
+#include <stdint.h>
+#include <string>
+#include <map>
+#include <QVector>
+
+#include "dsl.hh"
+
+/// A persistent index of a .dsl file, stored next to it, so the repeated
+/// conversions of the same dictionary don't have to scan it again. It keeps
+/// the header parameters, the abbreviations and the whole card table. The
+/// file is mapped into memory on loading. It is only used while the sizes,
+/// modification times and content hashes of the .dsl and the abbreviations
+/// files, and the indexing settings, match the ones it was made with.
+namespace DslIndex {
+
+using std::string;
+using std::map;
+
+/// Identifies the exact contents of a source file without reading all of it
+struct FileStamp
+{
+  uint64_t size;
+  int64_t mtime; // Milliseconds since epoch
+  uint64_t hash; // Of the first and last 64 KiB of the file
+
+  bool operator == ( FileStamp const & other ) const
+  { return size == other.size && mtime == other.mtime && hash == other.hash; }
+};
+
+/// Makes the stamp of the file. It's all zeroes if no name is given.
+FileStamp stampFor( string const & fileName );
+
+/// Returns the name of the index file for the given .dsl file.
+string nameFor( string const & dslName );
+
+/// Loads the index if it exists and is up to date. Returns false otherwise,
+/// leaving the output parameters in an unspecified state.
+bool load( string const & indexName, string const & dslName,
+           string const & abrvName, DictParameters & params,
+           QVector< DslCard > & cards, map< string, string > & abrv );
+
+/// Saves the index, replacing the existing one. Returns false if it couldn't
+/// be written, which is not fatal -- the next run would just scan again.
+bool save( string const & indexName, string const & dslName,
+           string const & abrvName, DictParameters const & params,
+           QVector< DslCard > const & cards, map< string, string > const & abrv );
+
+}
+
+#endif
@@ -3,133 +3,204 @@
 
 #include "filetype.hh"
 #include "utf8.hh"
-#include <ctype.h>
+#include <stdint.h>
 
 namespace Filetype {
 
 namespace {
 
+/// No extension is longer than that, so each one fits into a uint32_t
+enum { MaxExtensionSize = 4 };
 
-/// Removes any trailing or leading spaces and lowercases the string.
-/// The lowercasing is done simplistically, but it is enough for file
-/// extensions.
-string simplifyString( string const & str )
+/// Packs the lowercase extension into a number, the first char into the
+/// lowest byte.
+constexpr uint32_t packExtension( char const * extension, unsigned x = 0 )
+{ return x == MaxExtensionSize || !extension[ x ] ? 0 :
+         (uint32_t)(unsigned char) extension[ x ] << ( 8 * x ) |
+         packExtension( extension, x + 1 ); }
+
+struct Extension
 {
-  string result;
+  char const * name;
+  Type type;
+};
 
-  size_t beginPos = 0;
+constexpr Extension Extensions[] =
+{
+  { "wav", Sound },
+  { "au", Sound },
+  { "voc", Sound },
+  { "ogg", Sound },
+  { "mp3", Sound },
+  { "m4a", Sound },
+  { "aac", Sound },
+  { "flac", Sound },
+  { "mid", Sound },
+  { "kar", Sound },
+  { "mpc", Sound },
+  { "wma", Sound },
+  { "wv", Sound },
+  { "ape", Sound },
+  { "spx", Sound },
+
+  { "mpg", Video },
+  { "mpeg", Video },
+  { "mpe", Video },
+  { "ogv", Video },
+  { "ogm", Video },
+  { "avi", Video },
+  { "m4v", Video },
+  { "mp4", Video },
+  { "mkv", Video },
+  { "wmv", Video },
+  { "sfw", Video },
+  { "flv", Video },
+  { "divx", Video },
+  { "3gp", Video },
+  { "mov", Video },
+
+  { "jpg", Picture },
+  { "jpeg", Picture },
+  { "jpe", Picture },
+  { "png", Picture },
+  { "gif", Picture },
+  { "bmp", Picture },
+  { "tif", Tiff },
+  { "tiff", Tiff },
+  { "tga", Picture },
+  { "pcx", Picture },
+  { "ico", Picture },
+  { "svg", Svg },
+
+  { "css", Css }
+};
+
+enum
+{
+  ExtensionCount = sizeof( Extensions ) / sizeof( Extensions[ 0 ] ),
+  SlotBits = 7,
+  SlotCount = 1 << SlotBits
+};
 
-  while( beginPos < str.size() && Utf8::isspace( str[ beginPos ] ) )
-    ++beginPos;
+/// The packed extensions are hashed by a multiplication, keeping the top
+/// bits. The multiplier was searched for to give each extension a slot of
+/// its own. The static_assert below checks it still does.
+constexpr uint32_t HashMultiplier = 0x0B89637B;
 
-  size_t endPos = str.size();
+constexpr unsigned slotOf( uint32_t key )
+{ return (uint32_t)( key * HashMultiplier ) >> ( 32 - SlotBits ); }
 
-  while( endPos && Utf8::isspace( str[ endPos - 1 ] ) )
-    --endPos;
+constexpr bool hasOwnSlot( size_t x, size_t y = 0 )
+{ return y == ExtensionCount ||
+         ( ( y == x || slotOf( packExtension( Extensions[ x ].name ) ) !=
+                       slotOf( packExtension( Extensions[ y ].name ) ) ) &&
+           hasOwnSlot( x, y + 1 ) ); }
 
-  result.reserve( endPos - beginPos );
+constexpr bool isPerfectHash( size_t x = 0 )
+{ return x == ExtensionCount || ( hasOwnSlot( x ) && isPerfectHash( x + 1 ) ); }
 
-  while( beginPos < endPos )
-    result.push_back( tolower( str[ beginPos++ ] ) );
+static_assert( isPerfectHash(), "Pick another HashMultiplier, the extensions collide" );
 
-  return result;
-}
+struct Slot
+{
+  uint32_t key; // 0 for the empty slots
+  Type type;
+};
+
+/// Returns the slot's contents, looking for the extension hashed to it
+constexpr Slot makeSlot( unsigned slot, size_t x = 0 )
+{ return x == ExtensionCount ? Slot{ 0, Unknown } :
+         slotOf( packExtension( Extensions[ x ].name ) ) == slot ?
+           Slot{ packExtension( Extensions[ x ].name ), Extensions[ x ].type } :
+           makeSlot( slot, x + 1 ); }
+
+/// Makes the table of all the slots at compile time, by expanding the
+/// sequence of their numbers, made recursively, into the initializer.
+template< unsigned... Numbers >
+struct SlotTable
+{
+  static constexpr Slot slots[ sizeof...( Numbers ) ] = { makeSlot( Numbers )... };
+};
 
-/// Checks if the given string ends with the given substring
-bool endsWith( string const & str, string const & tail )
+template< unsigned... Numbers >
+constexpr Slot SlotTable< Numbers... >::slots[ sizeof...( Numbers ) ];
+
+template< unsigned Count, unsigned... Numbers >
+struct MakeSlotTable: MakeSlotTable< Count - 1, Count - 1, Numbers... >
+{};
+
+template< unsigned... Numbers >
+struct MakeSlotTable< 0, Numbers... >
 {
-  return str.size() >= tail.size() &&
-    str.compare( str.size() - tail.size(), tail.size(), tail ) == 0;
+  typedef SlotTable< Numbers... > Table;
+};
+
+typedef MakeSlotTable< SlotCount >::Table Slots;
+
 }
 
+Type classify( char const * name, size_t size )
+{
+  // Skip the trailing spaces
+  while( size && Utf8::isspace( name[ size - 1 ] ) )
+    --size;
+
+  // Pack the extension, lowercased, going back from its end to the dot
+  uint32_t key = 0;
+
+  for( size_t length = 0; ; ++length )
+  {
+    if ( length == size || length > MaxExtensionSize )
+      return Unknown;
+
+    char c = name[ size - 1 - length ];
+
+    if ( c == '.' )
+    {
+      if ( !length )
+        return Unknown;
+      break;
+    }
+
+    if ( c >= 'A' && c <= 'Z' )
+      c += 'a' - 'A';
+
+    key = key << 8 | (unsigned char) c;
+  }
+
+  Slot const & slot = Slots::slots[ slotOf( key ) ];
+
+  return slot.key == key ? slot.type : Unknown;
 }
 
 bool isNameOfSound( string const & name )
 {
-  string s = simplifyString( name );
-
-  return
-    endsWith( s, ".wav" ) ||
-    endsWith( s, ".au" ) ||
-    endsWith( s, ".voc" ) ||
-    endsWith( s, ".ogg" ) ||
-    endsWith( s, ".mp3" ) ||
-    endsWith( s, ".m4a") ||
-    endsWith( s, ".aac" ) ||
-    endsWith( s, ".flac" ) ||
-    endsWith( s, ".mid" ) ||
-    endsWith( s, ".kar" ) ||
-    endsWith( s, ".mpc" ) ||
-    endsWith( s, ".wma" ) ||
-    endsWith( s, ".wv" ) ||
-    endsWith( s, ".ape" ) ||
-    endsWith( s, ".spx" );
+  return classify( name ) == Sound;
 }
 
 bool isNameOfVideo( string const & name )
 {
-  string s = simplifyString( name );
-
-  return
-    endsWith( s, ".mpg" ) ||
-    endsWith( s, ".mpeg" )||
-    endsWith( s, ".mpe" ) ||
-    endsWith( s, ".ogv" ) ||
-    endsWith( s, ".ogm" ) ||
-    endsWith( s, ".avi" ) ||
-    endsWith( s, ".m4v" ) ||
-    endsWith( s, ".mp4" ) ||
-    endsWith( s, ".mkv" ) ||
-    endsWith( s, ".wmv" ) ||
-    endsWith( s, ".sfw" ) ||
-    endsWith( s, ".flv" ) ||
-    endsWith( s, ".divx" ) ||
-    endsWith( s, ".3gp" ) ||
-    endsWith( s, ".mov" );
+  return classify( name ) == Video;
 }
 
 bool isNameOfPicture( string const & name )
 {
-  string s = simplifyString( name );
-
-  return
-    endsWith( s, ".jpg" ) ||
-    endsWith( s, ".jpeg" ) ||
-    endsWith( s, ".jpe" ) ||
-    endsWith( s, ".png" ) ||
-    endsWith( s, ".gif" ) ||
-    endsWith( s, ".bmp" ) ||
-    endsWith( s, ".tif" ) ||
-    endsWith( s, ".tiff" ) ||
-    endsWith( s, ".tga" ) ||
-    endsWith( s, ".pcx" ) ||
-    endsWith( s, ".ico" ) ||
-    endsWith( s, ".svg" );
+  return isPicture( classify( name ) );
 }
 
 bool isNameOfTiff( string const & name )
 {
-  string s = simplifyString( name );
-
-  return
-    endsWith( s, ".tif" ) ||
-    endsWith( s, ".tiff" );
+  return classify( name ) == Tiff;
 }
 
 bool isNameOfCSS( string const & name )
 {
-  string s = simplifyString( name );
-
-  return
-    endsWith( s, ".css" );
+  return classify( name ) == Css;
 }
 
 bool isNameOfSvg( string const & name )
 {
-  string s = simplifyString( name );
-
-  return
-    endsWith( s, ".svg" );
+  return classify( name ) == Svg;
 }
 
 }
@@ -11,6 +11,29 @@ namespace Filetype {
 
 using std::string;
 
+/// What a file is, judging by its name's extension
+enum Type
+{
+  Unknown,
+  Sound,
+  Picture,
+  Video,
+  Tiff, // A picture too, see isPicture()
+  Css,
+  Svg // A picture too
+};
+
+/// Classifies the file by the extension of its name, ignoring its case and
+/// any spaces around the name. The extension is looked up in a perfect hash
+/// table made at compile time, with no allocations or string comparisons.
+Type classify( char const * name, size_t size );
+
+inline Type classify( string const & name )
+{ return classify( name.data(), name.size() ); }
+
+inline bool isPicture( Type type )
+{ return type == Picture || type == Tiff || type == Svg; }
+
 /// Returns true if the name resembles the one of a sound file (i.e. ends
 /// with .wav, .ogg and such).
 bool isNameOfSound( string const & );
@@ -26,6 +26,12 @@ enum
   Version = 5
 };
 
+/// The most characters a single character can be folded into.
+enum
+{
+  MaxFoldedSize = 3
+};
+
 /// Applies the folding algorithm to each character in the given string,
 /// making another one as a result.
 wstring apply( wstring const &, bool preserveWildcards = false );
@@ -34,6 +40,11 @@ wstring apply( wstring const &, bool preserveWildcards = false );
 /// different case style, we interpret words differing only by case as synonyms.
 wstring applySimpleCaseOnly( wstring const & );
 
+/// Same as applySimpleCaseOnly( wstring ), but writes the result, which is
+/// always inSize characters long, into the output buffer. The output may be
+/// the same as the input.
+void applySimpleCaseOnly( wchar const * in, size_t inSize, wchar * out );
+
 /// Applies only full case folding algorithm. This includes simple case, but also
 /// decomposing ligatures and complex letters.
 wstring applyFullCaseOnly( wstring const & );
@@ -67,16 +78,21 @@ wstring trimWhitespaceOrPunct( wstring const & );
 /// the word.
 wstring trimWhitespace( wstring const & );
 
+/// Same as trimWhitespace( wstring ), but narrows the given span down to the
+/// word instead of copying it.
+void trimWhitespace( wchar const * & begin, size_t & size );
+
 /// Turns any sequences of consecutive whitespace into a single basic space.
 void normalizeWhitespace( wstring & );
 
 /// Same as apply( wstring ), but without any heap operations, therefore
-/// preferable when there're many strings to process. Returns -1 if the
-/// operation succeded, or otherwise the minimum value of outSize required
-/// to succeed.
-/// Currently commented out, consider implementing it in case indices'
-/// generation would be too slow.
-//ssize_t apply( wchar const * in, wchar * out, size_t outSize );
+/// preferable when there're many strings to process. Writes the result into
+/// the output buffer and returns its size. If that's more than outSize, only
+/// the first outSize characters were written, and the call is to be repeated
+/// with a buffer that large. A buffer of inSize * MaxFoldedSize characters
+/// is always enough.
+size_t apply( wchar const * in, size_t inSize, wchar * out, size_t outSize,
+              bool preserveWildcards = false );
 
 }
 
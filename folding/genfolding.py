@@ -0,0 +1,363 @@
+#!/usr/bin/env python3
+#
+# Generates the folding tables, inc_case_folding.hh, inc_diacritic_folding.hh
+# and inc_character_classes.hh, from the data files next to this script:
+#
+#   CaseFolding.txt       the case foldings, in Unicode's format
+#   DiacriticFolding.txt  the diacritic foldings
+#   CharacterClasses.txt  the whitespace, the punctuation and the combining
+#                         marks, in the format of Unicode's PropList.txt
+#
+# The tables are written to the directory given, or to the one above this
+# script's. To update the case foldings to a newer Unicode, put its
+# CaseFolding.txt in place of the one here and run the script again.
+
+import os
+import sys
+
+MaxChar = 0x110000
+Pages = MaxChar >> 8
+
+Whitespace, Punctuation, CombiningMark = 1, 2, 4
+
+Header = ('// This file was generated automatically by folding/genfolding.py from the\n'
+          '// data in folding/. Do not edit directly.\n\n')
+
+
+def readData( name ):
+    """Yields the fields of each line of the data file, without the comments."""
+    for line in open( os.path.join( os.path.dirname( os.path.abspath( __file__ ) ), name ),
+                      encoding = 'utf-8' ):
+        line = line.split( '#', 1 )[ 0 ].strip()
+        if line:
+            yield [ field.strip() for field in line.split( ';' ) ]
+
+
+def codes( field ):
+    return [ int( code, 16 ) for code in field.split() ]
+
+
+def readCaseFolding():
+    """Returns the simple and the full foldings, each a dict."""
+    simple, full = {}, {}
+
+    for fields in readData( 'CaseFolding.txt' ):
+        code, status, folding = int( fields[ 0 ], 16 ), fields[ 1 ], codes( fields[ 2 ] )
+
+        if status in ( 'C', 'S' ):
+            simple[ code ] = folding[ 0 ]
+        if status in ( 'C', 'F' ):
+            full[ code ] = folding
+
+    return simple, full
+
+
+def readDiacriticFolding():
+    """Returns the sequences, as tuples, and what they fold to."""
+    sequences = {}
+
+    for fields in readData( 'DiacriticFolding.txt' ):
+        sequences[ tuple( codes( fields[ 0 ] ) ) ] = int( fields[ 1 ], 16 )
+
+    for sequence in sequences:
+        if sequence[ :-1 ] and sequence[ :-1 ] not in sequences:
+            sys.exit( 'DiacriticFolding.txt: %s is listed, but not its start' %
+                      ' '.join( '%04X' % code for code in sequence ) )
+
+    return sequences
+
+
+def readCharacterClasses():
+    """Returns the classes of the characters, as bits."""
+    bits = { 'Whitespace': Whitespace, 'Punctuation': Punctuation,
+             'CombiningMark': CombiningMark }
+    classes = {}
+
+    for fields in readData( 'CharacterClasses.txt' ):
+        first, _, last = fields[ 0 ].partition( '..' )
+
+        for code in range( int( first, 16 ), int( last or first, 16 ) + 1 ):
+            classes[ code ] = classes.get( code, 0 ) | bits[ fields[ 1 ] ]
+
+    return classes
+
+
+def twoStage( values, default ):
+    """Splits the values of all the characters into pages of 256, sharing the
+    same ones. Returns the page of each character's high bits, and the pages."""
+    pages = []
+    index = {}
+    pageOf = []
+
+    for p in range( Pages ):
+        page = tuple( values.get( ( p << 8 ) | x, default ) for x in range( 256 ) )
+        if page not in index:
+            index[ page ] = len( pages )
+            pages.append( page )
+        pageOf.append( index[ page ] )
+
+    return pageOf, pages
+
+
+def formatList( values, perLine, indent = '  ' ):
+    return ',\n'.join( indent + ', '.join( values[ x:x + perLine ] )
+                       for x in range( 0, len( values ), perLine ) )
+
+
+def emitPages( name, valueType, pageOf, pages, format ):
+    if len( pages ) > 256:
+        sys.exit( '%s: too many pages' % name )
+
+    s = 'unsigned char const %sPages[ 0x%X ] =\n{\n' % ( name, Pages )
+    s += formatList( [ str( x ) for x in pageOf ], 24 ) + '\n};\n\n'
+    s += '%s const %sData[][ 256 ] =\n{\n' % ( valueType, name )
+    s += ',\n'.join( '  {\n' + formatList( [ format( v ) for v in page ], 12, '    ' ) + '\n  }'
+                     for page in pages )
+    return s + '\n};\n'
+
+
+def makeCaseFolding( simple, full ):
+    maxOut = max( len( folding ) for folding in full.values() )
+
+    deltas = { code: folded - code for code, folded in simple.items() }
+
+    # The characters whose full folding differs from the simple one
+    expansions = [ [] ]
+    expansionIndex = {}
+
+    for code in range( MaxChar ):
+        folding = full.get( code, [ code ] )
+        if folding != [ simple.get( code, code ) ]:
+            expansionIndex[ code ] = len( expansions )
+            expansions.append( folding )
+
+    if len( expansions ) > 256:
+        sys.exit( 'Too many full case foldings' )
+
+    simplePageOf, simplePages = twoStage( deltas, 0 )
+    expansionPageOf, expansionPages = twoStage( expansionIndex, 0 )
+
+    out = Header
+    out += 'enum { foldCaseMaxOut = %d };\n\n' % maxOut
+    out += ( '// The tables are two-staged: the character\'s high bits select a page,\n'
+             '// and the low byte the entry in it. The same pages are shared, so most of\n'
+             '// the code space maps to a single page of zeros.\n\n' )
+    out += '// What to add to the character to fold its case\n'
+    out += emitPages( 'foldCaseSimple', 'int32_t', simplePageOf, simplePages, str )
+    out += '\n// The characters whose full folding differs from the simple one, as\n'
+    out += '// indices into foldCaseExpansions. Zero stands for none.\n'
+    out += emitPages( 'foldCaseExpansion', 'unsigned char', expansionPageOf, expansionPages, str )
+    out += '\n// The length followed by the characters\n'
+    out += 'wchar const foldCaseExpansions[][ foldCaseMaxOut + 1 ] =\n{\n'
+    out += ',\n'.join( '  { ' + ', '.join( hex( v ) for v in
+                                           [ len( e ) ] + e + [ 0 ] * ( maxOut - len( e ) ) ) + ' }'
+                       for e in expansions )
+    out += '\n};\n\n'
+    out += '''inline wchar foldCaseSimple( wchar in )
+{
+  uint32_t ch = in;
+
+  if ( ch >= 0x%X )
+    return in;
+
+  return in + foldCaseSimpleData[ foldCaseSimplePages[ ch >> 8 ] ][ ch & 0xFF ];
+}
+
+inline size_t foldCase( wchar in, wchar * out )
+{
+  uint32_t ch = in;
+
+  if ( ch < 0x%X )
+  {
+    if ( unsigned char n = foldCaseExpansionData[ foldCaseExpansionPages[ ch >> 8 ] ][ ch & 0xFF ] )
+    {
+      wchar const * expansion = foldCaseExpansions[ n ];
+
+      for( wchar x = 0; x < expansion[ 0 ]; ++x )
+        out[ x ] = expansion[ x + 1 ];
+
+      return expansion[ 0 ];
+    }
+  }
+
+  *out = foldCaseSimple( in );
+  return 1;
+}
+''' % ( MaxChar, MaxChar )
+
+    return out
+
+
+def makeDiacriticFolding( sequences ):
+    maxIn = max( len( sequence ) for sequence in sequences )
+
+    children = {}
+    for sequence in sequences:
+        children.setdefault( sequence[ :-1 ], [] ).append( sequence )
+
+    # The nodes are numbered breadth first, so the children of each node
+    # follow one another. Node 0 stands for none
+    nodeList = [ None ]
+    nodeId = {}
+    firstChild = {}
+
+    def number( sequence ):
+        nodeId[ sequence ] = len( nodeList )
+        nodeList.append( sequence )
+
+    roots = sorted( sequence for sequence in sequences if len( sequence ) == 1 )
+    for sequence in roots:
+        number( sequence )
+
+    queue = list( roots )
+    while queue:
+        nextQueue = []
+        for sequence in queue:
+            nodeChildren = sorted( children.get( sequence, [] ) )
+            firstChild[ sequence ] = len( nodeList )
+            for child in nodeChildren:
+                number( child )
+            nextQueue.extend( nodeChildren )
+        queue = nextQueue
+
+    if len( nodeList ) > 65536:
+        sys.exit( 'Too many diacritic folding sequences' )
+
+    rootPageOf, rootPages = twoStage( { sequence[ 0 ]: nodeId[ sequence ] for sequence in roots }, 0 )
+
+    out = Header
+    out += 'enum { foldDiacriticMaxIn = %d };\n\n' % maxIn
+    out += ( '// The sequences are kept in a trie. Its roots, the nodes of the first\n'
+             '// characters, are found with the two-staged table: the character\'s high\n'
+             '// bits select a page, and the low byte the entry in it. Zero stands for\n'
+             '// none. The children of each node follow one another, sorted by their\n'
+             '// characters.\n\n' )
+    out += emitPages( 'foldDiacriticRoot', 'uint16_t', rootPageOf, rootPages, str )
+    out += '''
+struct FoldDiacriticNode
+{
+  wchar ch; // The last character of the sequence
+  wchar result;
+  uint16_t firstChild, childCount;
+};
+
+FoldDiacriticNode const foldDiacriticNodes[] =
+{
+'''
+    rows = [ '  { 0, 0, 0, 0 }' ]
+    for sequence in nodeList[ 1: ]:
+        nodeChildren = children.get( sequence, [] )
+        rows.append( '  { 0x%x, 0x%x, %d, %d }' %
+                     ( sequence[ -1 ], sequences[ sequence ],
+                       firstChild[ sequence ] if nodeChildren else 0, len( nodeChildren ) ) )
+    out += ',\n'.join( rows ) + '\n};\n\n'
+    out += '''wchar foldDiacritic( wchar const * in, size_t size, size_t & consumed )
+{
+  if ( !size )
+  {
+    consumed = 0;
+    return 0;
+  }
+
+  uint32_t ch = in[ 0 ];
+
+  unsigned node = ch < 0x%X ?
+                  foldDiacriticRootData[ foldDiacriticRootPages[ ch >> 8 ] ][ ch & 0xFF ] : 0;
+
+  consumed = 1;
+
+  if ( !node )
+    return in[ 0 ];
+
+  wchar result = foldDiacriticNodes[ node ].result;
+
+  // Follow the longest sequence
+  for( size_t depth = 1; depth < size; ++depth )
+  {
+    FoldDiacriticNode const * child = foldDiacriticNodes + foldDiacriticNodes[ node ].firstChild;
+    FoldDiacriticNode const * end = child + foldDiacriticNodes[ node ].childCount;
+
+    while( child != end && child->ch < in[ depth ] )
+      ++child;
+
+    if ( child == end || child->ch != in[ depth ] )
+      break;
+
+    node = child - foldDiacriticNodes;
+    result = child->result;
+    consumed = depth + 1;
+  }
+
+  return result;
+}
+''' % MaxChar
+
+    return out
+
+
+def makeCharacterClasses( classes, simple, full, sequences ):
+    pageOf, pages = twoStage( classes, 0 )
+
+    # The runs of ASCII characters are folded in one step by apply(), which
+    # only works if no diacritic folding changes an ASCII character by itself
+    # or goes on with one
+    for sequence in sequences:
+        if len( sequence ) == 1 and sequence[ 0 ] < 128 and sequences[ sequence ] != sequence[ 0 ] or \
+           any( code < 128 for code in sequence[ 1: ] ):
+            sys.exit( 'The diacritic folding of ASCII characters isn\'t supported' )
+
+    ascii = []
+    for code in range( 128 ):
+        if classes.get( code, 0 ) & ( Whitespace | Punctuation ):
+            ascii.append( 0xFF )
+        else:
+            folding = full.get( code, [ code ] )
+            if len( folding ) != 1 or folding[ 0 ] >= 128 or simple.get( code, code ) != folding[ 0 ]:
+                sys.exit( 'The case folding of ASCII characters must stay ASCII' )
+            ascii.append( folding[ 0 ] )
+
+    out = Header
+    out += ( 'enum\n{\n  CharWhitespace = %d,\n  CharPunct = %d,\n  CharCombiningMark = %d\n};\n\n'
+             % ( Whitespace, Punctuation, CombiningMark ) )
+    out += ( '// The classes of the characters. The table is two-staged: the character\'s\n'
+             '// high bits select a page, and the low byte the entry in it.\n' )
+    out += emitPages( 'characterClass', 'unsigned char', pageOf, pages, str )
+    out += '''
+inline unsigned characterClass( wchar in )
+{
+  uint32_t ch = in;
+
+  return ch < 0x%X ? characterClassData[ characterClassPages[ ch >> 8 ] ][ ch & 0xFF ] : 0;
+}
+
+// The ASCII characters with both of the foldings applied, or 0xFF for the
+// whitespace and punctuation
+unsigned char const foldAscii[ 128 ] =
+{
+%s
+};
+''' % ( MaxChar, formatList( [ '0x%02x' % v for v in ascii ], 12 ) )
+
+    return out
+
+
+def main():
+    outDir = sys.argv[ 1 ] if len( sys.argv ) > 1 else \
+             os.path.join( os.path.dirname( os.path.abspath( __file__ ) ), os.pardir )
+
+    simple, full = readCaseFolding()
+    sequences = readDiacriticFolding()
+    classes = readCharacterClasses()
+
+    tables = {
+        'inc_case_folding.hh': makeCaseFolding( simple, full ),
+        'inc_diacritic_folding.hh': makeDiacriticFolding( sequences ),
+        'inc_character_classes.hh': makeCharacterClasses( classes, simple, full, sequences ),
+    }
+
+    for name, text in sorted( tables.items() ):
+        with open( os.path.join( outDir, name ), 'w', newline = '\n' ) as f:
+            f.write( text )
+
+
+main()
@@ -0,0 +1,661 @@
+#include "glswriter.hh"
+#include "stats.hh"
+#include "utf8.hh"
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+#include <zlib.h>
+
+#ifdef __WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#endif
+
+namespace {
+
+#ifdef __WIN32
+
+long sysWrite( int fd, char const * data, size_t size )
+{ return _write( fd, data, size > 0x40000000 ? 0x40000000 : (unsigned) size ); }
+
+int sysSync( int fd )
+{ return _commit( fd ); }
+
+int sysTruncate( int fd, uint64_t size )
+{ return _chsize_s( fd, size ) == 0 ? 0 : -1; }
+
+#else
+
+long sysWrite( int fd, char const * data, size_t size )
+{ return ::write( fd, data, size ); }
+
+int sysSync( int fd )
+{ return fsync( fd ); }
+
+int sysTruncate( int fd, uint64_t size )
+{ return ftruncate( fd, size ); }
+
+#endif
+
+bool endsWith( std::string const & str, char const * suffix )
+{
+  size_t n = strlen( suffix );
+  return str.size() >= n && strcmp( str.c_str() + str.size() - n, suffix ) == 0;
+}
+
+}
+
+/// Compresses the data in independent raw deflate blocks, each ending with a
+/// full flush, so they can be compressed in parallel and just concatenated.
+/// The stream is closed with an empty final block. For the dictzip format,
+/// the blocks are the dictzip chunks, and the final block is left out of the
+/// chunk table. Since the size of the table in the header isn't known until
+/// the end, the compressed data is spooled to a temporary file until then.
+/// The compressing threads are started once, and are given the blocks of
+/// each buffer through a shared queue, as pigz does.
+class GlsWriter::BlockCompressor
+{
+public:
+
+  BlockCompressor( GlsWriter & writer, Format format, unsigned threads );
+  ~BlockCompressor();
+
+  bool compress( char const * data, size_t size );
+  bool finish();
+
+private:
+
+  enum
+  {
+    GzipBlockSize = 256 * 1024,
+    // These are the dictzip ones. A chunk must compress to less than 64 KiB
+    // even if it's incompressible
+    DictzipChunkSize = 58315,
+    // The whole gzip extra field is limited to 64 KiB
+    MaxDictzipChunks = ( 0xFFFF - 10 ) / 2
+  };
+
+  struct Block
+  {
+    char const * data;
+    size_t size;
+    std::vector< unsigned char > compressed;
+    uLong crc;
+    bool failed;
+
+    Block( char const * data_, size_t size_ ):
+      data( data_ ), size( size_ ), crc( 0 ), failed( false )
+    {}
+  };
+
+  /// A raw deflate stream, set up once for each thread and reset for each
+  /// block.
+  class Deflater
+  {
+  public:
+
+    explicit Deflater( Format format );
+    ~Deflater();
+
+    void compress( Block & block );
+
+  private:
+
+    Deflater( Deflater const & );
+    void operator = ( Deflater const & );
+
+    Format format;
+    z_stream stream;
+    bool initialized;
+  };
+
+  void workerThread();
+  /// Compresses the blocks, the calling thread together with the workers.
+  bool writeBlocks();
+  bool writeData( void const * data, size_t size );
+  bool writeHeader();
+
+  GlsWriter & writer;
+  Format format;
+  unsigned threads;
+  size_t blockSize;
+  std::vector< char > partial; // The incomplete last block
+  std::vector< Block > blocks;
+  FILE * spool;
+  bool headerWritten;
+  uLong crc;
+  uint64_t totalSize;
+  std::vector< uint16_t > chunkSizes;
+
+  Deflater deflater; // The calling thread's one
+
+  // The queue, protected by the mutex. The blocks below queuedBlocks are
+  // the current buffer's ones, and the ones from nextBlock on are waiting
+  // to be taken
+  std::mutex mutex;
+  std::condition_variable blocksQueued, blocksDone;
+  size_t queuedBlocks, nextBlock, blocksLeft;
+  bool stopping;
+
+  std::vector< std::thread > workers;
+};
+
+GlsWriter::BlockCompressor::Deflater::Deflater( Format format_ ): format( format_ )
+{
+  memset( &stream, 0, sizeof( stream ) );
+
+  initialized = deflateInit2( &stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                              -MAX_WBITS, 8, Z_DEFAULT_STRATEGY ) == Z_OK;
+}
+
+GlsWriter::BlockCompressor::Deflater::~Deflater()
+{
+  if ( initialized )
+    deflateEnd( &stream );
+}
+
+void GlsWriter::BlockCompressor::Deflater::compress( Block & block )
+{
+  block.crc = crc32( 0, (Bytef const *) block.data, block.size );
+
+  // The full flush adds an empty stored block to what deflateBound() allows
+  block.compressed.resize( initialized ? deflateBound( &stream, block.size ) + 16 : 0 );
+
+  stream.next_in = (Bytef *) block.data;
+  stream.avail_in = block.size;
+  stream.next_out = block.compressed.data();
+  stream.avail_out = block.compressed.size();
+
+  block.failed = !initialized ||
+                 deflate( &stream, Z_FULL_FLUSH ) != Z_OK ||
+                 stream.avail_in || !stream.avail_out ||
+                 // Dictzip chunks must fit in the reader's buffer
+                 ( format == Dictzip && stream.total_out >= 0xFFFF );
+
+  block.compressed.resize( stream.total_out );
+
+  if ( initialized )
+    deflateReset( &stream );
+}
+
+GlsWriter::BlockCompressor::BlockCompressor( GlsWriter & writer_, Format format_,
+                                             unsigned threads_ ):
+  writer( writer_ ), format( format_ ), threads( threads_ ? threads_ : 1 ),
+  blockSize( format == Dictzip ? DictzipChunkSize : GzipBlockSize ),
+  spool( 0 ), headerWritten( false ), crc( crc32( 0, Z_NULL, 0 ) ), totalSize( 0 ),
+  deflater( format ), queuedBlocks( 0 ), nextBlock( 0 ), blocksLeft( 0 ), stopping( false )
+{
+  partial.reserve( blockSize );
+
+  for( unsigned x = 1; x < threads; ++x )
+    workers.push_back( std::thread( &BlockCompressor::workerThread, this ) );
+}
+
+GlsWriter::BlockCompressor::~BlockCompressor()
+{
+  {
+    std::lock_guard< std::mutex > lock( mutex );
+    stopping = true;
+  }
+
+  blocksQueued.notify_all();
+
+  for( size_t x = 0; x < workers.size(); ++x )
+    workers[ x ].join();
+
+  if ( spool )
+    fclose( spool );
+}
+
+bool GlsWriter::BlockCompressor::compress( char const * data, size_t size )
+{
+  blocks.clear();
+
+  if ( !partial.empty() )
+  {
+    size_t toAdd = std::min( size, blockSize - partial.size() );
+    partial.insert( partial.end(), data, data + toAdd );
+    data += toAdd;
+    size -= toAdd;
+
+    if ( partial.size() < blockSize )
+      return true;
+
+    blocks.push_back( Block( &partial.front(), partial.size() ) );
+  }
+
+  for( ; size >= blockSize; data += blockSize, size -= blockSize )
+  {
+    blocks.push_back( Block( data, blockSize ) );
+  }
+
+  bool result = writeBlocks();
+
+  partial.assign( data, data + size );
+
+  return result;
+}
+
+bool GlsWriter::BlockCompressor::finish()
+{
+  blocks.clear();
+
+  // The dictzip reader wants at least one chunk
+  if ( !partial.empty() || ( format == Dictzip && chunkSizes.empty() ) )
+  {
+    blocks.push_back( Block( partial.data(), partial.size() ) );
+  }
+
+  if ( !writeBlocks() ||
+       ( !headerWritten && format != Dictzip && !writeHeader() ) )
+    return false;
+
+  // An empty final block with the fixed codes, which is what deflate()
+  // produces on Z_FINISH with no input left
+  static unsigned char const finalBlock[] = { 0x03, 0x00 };
+
+  unsigned char trailer[ 8 ];
+  for( int x = 0; x < 4; ++x )
+  {
+    trailer[ x ] = ( crc >> ( x * 8 ) ) & 0xFF;
+    trailer[ x + 4 ] = ( totalSize >> ( x * 8 ) ) & 0xFF;
+  }
+
+  if ( !writeData( finalBlock, sizeof( finalBlock ) ) ||
+       !writeData( trailer, sizeof( trailer ) ) )
+    return false;
+
+  if ( format != Dictzip )
+    return true;
+
+  // Now that the chunk table is complete, write the header and copy the
+  // spooled data after it
+  if ( !writeHeader() || fflush( spool ) != 0 )
+    return false;
+
+  rewind( spool );
+
+  std::vector< char > buffer( 1024 * 1024 );
+
+  for( ; ; )
+  {
+    size_t n = fread( &buffer.front(), 1, buffer.size(), spool );
+
+    if ( !n )
+      break;
+
+    if ( !writer.writeAll( &buffer.front(), n ) )
+      return false;
+  }
+
+  return !ferror( spool );
+}
+
+bool GlsWriter::BlockCompressor::writeBlocks()
+{
+  if ( blocks.empty() )
+    return true;
+
+  std::unique_lock< std::mutex > lock( mutex );
+
+  queuedBlocks = blocks.size();
+  nextBlock = 0;
+  blocksLeft = blocks.size();
+
+  if ( blocks.size() > 1 )
+    blocksQueued.notify_all();
+
+  while( nextBlock < queuedBlocks )
+  {
+    size_t x = nextBlock++;
+
+    lock.unlock();
+    deflater.compress( blocks[ x ] );
+    lock.lock();
+
+    --blocksLeft;
+  }
+
+  // Wait for the blocks the workers have taken
+  while( blocksLeft )
+    blocksDone.wait( lock );
+
+  lock.unlock();
+
+  if ( !headerWritten && format != Dictzip && !writeHeader() )
+    return false;
+
+  for( size_t x = 0; x < blocks.size(); ++x )
+  {
+    Block const & block = blocks[ x ];
+
+    if ( block.failed )
+    {
+      errno = ENOMEM;
+      return false;
+    }
+
+    if ( format == Dictzip )
+    {
+      if ( chunkSizes.size() >= MaxDictzipChunks )
+      {
+        errno = EFBIG;
+        return false;
+      }
+
+      chunkSizes.push_back( block.compressed.size() );
+    }
+
+    if ( !writeData( block.compressed.data(), block.compressed.size() ) )
+      return false;
+
+    crc = crc32_combine( crc, block.crc, block.size );
+    totalSize += block.size;
+  }
+
+  return true;
+}
+
+void GlsWriter::BlockCompressor::workerThread()
+{
+  Deflater workerDeflater( format );
+
+  std::unique_lock< std::mutex > lock( mutex );
+
+  for( ;; )
+  {
+    while( nextBlock >= queuedBlocks && !stopping )
+      blocksQueued.wait( lock );
+
+    if ( nextBlock >= queuedBlocks )
+      break;
+
+    size_t x = nextBlock++;
+
+    lock.unlock();
+    workerDeflater.compress( blocks[ x ] );
+    lock.lock();
+
+    if ( !--blocksLeft )
+      blocksDone.notify_one();
+  }
+}
+
+bool GlsWriter::BlockCompressor::writeData( void const * data, size_t size )
+{
+  if ( format != Dictzip )
+    return writer.writeAll( (char const *) data, size );
+
+  if ( !spool && !( spool = tmpfile() ) )
+    return false;
+
+  return fwrite( data, 1, size, spool ) == size;
+}
+
+bool GlsWriter::BlockCompressor::writeHeader()
+{
+  // See RFC 1952. The dictzip random access data goes into the extra field
+  std::vector< unsigned char > header;
+
+  header.push_back( 0x1F );
+  header.push_back( 0x8B );
+  header.push_back( Z_DEFLATED );
+  header.push_back( format == Dictzip ? 0x04 : 0 ); // FEXTRA
+  header.insert( header.end(), 4, 0 ); // No modification time
+  header.push_back( 0 );
+#ifdef __WIN32
+  header.push_back( 0 ); // FAT filesystem, as gzip says for Windows
+#else
+  header.push_back( 3 ); // Unix
+#endif
+
+  if ( format == Dictzip )
+  {
+    size_t subLength = 6 + chunkSizes.size() * 2;
+
+    uint16_t fields[] = { uint16_t( subLength + 4 ), 'R' | ( 'A' << 8 ),
+                          uint16_t( subLength ), 1, DictzipChunkSize,
+                          uint16_t( chunkSizes.size() ) };
+
+    for( size_t x = 0; x < sizeof( fields ) / sizeof( *fields ); ++x )
+    {
+      header.push_back( fields[ x ] & 0xFF );
+      header.push_back( fields[ x ] >> 8 );
+    }
+
+    for( size_t x = 0; x < chunkSizes.size(); ++x )
+    {
+      header.push_back( chunkSizes[ x ] & 0xFF );
+      header.push_back( chunkSizes[ x ] >> 8 );
+    }
+  }
+
+  headerWritten = true;
+
+  return writer.writeAll( (char const *) header.data(), header.size() );
+}
+
+GlsWriter::Format GlsWriter::formatFor( std::string const & fileName )
+{
+  if ( endsWith( fileName, ".gz" ) || endsWith( fileName, ".GZ" ) )
+    return Gzip;
+
+  if ( endsWith( fileName, ".dz" ) || endsWith( fileName, ".DZ" ) )
+    return Dictzip;
+
+  return Plain;
+}
+
+GlsWriter::GlsWriter( int fd_, Format format_, unsigned threads, size_t bufferSize ):
+  fd( fd_ ), format( format_ ), syncPolicy( SyncNever ), dropWrittenPages( false ),
+  preallocated( 0 ),
+  current( bufferSize ), currentUsed( 0 ), bytesWritten( 0 ),
+  pending( bufferSize ), pendingUsed( 0 ), stopping( false ), error( 0 ),
+  fileOffset( 0 ), lastFlushOffset( 0 ), lastFlushSize( 0 ),
+  compressor( format == Plain ? 0 : new BlockCompressor( *this, format, threads ) ),
+  writer( &GlsWriter::writerThread, this )
+{
+}
+
+GlsWriter::~GlsWriter()
+{
+  stopWriter();
+}
+
+void GlsWriter::preallocate( uint64_t expectedSize )
+{
+#if defined( __linux__ ) || defined( __FreeBSD__ )
+  // The writer thread hasn't got anything to write yet, so the file is
+  // still empty here
+  if ( format == Plain && !bytesWritten && !currentUsed && expectedSize &&
+       posix_fallocate( fd, 0, expectedSize ) == 0 )
+    preallocated = expectedSize;
+#else
+  (void) expectedSize;
+#endif
+}
+
+char * GlsWriter::reserve( size_t size ) throw( exWriteError )
+{
+  if ( current.size() - currentUsed < size )
+  {
+    if ( currentUsed )
+      handOff();
+
+    // Something bigger than the whole buffer
+    if ( current.size() < size )
+      current.resize( size );
+  }
+
+  return &current[ currentUsed ];
+}
+
+void GlsWriter::write( char const * data, size_t size ) throw( exWriteError )
+{
+  if ( !size )
+    return;
+
+  memcpy( reserve( size ), data, size );
+  currentUsed += size;
+}
+
+void GlsWriter::writeUtf8( gd::wstring const & str ) throw( exWriteError )
+{
+  if ( str.empty() )
+    return;
+
+  currentUsed += Utf8::encode( str.data(), str.size(), reserve( str.size() * 4 ) );
+}
+
+void GlsWriter::handOff() throw( exWriteError )
+{
+  std::unique_lock< std::mutex > lock( mutex );
+
+  if ( pendingUsed )
+  {
+    // The time the caller is held up by the writer thread, for --stats
+    Stats::Timer timer( Stats::WaitingForWriter );
+
+    while( pendingUsed )
+      writerIdle.wait( lock );
+  }
+
+  if ( error )
+    throw exWriteError( strerror( error ) );
+
+  if ( !currentUsed )
+    return;
+
+  current.swap( pending );
+  pendingUsed = currentUsed;
+  bytesWritten += currentUsed;
+  currentUsed = 0;
+
+  wakeWriter.notify_one();
+}
+
+void GlsWriter::finish() throw( exWriteError )
+{
+  handOff();
+  stopWriter();
+
+  if ( !error && compressor && !compressor->finish() )
+    error = errno ? errno : EIO;
+
+  if ( !error && preallocated > fileOffset && sysTruncate( fd, fileOffset ) != 0 )
+    error = errno;
+
+  if ( !error && syncPolicy != SyncNever && !syncFile() )
+    error = errno;
+
+  if ( error )
+    throw exWriteError( strerror( error ) );
+}
+
+void GlsWriter::stopWriter()
+{
+  if ( !writer.joinable() )
+    return;
+
+  {
+    std::lock_guard< std::mutex > lock( mutex );
+    stopping = true;
+  }
+
+  wakeWriter.notify_one();
+  writer.join();
+}
+
+void GlsWriter::writerThread()
+{
+  std::unique_lock< std::mutex > lock( mutex );
+
+  for( ;; )
+  {
+    while( !pendingUsed && !stopping )
+      wakeWriter.wait( lock );
+
+    if ( !pendingUsed )
+      break;
+
+    bool failed = error != 0;
+    int newError = 0;
+
+    lock.unlock();
+
+    if ( !failed )
+    {
+      uint64_t flushOffset = fileOffset;
+
+      if ( !output( &pending.front(), pendingUsed ) ||
+           ( syncPolicy == SyncEachBuffer && !syncFile() ) )
+        newError = errno ? errno : EIO;
+      else
+      {
+#ifdef POSIX_FADV_DONTNEED
+        // The previous buffer has most likely reached the disk by now, so
+        // its pages can go
+        if ( dropWrittenPages && lastFlushSize )
+          posix_fadvise( fd, lastFlushOffset, lastFlushSize, POSIX_FADV_DONTNEED );
+#endif
+        lastFlushOffset = flushOffset;
+        lastFlushSize = fileOffset - flushOffset;
+      }
+    }
+
+    lock.lock();
+
+    if ( newError )
+      error = newError;
+
+    pendingUsed = 0;
+    writerIdle.notify_one();
+  }
+}
+
+bool GlsWriter::output( char const * data, size_t size )
+{
+  errno = 0;
+
+  if ( compressor )
+    return compressor->compress( data, size );
+
+  return writeAll( data, size );
+}
+
+bool GlsWriter::writeAll( char const * data, size_t size )
+{
+  while( size )
+  {
+    long written = sysWrite( fd, data, size );
+
+    if ( written < 0 )
+    {
+      if ( errno == EINTR )
+        continue;
+      return false;
+    }
+
+    if ( written == 0 )
+    {
+      errno = ENOSPC;
+      return false;
+    }
+
+    data += written;
+    size -= written;
+    fileOffset += written;
+  }
+
+  return true;
+}
+
+bool GlsWriter::syncFile()
+{
+  return sysSync( fd ) == 0;
+}
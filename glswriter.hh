@@ -0,0 +1,149 @@
+#ifndef __GLSWRITER_HH_INCLUDED__
+#define __GLSWRITER_HH_INCLUDED__
+
+#include <stdint.h>
+#include <string>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "ex.hh"
+#include "wstring.hh"
+
+/// Writes the output file from a separate thread. The data is collected in
+/// one large buffer while the other one is being written out, so the disk
+/// writes overlap with the rendering instead of stalling it. The file must
+/// be opened in binary mode, and stay open until finish() returns.
+/// The output can also be gzip-compressed on the fly, in independent blocks
+/// which are compressed on several threads at once.
+class GlsWriter
+{
+public:
+
+  DEF_EX( Ex, "GLS writer exception", std::exception )
+  DEF_EX_STR( exWriteError, "Can't write the output file:", Ex )
+
+  enum SyncPolicy
+  {
+    /// Leave it to the OS
+    SyncNever,
+    /// Sync the file once everything is written
+    SyncAtEnd,
+    /// Sync after each buffer, so that little unwritten data is ever pending
+    SyncEachBuffer
+  };
+
+  enum Format
+  {
+    Plain,
+    /// A regular .gz file
+    Gzip,
+    /// A .dz file, which is a .gz file with the random access chunk table in
+    /// its header, in the layout dictzip.c reads. It is limited to somewhat
+    /// less than 2 GB of uncompressed data by the size of the table.
+    Dictzip
+  };
+
+  enum
+  {
+    DefaultBufferSize = 4 * 1024 * 1024
+  };
+
+  /// Compresses the data on the given number of threads, unless the format
+  /// is Plain.
+  explicit GlsWriter( int fd, Format format = Plain, unsigned threads = 1,
+                      size_t bufferSize = DefaultBufferSize );
+
+  /// Picks the format by the file name -- .gz and .dz files are compressed.
+  static Format formatFor( std::string const & fileName );
+
+  /// Writes out what was handed to the writer thread and stops it. Unlike
+  /// finish(), doesn't write the data still being collected.
+  ~GlsWriter();
+
+  void setSyncPolicy( SyncPolicy policy )
+  { syncPolicy = policy; }
+
+  /// Tells the OS the written data won't be read back, so it doesn't push
+  /// everything else out of the page cache. Only has effect where
+  /// posix_fadvise() is available.
+  void setDropWrittenPages( bool drop )
+  { dropWrittenPages = drop; }
+
+  /// Reserves the disk space for the expected size of the output, to keep the
+  /// file less fragmented. The file is cut down to the actual size by
+  /// finish(). Only has effect where posix_fallocate() is available, and
+  /// for the Plain format.
+  void preallocate( uint64_t expectedSize );
+
+  void write( char const * data, size_t size ) throw( exWriteError );
+
+  void write( std::string const & str ) throw( exWriteError )
+  { write( str.data(), str.size() ); }
+
+  void write( char c ) throw( exWriteError )
+  { write( &c, 1 ); }
+
+  /// Writes the string in UTF-8, encoding it right into the buffer.
+  void writeUtf8( gd::wstring const & ) throw( exWriteError );
+
+  /// Writes out all the data and waits for it to be done. Must be called
+  /// once the output is complete, since the write errors are reported here.
+  void finish() throw( exWriteError );
+
+  uint64_t getBytesWritten() const
+  { return bytesWritten; }
+
+private:
+
+  class BlockCompressor;
+
+  GlsWriter( GlsWriter const & );
+  void operator = ( GlsWriter const & );
+
+  /// Makes room for the given number of bytes in the current buffer.
+  char * reserve( size_t size ) throw( exWriteError );
+
+  /// Passes the current buffer to the writer thread, waiting for it to be
+  /// done with the previous one.
+  void handOff() throw( exWriteError );
+
+  void writerThread();
+  /// Writes or compresses the data handed to the writer thread.
+  bool output( char const * data, size_t size );
+  bool writeAll( char const * data, size_t size );
+  bool syncFile();
+  void stopWriter();
+
+  int fd;
+  Format format;
+  SyncPolicy syncPolicy;
+  bool dropWrittenPages;
+  uint64_t preallocated;
+
+  // Used by the caller only
+  std::vector< char > current;
+  size_t currentUsed;
+  uint64_t bytesWritten;
+
+  // Protected by the mutex
+  std::vector< char > pending;
+  size_t pendingUsed;
+  bool stopping;
+  int error;
+
+  // Used by the writer thread only
+  uint64_t fileOffset;
+  uint64_t lastFlushOffset, lastFlushSize;
+
+  // Used by the writer thread, and by finish() after it is stopped
+  std::unique_ptr< BlockCompressor > compressor;
+
+  std::mutex mutex;
+  std::condition_variable wakeWriter, writerIdle;
+  std::thread writer;
+};
+
+#endif
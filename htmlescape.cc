@@ -10,36 +10,49 @@ namespace Html {
 
 string escape( string const & str )
 {
-  string result( str );
+  string result;
 
-  for( size_t x = result.size(); x--; )
-    switch ( result[ x ] )
+  result.reserve( str.size() );
+  escapeAppend( result, str.data(), str.size() );
+
+  return result;
+}
+
+void escapeAppend( string & result, char const * text, size_t size )
+{
+  char const * end = text + size;
+
+  for( ; ; )
+  {
+    char const * run = text;
+
+    while( text != end && *text != '&' && *text != '<' && *text != '>' && *text != '"' )
+      ++text;
+
+    result.append( run, text - run );
+
+    if ( text == end )
+      break;
+
+    switch ( *text++ )
     {
       case '&':
-        result.erase( x, 1 );
-        result.insert( x, "&amp;" );
+        result += "&amp;";
       break;
 
       case '<':
-        result.erase( x, 1 );
-        result.insert( x, "&lt;" );
+        result += "&lt;";
       break;
 
       case '>':
-        result.erase( x, 1 );
-        result.insert( x, "&gt;" );
-      break;
-
-      case '"':
-        result.erase( x, 1 );
-        result.insert( x, "&quot;" );
+        result += "&gt;";
       break;
 
       default:
+        result += "&quot;";
       break;
     }
-
-  return result;
+  }
 }
 
 static void storeLineInDiv( string & result, string const & line, bool baseRightToLeft )
@@ -15,6 +15,10 @@ using std::string;
 // to make the result suitable for inserting as attributes' values.
 string escape( string const & );
 
+// Appends the given text to the result, escaped the same way. The runs of the
+// text needing no escaping are appended as they are, in one go each.
+void escapeAppend( string & result, char const * text, size_t size );
+
 // Converts the given preformatted text to html. Each end of line is replaced by
 // <br>, each leading space is converted to &nbsp;.
 string preformat( string const &, bool baseRightToLeft = false );
@@ -1,4854 +1,2280 @@
-// This file was generated automatically. Do not edit directly.
+// This file was generated automatically by folding/genfolding.py from the
+// data in folding/. Do not edit directly.
 
 enum { foldDiacriticMaxIn = 3 };
 
+// The sequences are kept in a trie. Its roots, the nodes of the first
+// characters, are found with the two-staged table: the character's high
+// bits select a page, and the low byte the entry in it. Zero stands for
+// none. The children of each node follow one another, sorted by their
+// characters.
+
+unsigned char const foldDiacriticRootPages[ 0x1100 ] =
+{
+  0, 1, 2, 3, 4, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 7, 8, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 9, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6
+};
+
+uint16_t const foldDiacriticRootData[][ 256 ] =
+{
+  {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 0, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 0, 0, 0, 0, 0,
+    0, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 0, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62,
+    63, 64, 65, 66, 0, 67, 68, 69, 70, 71, 72, 0,
+    73, 74, 75, 76, 77, 78, 0, 0, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94,
+    0, 95, 96, 97, 98, 99, 100, 0, 101, 102, 103, 104,
+    105, 106, 0, 107
+  },
+  {
+    108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+    120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+    132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155,
+    156, 0, 0, 0, 157, 158, 159, 160, 0, 161, 162, 163,
+    164, 165, 166, 0, 167, 168, 169, 170, 171, 172, 173, 174,
+    175, 0, 0, 0, 176, 177, 178, 179, 180, 181, 0, 0,
+    182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+    194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205,
+    206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
+    218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229,
+    0, 0, 0, 230, 231, 0, 232, 233, 234, 0, 0, 0,
+    0, 235, 236, 237, 0, 0, 0, 238, 239, 240, 241, 0,
+    0, 242, 243, 244, 245, 246, 0, 0, 247, 248, 0, 0,
+    0, 0, 0, 249, 250, 251, 252, 253, 254, 0, 255, 256,
+    257, 258, 259, 260, 0, 0, 261, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272,
+    273, 274, 275, 276, 277, 0, 278, 279, 280, 281, 282, 283,
+    284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295,
+    296, 0, 0, 0, 297, 298, 0, 0, 299, 300, 301, 302,
+    303, 304, 305, 306
+  },
+  {
+    307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318,
+    319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330,
+    331, 332, 333, 334, 0, 0, 335, 336, 337, 338, 0, 0,
+    339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350,
+    351, 352, 353, 354, 355, 356, 357, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 358,
+    0, 359, 360, 361, 0, 0, 362, 0, 0, 0, 0, 0,
+    363, 0, 0, 0, 0, 0, 364, 0, 365, 0, 0, 366,
+    367, 368, 0, 0, 0, 369, 370, 371, 0, 0, 0, 0,
+    0, 0, 0, 0, 372, 373, 0, 0, 0, 0, 374, 0,
+    0, 0, 375, 0, 376, 0, 0, 377, 0, 0, 0, 0,
+    378, 379, 380, 381, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 382, 0, 0, 383, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 384, 0, 385, 386, 387, 0, 388, 0, 389, 390,
+    391, 392, 0, 0, 0, 393, 0, 394, 0, 395, 0, 0,
+    0, 0, 0, 396, 0, 397, 0, 0, 0, 398, 0, 0,
+    0, 399, 400, 401, 402, 403, 404, 405, 406, 407, 0, 0,
+    0, 408, 0, 409, 0, 410, 0, 0, 0, 0, 0, 411,
+    0, 412, 0, 0, 0, 413, 0, 0, 0, 414, 415, 416,
+    417, 418, 419, 0, 0, 0, 420, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0
+  },
+  {
+    421, 422, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 423, 0, 0, 424, 0, 0, 0, 0, 425, 426, 427,
+    428, 0, 0, 0, 0, 0, 429, 0, 0, 0, 0, 430,
+    0, 0, 0, 431, 0, 0, 0, 432, 0, 433, 0, 0,
+    434, 0, 0, 0, 0, 435, 436, 437, 438, 0, 0, 0,
+    0, 0, 439, 0, 0, 0, 0, 440, 0, 0, 0, 441,
+    0, 0, 0, 442, 0, 443, 0, 0, 444, 445, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 447, 448, 449, 450,
+    0, 0, 0, 0, 451, 452, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 453, 454, 0, 0, 455, 456,
+    457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468,
+    469, 470, 471, 472, 0, 0, 473, 474, 0, 0, 475, 476,
+    0, 0, 477, 478, 479, 480, 0, 0, 481, 482, 483, 484,
+    0, 0, 485, 486, 487, 488, 0, 0, 0, 0, 489, 490,
+    0, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501,
+    502, 503, 504, 0, 505, 506, 507, 508, 0, 0, 509, 510,
+    511, 512, 513, 514, 515, 516, 517, 518, 0, 0, 519, 520,
+    521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532,
+    533, 534, 535, 536, 537, 538, 0, 0, 539, 540, 0, 0,
+    0, 0, 0, 0
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 541, 542, 543, 544, 545, 546, 547, 0,
+    548, 549, 550, 551, 552, 0, 553, 0, 554, 555, 0, 556,
+    557, 0, 558, 559, 560, 561, 562, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0
+  },
+  {
+    563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574,
+    575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586,
+    587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598,
+    599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610,
+    611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622,
+    623, 624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634,
+    635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646,
+    647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658,
+    659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670,
+    671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682,
+    683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706,
+    707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718,
+    0, 0, 0, 0, 719, 720, 721, 722, 723, 724, 725, 726,
+    727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737, 738,
+    739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750,
+    751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762,
+    763, 764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774,
+    775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785, 786,
+    787, 788, 789, 790, 791, 792, 793, 794, 795, 796, 797, 798,
+    799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 0, 0,
+    0, 0, 0, 0
+  },
+  {
+    809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820,
+    821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 0, 0,
+    831, 832, 833, 834, 835, 836, 0, 0, 837, 838, 839, 840,
+    841, 842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852,
+    853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864,
+    865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 0, 0,
+    875, 876, 877, 878, 879, 880, 0, 0, 881, 882, 883, 884,
+    885, 886, 887, 888, 0, 889, 0, 890, 0, 891, 0, 892,
+    893, 894, 895, 896, 897, 898, 899, 900, 901, 902, 903, 904,
+    905, 906, 907, 908, 909, 910, 911, 912, 913, 914, 915, 916,
+    917, 918, 919, 920, 921, 922, 0, 0, 923, 924, 925, 926,
+    927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938,
+    939, 940, 941, 942, 943, 944, 945, 946, 947, 948, 949, 950,
+    951, 952, 953, 954, 955, 956, 957, 958, 959, 960, 961, 962,
+    963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974,
+    975, 0, 976, 977, 978, 979, 980, 981, 982, 0, 0, 0,
+    0, 0, 983, 984, 985, 0, 986, 987, 988, 989, 990, 991,
+    992, 0, 0, 0, 993, 994, 995, 996, 0, 0, 997, 998,
+    999, 1000, 1001, 1002, 0, 0, 0, 0, 1003, 1004, 1005, 1006,
+    1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 0, 0, 0,
+    0, 0, 1016, 1017, 1018, 0, 1019, 1020, 1021, 1022, 1023, 1024,
+    1025, 0, 0, 0
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1026, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1027, 1028, 1029, 1030, 1031, 1032,
+    1033, 1034, 1035, 1036, 1037, 1038, 1039, 0, 1040, 1041, 1042, 1043,
+    1044, 0, 1045, 0, 1046, 1047, 0, 1048, 1049, 0, 1050, 1051,
+    1052, 1053, 1054, 1055, 1056, 1057, 1058, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0
+  }
+};
+
+struct FoldDiacriticNode
+{
+  wchar ch; // The last character of the sequence
+  wchar result;
+  uint16_t firstChild, childCount;
+};
+
+FoldDiacriticNode const foldDiacriticNodes[] =
+{
+  { 0, 0, 0, 0 },
+  { 0x41, 0x41, 1059, 16 },
+  { 0x42, 0x42, 1075, 3 },
+  { 0x43, 0x43, 1078, 5 },
+  { 0x44, 0x44, 1083, 6 },
+  { 0x45, 0x45, 1089, 17 },
+  { 0x46, 0x46, 1106, 1 },
+  { 0x47, 0x47, 1107, 7 },
+  { 0x48, 0x48, 1114, 7 },
+  { 0x49, 0x49, 1121, 15 },
+  { 0x4a, 0x4a, 1136, 1 },
+  { 0x4b, 0x4b, 1137, 5 },
+  { 0x4c, 0x4c, 1142, 6 },
+  { 0x4d, 0x4d, 1148, 3 },
+  { 0x4e, 0x4e, 1151, 9 },
+  { 0x4f, 0x4f, 1160, 16 },
+  { 0x50, 0x50, 1176, 2 },
+  { 0x52, 0x52, 1178, 8 },
+  { 0x53, 0x53, 1186, 7 },
+  { 0x54, 0x54, 1193, 7 },
+  { 0x55, 0x55, 1200, 19 },
+  { 0x56, 0x56, 1219, 2 },
+  { 0x57, 0x57, 1221, 6 },
+  { 0x58, 0x58, 1227, 2 },
+  { 0x59, 0x59, 1229, 9 },
+  { 0x5a, 0x5a, 1238, 6 },
+  { 0x61, 0x61, 1244, 16 },
+  { 0x62, 0x62, 1260, 3 },
+  { 0x63, 0x63, 1263, 5 },
+  { 0x64, 0x64, 1268, 6 },
+  { 0x65, 0x65, 1274, 17 },
+  { 0x66, 0x66, 1291, 1 },
+  { 0x67, 0x67, 1292, 7 },
+  { 0x68, 0x68, 1299, 8 },
+  { 0x69, 0x69, 1307, 14 },
+  { 0x6a, 0x6a, 1321, 2 },
+  { 0x6b, 0x6b, 1323, 5 },
+  { 0x6c, 0x6c, 1328, 6 },
+  { 0x6d, 0x6d, 1334, 3 },
+  { 0x6e, 0x6e, 1337, 9 },
+  { 0x6f, 0x6f, 1346, 16 },
+  { 0x70, 0x70, 1362, 2 },
+  { 0x72, 0x72, 1364, 8 },
+  { 0x73, 0x73, 1372, 7 },
+  { 0x74, 0x74, 1379, 8 },
+  { 0x75, 0x75, 1387, 19 },
+  { 0x76, 0x76, 1406, 2 },
+  { 0x77, 0x77, 1408, 7 },
+  { 0x78, 0x78, 1415, 2 },
+  { 0x79, 0x79, 1417, 10 },
+  { 0x7a, 0x7a, 1427, 6 },
+  { 0xc0, 0x41, 0, 0 },
+  { 0xc1, 0x41, 0, 0 },
+  { 0xc2, 0x41, 0, 0 },
+  { 0xc3, 0x41, 0, 0 },
+  { 0xc4, 0x41, 0, 0 },
+  { 0xc5, 0x41, 0, 0 },
+  { 0xc6, 0xc6, 1433, 2 },
+  { 0xc7, 0x43, 0, 0 },
+  { 0xc8, 0x45, 0, 0 },
+  { 0xc9, 0x45, 0, 0 },
+  { 0xca, 0x45, 0, 0 },
+  { 0xcb, 0x45, 0, 0 },
+  { 0xcc, 0x49, 0, 0 },
+  { 0xcd, 0x49, 0, 0 },
+  { 0xce, 0x49, 0, 0 },
+  { 0xcf, 0x49, 0, 0 },
+  { 0xd1, 0x4e, 0, 0 },
+  { 0xd2, 0x4f, 0, 0 },
+  { 0xd3, 0x4f, 0, 0 },
+  { 0xd4, 0x4f, 0, 0 },
+  { 0xd5, 0x4f, 0, 0 },
+  { 0xd6, 0x4f, 0, 0 },
+  { 0xd8, 0x4f, 1435, 1 },
+  { 0xd9, 0x55, 0, 0 },
+  { 0xda, 0x55, 0, 0 },
+  { 0xdb, 0x55, 0, 0 },
+  { 0xdc, 0x55, 0, 0 },
+  { 0xdd, 0x59, 0, 0 },
+  { 0xe0, 0x61, 0, 0 },
+  { 0xe1, 0x61, 0, 0 },
+  { 0xe2, 0x61, 0, 0 },
+  { 0xe3, 0x61, 0, 0 },
+  { 0xe4, 0x61, 0, 0 },
+  { 0xe5, 0x61, 0, 0 },
+  { 0xe6, 0xe6, 1436, 2 },
+  { 0xe7, 0x63, 0, 0 },
+  { 0xe8, 0x65, 0, 0 },
+  { 0xe9, 0x65, 0, 0 },
+  { 0xea, 0x65, 0, 0 },
+  { 0xeb, 0x65, 0, 0 },
+  { 0xec, 0x69, 0, 0 },
+  { 0xed, 0x69, 0, 0 },
+  { 0xee, 0x69, 0, 0 },
+  { 0xef, 0x69, 0, 0 },
+  { 0xf1, 0x6e, 0, 0 },
+  { 0xf2, 0x6f, 0, 0 },
+  { 0xf3, 0x6f, 0, 0 },
+  { 0xf4, 0x6f, 0, 0 },
+  { 0xf5, 0x6f, 0, 0 },
+  { 0xf6, 0x6f, 0, 0 },
+  { 0xf8, 0x6f, 1438, 1 },
+  { 0xf9, 0x75, 0, 0 },
+  { 0xfa, 0x75, 0, 0 },
+  { 0xfb, 0x75, 0, 0 },
+  { 0xfc, 0x75, 0, 0 },
+  { 0xfd, 0x79, 0, 0 },
+  { 0xff, 0x79, 0, 0 },
+  { 0x100, 0x41, 0, 0 },
+  { 0x101, 0x61, 0, 0 },
+  { 0x102, 0x41, 0, 0 },
+  { 0x103, 0x61, 0, 0 },
+  { 0x104, 0x41, 0, 0 },
+  { 0x105, 0x61, 0, 0 },
+  { 0x106, 0x43, 0, 0 },
+  { 0x107, 0x63, 0, 0 },
+  { 0x108, 0x43, 0, 0 },
+  { 0x109, 0x63, 0, 0 },
+  { 0x10a, 0x43, 0, 0 },
+  { 0x10b, 0x63, 0, 0 },
+  { 0x10c, 0x43, 0, 0 },
+  { 0x10d, 0x63, 0, 0 },
+  { 0x10e, 0x44, 0, 0 },
+  { 0x10f, 0x64, 0, 0 },
+  { 0x110, 0x44, 0, 0 },
+  { 0x111, 0x64, 0, 0 },
+  { 0x112, 0x45, 0, 0 },
+  { 0x113, 0x65, 0, 0 },
+  { 0x114, 0x45, 0, 0 },
+  { 0x115, 0x65, 0, 0 },
+  { 0x116, 0x45, 0, 0 },
+  { 0x117, 0x65, 0, 0 },
+  { 0x118, 0x45, 0, 0 },
+  { 0x119, 0x65, 0, 0 },
+  { 0x11a, 0x45, 0, 0 },
+  { 0x11b, 0x65, 0, 0 },
+  { 0x11c, 0x47, 0, 0 },
+  { 0x11d, 0x67, 0, 0 },
+  { 0x11e, 0x47, 0, 0 },
+  { 0x11f, 0x67, 0, 0 },
+  { 0x120, 0x47, 0, 0 },
+  { 0x121, 0x67, 0, 0 },
+  { 0x122, 0x47, 0, 0 },
+  { 0x123, 0x67, 0, 0 },
+  { 0x124, 0x48, 0, 0 },
+  { 0x125, 0x68, 0, 0 },
+  { 0x126, 0x48, 0, 0 },
+  { 0x127, 0x68, 0, 0 },
+  { 0x128, 0x49, 0, 0 },
+  { 0x129, 0x69, 0, 0 },
+  { 0x12a, 0x49, 0, 0 },
+  { 0x12b, 0x69, 0, 0 },
+  { 0x12c, 0x49, 0, 0 },
+  { 0x12d, 0x69, 0, 0 },
+  { 0x12e, 0x49, 0, 0 },
+  { 0x12f, 0x69, 0, 0 },
+  { 0x130, 0x49, 0, 0 },
+  { 0x134, 0x4a, 0, 0 },
+  { 0x135, 0x6a, 0, 0 },
+  { 0x136, 0x4b, 0, 0 },
+  { 0x137, 0x6b, 0, 0 },
+  { 0x139, 0x4c, 0, 0 },
+  { 0x13a, 0x6c, 0, 0 },
+  { 0x13b, 0x4c, 0, 0 },
+  { 0x13c, 0x6c, 0, 0 },
+  { 0x13d, 0x4c, 0, 0 },
+  { 0x13e, 0x6c, 0, 0 },
+  { 0x140, 0x6c, 0, 0 },
+  { 0x141, 0x4c, 0, 0 },
+  { 0x142, 0x6c, 0, 0 },
+  { 0x143, 0x4e, 0, 0 },
+  { 0x144, 0x6e, 0, 0 },
+  { 0x145, 0x4e, 0, 0 },
+  { 0x146, 0x6e, 0, 0 },
+  { 0x147, 0x4e, 0, 0 },
+  { 0x148, 0x6e, 0, 0 },
+  { 0x14c, 0x4f, 0, 0 },
+  { 0x14d, 0x6f, 0, 0 },
+  { 0x14e, 0x4f, 0, 0 },
+  { 0x14f, 0x6f, 0, 0 },
+  { 0x150, 0x4f, 0, 0 },
+  { 0x151, 0x6f, 0, 0 },
+  { 0x154, 0x52, 0, 0 },
+  { 0x155, 0x72, 0, 0 },
+  { 0x156, 0x52, 0, 0 },
+  { 0x157, 0x72, 0, 0 },
+  { 0x158, 0x52, 0, 0 },
+  { 0x159, 0x72, 0, 0 },
+  { 0x15a, 0x53, 0, 0 },
+  { 0x15b, 0x73, 0, 0 },
+  { 0x15c, 0x53, 0, 0 },
+  { 0x15d, 0x73, 0, 0 },
+  { 0x15e, 0x53, 0, 0 },
+  { 0x15f, 0x73, 0, 0 },
+  { 0x160, 0x53, 0, 0 },
+  { 0x161, 0x73, 0, 0 },
+  { 0x162, 0x54, 0, 0 },
+  { 0x163, 0x74, 0, 0 },
+  { 0x164, 0x54, 0, 0 },
+  { 0x165, 0x74, 0, 0 },
+  { 0x166, 0x54, 0, 0 },
+  { 0x167, 0x74, 0, 0 },
+  { 0x168, 0x55, 0, 0 },
+  { 0x169, 0x75, 0, 0 },
+  { 0x16a, 0x55, 0, 0 },
+  { 0x16b, 0x75, 0, 0 },
+  { 0x16c, 0x55, 0, 0 },
+  { 0x16d, 0x75, 0, 0 },
+  { 0x16e, 0x55, 0, 0 },
+  { 0x16f, 0x75, 0, 0 },
+  { 0x170, 0x55, 0, 0 },
+  { 0x171, 0x75, 0, 0 },
+  { 0x172, 0x55, 0, 0 },
+  { 0x173, 0x75, 0, 0 },
+  { 0x174, 0x57, 0, 0 },
+  { 0x175, 0x77, 0, 0 },
+  { 0x176, 0x59, 0, 0 },
+  { 0x177, 0x79, 0, 0 },
+  { 0x178, 0x59, 0, 0 },
+  { 0x179, 0x5a, 0, 0 },
+  { 0x17a, 0x7a, 0, 0 },
+  { 0x17b, 0x5a, 0, 0 },
+  { 0x17c, 0x7a, 0, 0 },
+  { 0x17d, 0x5a, 0, 0 },
+  { 0x17e, 0x7a, 0, 0 },
+  { 0x17f, 0x17f, 1439, 1 },
+  { 0x180, 0x62, 0, 0 },
+  { 0x181, 0x42, 0, 0 },
+  { 0x182, 0x42, 0, 0 },
+  { 0x183, 0x62, 0, 0 },
+  { 0x187, 0x43, 0, 0 },
+  { 0x188, 0x63, 0, 0 },
+  { 0x18a, 0x44, 0, 0 },
+  { 0x18b, 0x44, 0, 0 },
+  { 0x18c, 0x64, 0, 0 },
+  { 0x191, 0x46, 0, 0 },
+  { 0x192, 0x66, 0, 0 },
+  { 0x193, 0x47, 0, 0 },
+  { 0x197, 0x49, 0, 0 },
+  { 0x198, 0x4b, 0, 0 },
+  { 0x199, 0x6b, 0, 0 },
+  { 0x19a, 0x6c, 0, 0 },
+  { 0x19d, 0x4e, 0, 0 },
+  { 0x19e, 0x6e, 0, 0 },
+  { 0x19f, 0x4f, 0, 0 },
+  { 0x1a0, 0x4f, 0, 0 },
+  { 0x1a1, 0x6f, 0, 0 },
+  { 0x1a4, 0x50, 0, 0 },
+  { 0x1a5, 0x70, 0, 0 },
+  { 0x1ab, 0x74, 0, 0 },
+  { 0x1ac, 0x54, 0, 0 },
+  { 0x1ad, 0x74, 0, 0 },
+  { 0x1ae, 0x54, 0, 0 },
+  { 0x1af, 0x55, 0, 0 },
+  { 0x1b0, 0x75, 0, 0 },
+  { 0x1b2, 0x56, 0, 0 },
+  { 0x1b3, 0x59, 0, 0 },
+  { 0x1b4, 0x79, 0, 0 },
+  { 0x1b5, 0x5a, 0, 0 },
+  { 0x1b6, 0x7a, 0, 0 },
+  { 0x1b7, 0x1b7, 1440, 1 },
+  { 0x1ba, 0x292, 0, 0 },
+  { 0x1cd, 0x41, 0, 0 },
+  { 0x1ce, 0x61, 0, 0 },
+  { 0x1cf, 0x49, 0, 0 },
+  { 0x1d0, 0x69, 0, 0 },
+  { 0x1d1, 0x4f, 0, 0 },
+  { 0x1d2, 0x6f, 0, 0 },
+  { 0x1d3, 0x55, 0, 0 },
+  { 0x1d4, 0x75, 0, 0 },
+  { 0x1d5, 0x55, 0, 0 },
+  { 0x1d6, 0x75, 0, 0 },
+  { 0x1d7, 0x55, 0, 0 },
+  { 0x1d8, 0x75, 0, 0 },
+  { 0x1d9, 0x55, 0, 0 },
+  { 0x1da, 0x75, 0, 0 },
+  { 0x1db, 0x55, 0, 0 },
+  { 0x1dc, 0x75, 0, 0 },
+  { 0x1de, 0x41, 0, 0 },
+  { 0x1df, 0x61, 0, 0 },
+  { 0x1e0, 0x41, 0, 0 },
+  { 0x1e1, 0x61, 0, 0 },
+  { 0x1e2, 0xc6, 0, 0 },
+  { 0x1e3, 0xe6, 0, 0 },
+  { 0x1e4, 0x47, 0, 0 },
+  { 0x1e5, 0x67, 0, 0 },
+  { 0x1e6, 0x47, 0, 0 },
+  { 0x1e7, 0x67, 0, 0 },
+  { 0x1e8, 0x4b, 0, 0 },
+  { 0x1e9, 0x6b, 0, 0 },
+  { 0x1ea, 0x4f, 0, 0 },
+  { 0x1eb, 0x6f, 0, 0 },
+  { 0x1ec, 0x4f, 0, 0 },
+  { 0x1ed, 0x6f, 0, 0 },
+  { 0x1ee, 0x1b7, 0, 0 },
+  { 0x1ef, 0x292, 0, 0 },
+  { 0x1f0, 0x6a, 0, 0 },
+  { 0x1f4, 0x47, 0, 0 },
+  { 0x1f5, 0x67, 0, 0 },
+  { 0x1f8, 0x4e, 0, 0 },
+  { 0x1f9, 0x6e, 0, 0 },
+  { 0x1fa, 0x41, 0, 0 },
+  { 0x1fb, 0x61, 0, 0 },
+  { 0x1fc, 0xc6, 0, 0 },
+  { 0x1fd, 0xe6, 0, 0 },
+  { 0x1fe, 0x4f, 0, 0 },
+  { 0x1ff, 0x6f, 0, 0 },
+  { 0x200, 0x41, 0, 0 },
+  { 0x201, 0x61, 0, 0 },
+  { 0x202, 0x41, 0, 0 },
+  { 0x203, 0x61, 0, 0 },
+  { 0x204, 0x45, 0, 0 },
+  { 0x205, 0x65, 0, 0 },
+  { 0x206, 0x45, 0, 0 },
+  { 0x207, 0x65, 0, 0 },
+  { 0x208, 0x49, 0, 0 },
+  { 0x209, 0x69, 0, 0 },
+  { 0x20a, 0x49, 0, 0 },
+  { 0x20b, 0x69, 0, 0 },
+  { 0x20c, 0x4f, 0, 0 },
+  { 0x20d, 0x6f, 0, 0 },
+  { 0x20e, 0x4f, 0, 0 },
+  { 0x20f, 0x6f, 0, 0 },
+  { 0x210, 0x52, 0, 0 },
+  { 0x211, 0x72, 0, 0 },
+  { 0x212, 0x52, 0, 0 },
+  { 0x213, 0x72, 0, 0 },
+  { 0x214, 0x55, 0, 0 },
+  { 0x215, 0x75, 0, 0 },
+  { 0x216, 0x55, 0, 0 },
+  { 0x217, 0x75, 0, 0 },
+  { 0x218, 0x53, 0, 0 },
+  { 0x219, 0x73, 0, 0 },
+  { 0x21a, 0x54, 0, 0 },
+  { 0x21b, 0x74, 0, 0 },
+  { 0x21e, 0x48, 0, 0 },
+  { 0x21f, 0x68, 0, 0 },
+  { 0x220, 0x4e, 0, 0 },
+  { 0x221, 0x64, 0, 0 },
+  { 0x224, 0x5a, 0, 0 },
+  { 0x225, 0x7a, 0, 0 },
+  { 0x226, 0x41, 0, 0 },
+  { 0x227, 0x61, 0, 0 },
+  { 0x228, 0x45, 0, 0 },
+  { 0x229, 0x65, 0, 0 },
+  { 0x22a, 0x4f, 0, 0 },
+  { 0x22b, 0x6f, 0, 0 },
+  { 0x22c, 0x4f, 0, 0 },
+  { 0x22d, 0x6f, 0, 0 },
+  { 0x22e, 0x4f, 0, 0 },
+  { 0x22f, 0x6f, 0, 0 },
+  { 0x230, 0x4f, 0, 0 },
+  { 0x231, 0x6f, 0, 0 },
+  { 0x232, 0x59, 0, 0 },
+  { 0x233, 0x79, 0, 0 },
+  { 0x234, 0x6c, 0, 0 },
+  { 0x235, 0x6e, 0, 0 },
+  { 0x236, 0x74, 0, 0 },
+  { 0x253, 0x62, 0, 0 },
+  { 0x255, 0x63, 0, 0 },
+  { 0x256, 0x64, 0, 0 },
+  { 0x257, 0x64, 0, 0 },
+  { 0x25a, 0x259, 0, 0 },
+  { 0x260, 0x67, 0, 0 },
+  { 0x266, 0x68, 0, 0 },
+  { 0x268, 0x69, 0, 0 },
+  { 0x26b, 0x6c, 0, 0 },
+  { 0x26c, 0x6c, 0, 0 },
+  { 0x26d, 0x6c, 0, 0 },
+  { 0x271, 0x6d, 0, 0 },
+  { 0x272, 0x6e, 0, 0 },
+  { 0x273, 0x6e, 0, 0 },
+  { 0x27c, 0x72, 0, 0 },
+  { 0x27d, 0x72, 0, 0 },
+  { 0x282, 0x73, 0, 0 },
+  { 0x286, 0x283, 0, 0 },
+  { 0x288, 0x74, 0, 0 },
+  { 0x28b, 0x76, 0, 0 },
+  { 0x290, 0x7a, 0, 0 },
+  { 0x291, 0x7a, 0, 0 },
+  { 0x292, 0x292, 1441, 1 },
+  { 0x293, 0x292, 0, 0 },
+  { 0x29d, 0x6a, 0, 0 },
+  { 0x2a0, 0x71, 0, 0 },
+  { 0x386, 0x391, 0, 0 },
+  { 0x388, 0x395, 0, 0 },
+  { 0x389, 0x397, 0, 0 },
+  { 0x38a, 0x399, 0, 0 },
+  { 0x38c, 0x39f, 0, 0 },
+  { 0x38e, 0x3a5, 0, 0 },
+  { 0x38f, 0x3a9, 0, 0 },
+  { 0x390, 0x3b9, 0, 0 },
+  { 0x391, 0x391, 1442, 6 },
+  { 0x395, 0x395, 1448, 4 },
+  { 0x397, 0x397, 1452, 4 },
+  { 0x399, 0x399, 1456, 7 },
+  { 0x39f, 0x39f, 1463, 4 },
+  { 0x3a1, 0x3a1, 1467, 1 },
+  { 0x3a5, 0x3a5, 1468, 6 },
+  { 0x3a9, 0x3a9, 1474, 4 },
+  { 0x3aa, 0x399, 0, 0 },
+  { 0x3ab, 0x3a5, 0, 0 },
+  { 0x3ac, 0x3b1, 0, 0 },
+  { 0x3ad, 0x3b5, 0, 0 },
+  { 0x3ae, 0x3b7, 0, 0 },
+  { 0x3af, 0x3b9, 0, 0 },
+  { 0x3b0, 0x3c5, 0, 0 },
+  { 0x3b1, 0x3b1, 1478, 7 },
+  { 0x3b5, 0x3b5, 1485, 4 },
+  { 0x3b7, 0x3b7, 1489, 5 },
+  { 0x3b9, 0x3b9, 1494, 8 },
+  { 0x3bf, 0x3bf, 1502, 4 },
+  { 0x3c1, 0x3c1, 1506, 2 },
+  { 0x3c5, 0x3c5, 1508, 8 },
+  { 0x3c9, 0x3c9, 1516, 5 },
+  { 0x3ca, 0x3b9, 0, 0 },
+  { 0x3cb, 0x3c5, 0, 0 },
+  { 0x3cc, 0x3bf, 0, 0 },
+  { 0x3cd, 0x3c5, 0, 0 },
+  { 0x3ce, 0x3c9, 0, 0 },
+  { 0x3d2, 0x3d2, 1521, 2 },
+  { 0x400, 0x415, 0, 0 },
+  { 0x401, 0x415, 0, 0 },
+  { 0x40d, 0x418, 0, 0 },
+  { 0x410, 0x410, 1523, 2 },
+  { 0x415, 0x415, 1525, 2 },
+  { 0x416, 0x416, 1527, 2 },
+  { 0x417, 0x417, 1529, 1 },
+  { 0x418, 0x418, 1530, 3 },
+  { 0x41e, 0x41e, 1533, 1 },
+  { 0x423, 0x423, 1534, 3 },
+  { 0x427, 0x427, 1537, 1 },
+  { 0x42b, 0x42b, 1538, 1 },
+  { 0x42d, 0x42d, 1539, 1 },
+  { 0x430, 0x430, 1540, 2 },
+  { 0x435, 0x435, 1542, 2 },
+  { 0x436, 0x436, 1544, 2 },
+  { 0x437, 0x437, 1546, 1 },
+  { 0x438, 0x438, 1547, 3 },
+  { 0x43e, 0x43e, 1550, 1 },
+  { 0x443, 0x443, 1551, 3 },
+  { 0x447, 0x447, 1554, 1 },
+  { 0x44b, 0x44b, 1555, 1 },
+  { 0x44d, 0x44d, 1556, 1 },
+  { 0x450, 0x435, 0, 0 },
+  { 0x451, 0x435, 0, 0 },
+  { 0x45d, 0x438, 0, 0 },
+  { 0x474, 0x474, 1557, 1 },
+  { 0x475, 0x475, 1558, 1 },
+  { 0x476, 0x474, 0, 0 },
+  { 0x477, 0x475, 0, 0 },
+  { 0x47c, 0x460, 0, 0 },
+  { 0x47d, 0x461, 0, 0 },
+  { 0x48a, 0x419, 0, 0 },
+  { 0x48b, 0x439, 0, 0 },
+  { 0x48e, 0x420, 0, 0 },
+  { 0x48f, 0x440, 0, 0 },
+  { 0x490, 0x413, 0, 0 },
+  { 0x491, 0x433, 0, 0 },
+  { 0x492, 0x413, 0, 0 },
+  { 0x493, 0x433, 0, 0 },
+  { 0x494, 0x413, 0, 0 },
+  { 0x495, 0x433, 0, 0 },
+  { 0x496, 0x416, 0, 0 },
+  { 0x497, 0x436, 0, 0 },
+  { 0x498, 0x417, 0, 0 },
+  { 0x499, 0x437, 0, 0 },
+  { 0x49a, 0x41a, 0, 0 },
+  { 0x49b, 0x43a, 0, 0 },
+  { 0x49c, 0x41a, 0, 0 },
+  { 0x49d, 0x43a, 0, 0 },
+  { 0x49e, 0x41a, 0, 0 },
+  { 0x49f, 0x43a, 0, 0 },
+  { 0x4a2, 0x41d, 0, 0 },
+  { 0x4a3, 0x43d, 0, 0 },
+  { 0x4a6, 0x41f, 0, 0 },
+  { 0x4a7, 0x43f, 0, 0 },
+  { 0x4aa, 0x421, 0, 0 },
+  { 0x4ab, 0x441, 0, 0 },
+  { 0x4ac, 0x422, 0, 0 },
+  { 0x4ad, 0x442, 0, 0 },
+  { 0x4b0, 0x4ae, 0, 0 },
+  { 0x4b1, 0x4af, 0, 0 },
+  { 0x4b2, 0x425, 0, 0 },
+  { 0x4b3, 0x425, 0, 0 },
+  { 0x4b6, 0x4bc, 0, 0 },
+  { 0x4b7, 0x4bc, 0, 0 },
+  { 0x4b8, 0x4bc, 0, 0 },
+  { 0x4b9, 0x447, 0, 0 },
+  { 0x4be, 0x4bc, 0, 0 },
+  { 0x4bf, 0x4bc, 0, 0 },
+  { 0x4c1, 0x416, 0, 0 },
+  { 0x4c2, 0x436, 0, 0 },
+  { 0x4c3, 0x41a, 0, 0 },
+  { 0x4c4, 0x43a, 0, 0 },
+  { 0x4c5, 0x41b, 0, 0 },
+  { 0x4c6, 0x43b, 0, 0 },
+  { 0x4c7, 0x41d, 0, 0 },
+  { 0x4c8, 0x43d, 0, 0 },
+  { 0x4c9, 0x41d, 0, 0 },
+  { 0x4ca, 0x43d, 0, 0 },
+  { 0x4cb, 0x4bc, 0, 0 },
+  { 0x4cc, 0x4bc, 0, 0 },
+  { 0x4cd, 0x41c, 0, 0 },
+  { 0x4ce, 0x43c, 0, 0 },
+  { 0x4d0, 0x410, 0, 0 },
+  { 0x4d1, 0x430, 0, 0 },
+  { 0x4d2, 0x410, 0, 0 },
+  { 0x4d3, 0x430, 0, 0 },
+  { 0x4d6, 0x415, 0, 0 },
+  { 0x4d7, 0x435, 0, 0 },
+  { 0x4d8, 0x4d8, 1559, 1 },
+  { 0x4d9, 0x4d9, 1560, 1 },
+  { 0x4da, 0x4d8, 0, 0 },
+  { 0x4db, 0x4d9, 0, 0 },
+  { 0x4dc, 0x416, 0, 0 },
+  { 0x4dd, 0x436, 0, 0 },
+  { 0x4de, 0x417, 0, 0 },
+  { 0x4df, 0x437, 0, 0 },
+  { 0x4e2, 0x418, 0, 0 },
+  { 0x4e3, 0x438, 0, 0 },
+  { 0x4e4, 0x418, 0, 0 },
+  { 0x4e5, 0x438, 0, 0 },
+  { 0x4e6, 0x41e, 0, 0 },
+  { 0x4e7, 0x43e, 0, 0 },
+  { 0x4e8, 0x4e8, 1561, 1 },
+  { 0x4e9, 0x4e9, 1562, 1 },
+  { 0x4ea, 0x4e8, 0, 0 },
+  { 0x4eb, 0x4e9, 0, 0 },
+  { 0x4ec, 0x42d, 0, 0 },
+  { 0x4ed, 0x44d, 0, 0 },
+  { 0x4ee, 0x423, 0, 0 },
+  { 0x4ef, 0x443, 0, 0 },
+  { 0x4f0, 0x423, 0, 0 },
+  { 0x4f1, 0x443, 0, 0 },
+  { 0x4f2, 0x423, 0, 0 },
+  { 0x4f3, 0x443, 0, 0 },
+  { 0x4f4, 0x427, 0, 0 },
+  { 0x4f5, 0x447, 0, 0 },
+  { 0x4f8, 0x42b, 0, 0 },
+  { 0x4f9, 0x44b, 0, 0 },
+  { 0x5d0, 0x5d0, 1563, 3 },
+  { 0x5d1, 0x5d1, 1566, 2 },
+  { 0x5d2, 0x5d2, 1568, 1 },
+  { 0x5d3, 0x5d3, 1569, 1 },
+  { 0x5d4, 0x5d4, 1570, 1 },
+  { 0x5d5, 0x5d5, 1571, 2 },
+  { 0x5d6, 0x5d6, 1573, 1 },
+  { 0x5d8, 0x5d8, 1574, 1 },
+  { 0x5d9, 0x5d9, 1575, 2 },
+  { 0x5da, 0x5da, 1577, 1 },
+  { 0x5db, 0x5db, 1578, 2 },
+  { 0x5dc, 0x5dc, 1580, 1 },
+  { 0x5de, 0x5de, 1581, 1 },
+  { 0x5e0, 0x5e0, 1582, 1 },
+  { 0x5e1, 0x5e1, 1583, 1 },
+  { 0x5e3, 0x5e3, 1584, 1 },
+  { 0x5e4, 0x5e4, 1585, 2 },
+  { 0x5e6, 0x5e6, 1587, 1 },
+  { 0x5e7, 0x5e7, 1588, 1 },
+  { 0x5e8, 0x5e8, 1589, 1 },
+  { 0x5e9, 0x5e9, 1590, 3 },
+  { 0x5ea, 0x5ea, 1593, 1 },
+  { 0x1e00, 0x41, 0, 0 },
+  { 0x1e01, 0x61, 0, 0 },
+  { 0x1e02, 0x42, 0, 0 },
+  { 0x1e03, 0x62, 0, 0 },
+  { 0x1e04, 0x42, 0, 0 },
+  { 0x1e05, 0x62, 0, 0 },
+  { 0x1e06, 0x42, 0, 0 },
+  { 0x1e07, 0x62, 0, 0 },
+  { 0x1e08, 0x43, 0, 0 },
+  { 0x1e09, 0x63, 0, 0 },
+  { 0x1e0a, 0x44, 0, 0 },
+  { 0x1e0b, 0x64, 0, 0 },
+  { 0x1e0c, 0x44, 0, 0 },
+  { 0x1e0d, 0x64, 0, 0 },
+  { 0x1e0e, 0x44, 0, 0 },
+  { 0x1e0f, 0x64, 0, 0 },
+  { 0x1e10, 0x44, 0, 0 },
+  { 0x1e11, 0x64, 0, 0 },
+  { 0x1e12, 0x44, 0, 0 },
+  { 0x1e13, 0x64, 0, 0 },
+  { 0x1e14, 0x45, 0, 0 },
+  { 0x1e15, 0x65, 0, 0 },
+  { 0x1e16, 0x45, 0, 0 },
+  { 0x1e17, 0x65, 0, 0 },
+  { 0x1e18, 0x45, 0, 0 },
+  { 0x1e19, 0x65, 0, 0 },
+  { 0x1e1a, 0x45, 0, 0 },
+  { 0x1e1b, 0x65, 0, 0 },
+  { 0x1e1c, 0x45, 0, 0 },
+  { 0x1e1d, 0x65, 0, 0 },
+  { 0x1e1e, 0x46, 0, 0 },
+  { 0x1e1f, 0x66, 0, 0 },
+  { 0x1e20, 0x47, 0, 0 },
+  { 0x1e21, 0x67, 0, 0 },
+  { 0x1e22, 0x48, 0, 0 },
+  { 0x1e23, 0x68, 0, 0 },
+  { 0x1e24, 0x48, 0, 0 },
+  { 0x1e25, 0x68, 0, 0 },
+  { 0x1e26, 0x48, 0, 0 },
+  { 0x1e27, 0x68, 0, 0 },
+  { 0x1e28, 0x48, 0, 0 },
+  { 0x1e29, 0x68, 0, 0 },
+  { 0x1e2a, 0x48, 0, 0 },
+  { 0x1e2b, 0x68, 0, 0 },
+  { 0x1e2c, 0x49, 0, 0 },
+  { 0x1e2d, 0x69, 0, 0 },
+  { 0x1e2e, 0x49, 0, 0 },
+  { 0x1e2f, 0x69, 0, 0 },
+  { 0x1e30, 0x4b, 0, 0 },
+  { 0x1e31, 0x6b, 0, 0 },
+  { 0x1e32, 0x4b, 0, 0 },
+  { 0x1e33, 0x6b, 0, 0 },
+  { 0x1e34, 0x4b, 0, 0 },
+  { 0x1e35, 0x6b, 0, 0 },
+  { 0x1e36, 0x4c, 0, 0 },
+  { 0x1e37, 0x6c, 0, 0 },
+  { 0x1e38, 0x4c, 0, 0 },
+  { 0x1e39, 0x6c, 0, 0 },
+  { 0x1e3a, 0x4c, 0, 0 },
+  { 0x1e3b, 0x6c, 0, 0 },
+  { 0x1e3c, 0x4c, 0, 0 },
+  { 0x1e3d, 0x6c, 0, 0 },
+  { 0x1e3e, 0x4d, 0, 0 },
+  { 0x1e3f, 0x6d, 0, 0 },
+  { 0x1e40, 0x4d, 0, 0 },
+  { 0x1e41, 0x6d, 0, 0 },
+  { 0x1e42, 0x4d, 0, 0 },
+  { 0x1e43, 0x6d, 0, 0 },
+  { 0x1e44, 0x4e, 0, 0 },
+  { 0x1e45, 0x6e, 0, 0 },
+  { 0x1e46, 0x4e, 0, 0 },
+  { 0x1e47, 0x6e, 0, 0 },
+  { 0x1e48, 0x4e, 0, 0 },
+  { 0x1e49, 0x6e, 0, 0 },
+  { 0x1e4a, 0x4e, 0, 0 },
+  { 0x1e4b, 0x6e, 0, 0 },
+  { 0x1e4c, 0x4f, 0, 0 },
+  { 0x1e4d, 0x6f, 0, 0 },
+  { 0x1e4e, 0x4f, 0, 0 },
+  { 0x1e4f, 0x6f, 0, 0 },
+  { 0x1e50, 0x4f, 0, 0 },
+  { 0x1e51, 0x6f, 0, 0 },
+  { 0x1e52, 0x4f, 0, 0 },
+  { 0x1e53, 0x6f, 0, 0 },
+  { 0x1e54, 0x50, 0, 0 },
+  { 0x1e55, 0x70, 0, 0 },
+  { 0x1e56, 0x50, 0, 0 },
+  { 0x1e57, 0x70, 0, 0 },
+  { 0x1e58, 0x52, 0, 0 },
+  { 0x1e59, 0x72, 0, 0 },
+  { 0x1e5a, 0x52, 0, 0 },
+  { 0x1e5b, 0x72, 0, 0 },
+  { 0x1e5c, 0x52, 0, 0 },
+  { 0x1e5d, 0x72, 0, 0 },
+  { 0x1e5e, 0x52, 0, 0 },
+  { 0x1e5f, 0x72, 0, 0 },
+  { 0x1e60, 0x53, 0, 0 },
+  { 0x1e61, 0x73, 0, 0 },
+  { 0x1e62, 0x53, 0, 0 },
+  { 0x1e63, 0x73, 0, 0 },
+  { 0x1e64, 0x53, 0, 0 },
+  { 0x1e65, 0x73, 0, 0 },
+  { 0x1e66, 0x53, 0, 0 },
+  { 0x1e67, 0x73, 0, 0 },
+  { 0x1e68, 0x53, 0, 0 },
+  { 0x1e69, 0x73, 0, 0 },
+  { 0x1e6a, 0x54, 0, 0 },
+  { 0x1e6b, 0x74, 0, 0 },
+  { 0x1e6c, 0x54, 0, 0 },
+  { 0x1e6d, 0x74, 0, 0 },
+  { 0x1e6e, 0x54, 0, 0 },
+  { 0x1e6f, 0x74, 0, 0 },
+  { 0x1e70, 0x54, 0, 0 },
+  { 0x1e71, 0x74, 0, 0 },
+  { 0x1e72, 0x55, 0, 0 },
+  { 0x1e73, 0x75, 0, 0 },
+  { 0x1e74, 0x55, 0, 0 },
+  { 0x1e75, 0x75, 0, 0 },
+  { 0x1e76, 0x55, 0, 0 },
+  { 0x1e77, 0x75, 0, 0 },
+  { 0x1e78, 0x55, 0, 0 },
+  { 0x1e79, 0x75, 0, 0 },
+  { 0x1e7a, 0x55, 0, 0 },
+  { 0x1e7b, 0x75, 0, 0 },
+  { 0x1e7c, 0x56, 0, 0 },
+  { 0x1e7d, 0x76, 0, 0 },
+  { 0x1e7e, 0x56, 0, 0 },
+  { 0x1e7f, 0x76, 0, 0 },
+  { 0x1e80, 0x57, 0, 0 },
+  { 0x1e81, 0x77, 0, 0 },
+  { 0x1e82, 0x57, 0, 0 },
+  { 0x1e83, 0x77, 0, 0 },
+  { 0x1e84, 0x57, 0, 0 },
+  { 0x1e85, 0x77, 0, 0 },
+  { 0x1e86, 0x57, 0, 0 },
+  { 0x1e87, 0x77, 0, 0 },
+  { 0x1e88, 0x57, 0, 0 },
+  { 0x1e89, 0x77, 0, 0 },
+  { 0x1e8a, 0x58, 0, 0 },
+  { 0x1e8b, 0x78, 0, 0 },
+  { 0x1e8c, 0x58, 0, 0 },
+  { 0x1e8d, 0x78, 0, 0 },
+  { 0x1e8e, 0x59, 0, 0 },
+  { 0x1e8f, 0x79, 0, 0 },
+  { 0x1e90, 0x5a, 0, 0 },
+  { 0x1e91, 0x7a, 0, 0 },
+  { 0x1e92, 0x5a, 0, 0 },
+  { 0x1e93, 0x7a, 0, 0 },
+  { 0x1e94, 0x5a, 0, 0 },
+  { 0x1e95, 0x7a, 0, 0 },
+  { 0x1e96, 0x68, 0, 0 },
+  { 0x1e97, 0x74, 0, 0 },
+  { 0x1e98, 0x77, 0, 0 },
+  { 0x1e99, 0x79, 0, 0 },
+  { 0x1e9a, 0x61, 0, 0 },
+  { 0x1e9b, 0x17f, 0, 0 },
+  { 0x1ea0, 0x41, 0, 0 },
+  { 0x1ea1, 0x61, 0, 0 },
+  { 0x1ea2, 0x41, 0, 0 },
+  { 0x1ea3, 0x61, 0, 0 },
+  { 0x1ea4, 0x41, 0, 0 },
+  { 0x1ea5, 0x61, 0, 0 },
+  { 0x1ea6, 0x41, 0, 0 },
+  { 0x1ea7, 0x61, 0, 0 },
+  { 0x1ea8, 0x41, 0, 0 },
+  { 0x1ea9, 0x61, 0, 0 },
+  { 0x1eaa, 0x41, 0, 0 },
+  { 0x1eab, 0x61, 0, 0 },
+  { 0x1eac, 0x41, 0, 0 },
+  { 0x1ead, 0x61, 0, 0 },
+  { 0x1eae, 0x41, 0, 0 },
+  { 0x1eaf, 0x61, 0, 0 },
+  { 0x1eb0, 0x41, 0, 0 },
+  { 0x1eb1, 0x61, 0, 0 },
+  { 0x1eb2, 0x41, 0, 0 },
+  { 0x1eb3, 0x61, 0, 0 },
+  { 0x1eb4, 0x41, 0, 0 },
+  { 0x1eb5, 0x61, 0, 0 },
+  { 0x1eb6, 0x41, 0, 0 },
+  { 0x1eb7, 0x61, 0, 0 },
+  { 0x1eb8, 0x45, 0, 0 },
+  { 0x1eb9, 0x65, 0, 0 },
+  { 0x1eba, 0x45, 0, 0 },
+  { 0x1ebb, 0x65, 0, 0 },
+  { 0x1ebc, 0x45, 0, 0 },
+  { 0x1ebd, 0x65, 0, 0 },
+  { 0x1ebe, 0x45, 0, 0 },
+  { 0x1ebf, 0x65, 0, 0 },
+  { 0x1ec0, 0x45, 0, 0 },
+  { 0x1ec1, 0x65, 0, 0 },
+  { 0x1ec2, 0x45, 0, 0 },
+  { 0x1ec3, 0x65, 0, 0 },
+  { 0x1ec4, 0x45, 0, 0 },
+  { 0x1ec5, 0x65, 0, 0 },
+  { 0x1ec6, 0x45, 0, 0 },
+  { 0x1ec7, 0x65, 0, 0 },
+  { 0x1ec8, 0x49, 0, 0 },
+  { 0x1ec9, 0x69, 0, 0 },
+  { 0x1eca, 0x49, 0, 0 },
+  { 0x1ecb, 0x69, 0, 0 },
+  { 0x1ecc, 0x4f, 0, 0 },
+  { 0x1ecd, 0x6f, 0, 0 },
+  { 0x1ece, 0x4f, 0, 0 },
+  { 0x1ecf, 0x6f, 0, 0 },
+  { 0x1ed0, 0x4f, 0, 0 },
+  { 0x1ed1, 0x6f, 0, 0 },
+  { 0x1ed2, 0x4f, 0, 0 },
+  { 0x1ed3, 0x6f, 0, 0 },
+  { 0x1ed4, 0x4f, 0, 0 },
+  { 0x1ed5, 0x6f, 0, 0 },
+  { 0x1ed6, 0x4f, 0, 0 },
+  { 0x1ed7, 0x6f, 0, 0 },
+  { 0x1ed8, 0x4f, 0, 0 },
+  { 0x1ed9, 0x6f, 0, 0 },
+  { 0x1eda, 0x4f, 0, 0 },
+  { 0x1edb, 0x6f, 0, 0 },
+  { 0x1edc, 0x4f, 0, 0 },
+  { 0x1edd, 0x6f, 0, 0 },
+  { 0x1ede, 0x4f, 0, 0 },
+  { 0x1edf, 0x6f, 0, 0 },
+  { 0x1ee0, 0x4f, 0, 0 },
+  { 0x1ee1, 0x6f, 0, 0 },
+  { 0x1ee2, 0x4f, 0, 0 },
+  { 0x1ee3, 0x6f, 0, 0 },
+  { 0x1ee4, 0x55, 0, 0 },
+  { 0x1ee5, 0x75, 0, 0 },
+  { 0x1ee6, 0x55, 0, 0 },
+  { 0x1ee7, 0x75, 0, 0 },
+  { 0x1ee8, 0x55, 0, 0 },
+  { 0x1ee9, 0x75, 0, 0 },
+  { 0x1eea, 0x55, 0, 0 },
+  { 0x1eeb, 0x75, 0, 0 },
+  { 0x1eec, 0x55, 0, 0 },
+  { 0x1eed, 0x75, 0, 0 },
+  { 0x1eee, 0x55, 0, 0 },
+  { 0x1eef, 0x75, 0, 0 },
+  { 0x1ef0, 0x55, 0, 0 },
+  { 0x1ef1, 0x75, 0, 0 },
+  { 0x1ef2, 0x59, 0, 0 },
+  { 0x1ef3, 0x79, 0, 0 },
+  { 0x1ef4, 0x59, 0, 0 },
+  { 0x1ef5, 0x79, 0, 0 },
+  { 0x1ef6, 0x59, 0, 0 },
+  { 0x1ef7, 0x79, 0, 0 },
+  { 0x1ef8, 0x59, 0, 0 },
+  { 0x1ef9, 0x79, 0, 0 },
+  { 0x1f00, 0x3b1, 0, 0 },
+  { 0x1f01, 0x3b1, 0, 0 },
+  { 0x1f02, 0x3b1, 0, 0 },
+  { 0x1f03, 0x3b1, 0, 0 },
+  { 0x1f04, 0x3b1, 0, 0 },
+  { 0x1f05, 0x3b1, 0, 0 },
+  { 0x1f06, 0x3b1, 0, 0 },
+  { 0x1f07, 0x3b1, 0, 0 },
+  { 0x1f08, 0x391, 0, 0 },
+  { 0x1f09, 0x391, 0, 0 },
+  { 0x1f0a, 0x391, 0, 0 },
+  { 0x1f0b, 0x391, 0, 0 },
+  { 0x1f0c, 0x391, 0, 0 },
+  { 0x1f0d, 0x391, 0, 0 },
+  { 0x1f0e, 0x391, 0, 0 },
+  { 0x1f0f, 0x391, 0, 0 },
+  { 0x1f10, 0x3b5, 0, 0 },
+  { 0x1f11, 0x3b5, 0, 0 },
+  { 0x1f12, 0x3b5, 0, 0 },
+  { 0x1f13, 0x3b5, 0, 0 },
+  { 0x1f14, 0x3b5, 0, 0 },
+  { 0x1f15, 0x3b5, 0, 0 },
+  { 0x1f18, 0x395, 0, 0 },
+  { 0x1f19, 0x395, 0, 0 },
+  { 0x1f1a, 0x395, 0, 0 },
+  { 0x1f1b, 0x395, 0, 0 },
+  { 0x1f1c, 0x395, 0, 0 },
+  { 0x1f1d, 0x395, 0, 0 },
+  { 0x1f20, 0x3b7, 0, 0 },
+  { 0x1f21, 0x3b7, 0, 0 },
+  { 0x1f22, 0x3b7, 0, 0 },
+  { 0x1f23, 0x3b7, 0, 0 },
+  { 0x1f24, 0x3b7, 0, 0 },
+  { 0x1f25, 0x3b7, 0, 0 },
+  { 0x1f26, 0x3b7, 0, 0 },
+  { 0x1f27, 0x3b7, 0, 0 },
+  { 0x1f28, 0x397, 0, 0 },
+  { 0x1f29, 0x397, 0, 0 },
+  { 0x1f2a, 0x397, 0, 0 },
+  { 0x1f2b, 0x397, 0, 0 },
+  { 0x1f2c, 0x397, 0, 0 },
+  { 0x1f2d, 0x397, 0, 0 },
+  { 0x1f2e, 0x397, 0, 0 },
+  { 0x1f2f, 0x397, 0, 0 },
+  { 0x1f30, 0x3b9, 0, 0 },
+  { 0x1f31, 0x3b9, 0, 0 },
+  { 0x1f32, 0x3b9, 0, 0 },
+  { 0x1f33, 0x3b9, 0, 0 },
+  { 0x1f34, 0x3b9, 0, 0 },
+  { 0x1f35, 0x3b9, 0, 0 },
+  { 0x1f36, 0x3b9, 0, 0 },
+  { 0x1f37, 0x3b9, 0, 0 },
+  { 0x1f38, 0x399, 0, 0 },
+  { 0x1f39, 0x399, 0, 0 },
+  { 0x1f3a, 0x399, 0, 0 },
+  { 0x1f3b, 0x399, 0, 0 },
+  { 0x1f3c, 0x399, 0, 0 },
+  { 0x1f3d, 0x399, 0, 0 },
+  { 0x1f3e, 0x399, 0, 0 },
+  { 0x1f3f, 0x399, 0, 0 },
+  { 0x1f40, 0x3bf, 0, 0 },
+  { 0x1f41, 0x3bf, 0, 0 },
+  { 0x1f42, 0x3bf, 0, 0 },
+  { 0x1f43, 0x3bf, 0, 0 },
+  { 0x1f44, 0x3bf, 0, 0 },
+  { 0x1f45, 0x3bf, 0, 0 },
+  { 0x1f48, 0x39f, 0, 0 },
+  { 0x1f49, 0x39f, 0, 0 },
+  { 0x1f4a, 0x39f, 0, 0 },
+  { 0x1f4b, 0x39f, 0, 0 },
+  { 0x1f4c, 0x39f, 0, 0 },
+  { 0x1f4d, 0x39f, 0, 0 },
+  { 0x1f50, 0x3c5, 0, 0 },
+  { 0x1f51, 0x3c5, 0, 0 },
+  { 0x1f52, 0x3c5, 0, 0 },
+  { 0x1f53, 0x3c5, 0, 0 },
+  { 0x1f54, 0x3c5, 0, 0 },
+  { 0x1f55, 0x3c5, 0, 0 },
+  { 0x1f56, 0x3c5, 0, 0 },
+  { 0x1f57, 0x3c5, 0, 0 },
+  { 0x1f59, 0x3a5, 0, 0 },
+  { 0x1f5b, 0x3a5, 0, 0 },
+  { 0x1f5d, 0x3a5, 0, 0 },
+  { 0x1f5f, 0x3a5, 0, 0 },
+  { 0x1f60, 0x3c9, 0, 0 },
+  { 0x1f61, 0x3c9, 0, 0 },
+  { 0x1f62, 0x3c9, 0, 0 },
+  { 0x1f63, 0x3c9, 0, 0 },
+  { 0x1f64, 0x3c9, 0, 0 },
+  { 0x1f65, 0x3c9, 0, 0 },
+  { 0x1f66, 0x3c9, 0, 0 },
+  { 0x1f67, 0x3c9, 0, 0 },
+  { 0x1f68, 0x3a9, 0, 0 },
+  { 0x1f69, 0x3a9, 0, 0 },
+  { 0x1f6a, 0x3a9, 0, 0 },
+  { 0x1f6b, 0x3a9, 0, 0 },
+  { 0x1f6c, 0x3a9, 0, 0 },
+  { 0x1f6d, 0x3a9, 0, 0 },
+  { 0x1f6e, 0x3a9, 0, 0 },
+  { 0x1f6f, 0x3a9, 0, 0 },
+  { 0x1f70, 0x3b1, 0, 0 },
+  { 0x1f71, 0x3b1, 0, 0 },
+  { 0x1f72, 0x3b5, 0, 0 },
+  { 0x1f73, 0x3b5, 0, 0 },
+  { 0x1f74, 0x3b7, 0, 0 },
+  { 0x1f75, 0x3b7, 0, 0 },
+  { 0x1f76, 0x3b9, 0, 0 },
+  { 0x1f77, 0x3b9, 0, 0 },
+  { 0x1f78, 0x3bf, 0, 0 },
+  { 0x1f79, 0x3bf, 0, 0 },
+  { 0x1f7a, 0x3c5, 0, 0 },
+  { 0x1f7b, 0x3c5, 0, 0 },
+  { 0x1f7c, 0x3c9, 0, 0 },
+  { 0x1f7d, 0x3c9, 0, 0 },
+  { 0x1f80, 0x3b1, 0, 0 },
+  { 0x1f81, 0x3b1, 0, 0 },
+  { 0x1f82, 0x3b1, 0, 0 },
+  { 0x1f83, 0x3b1, 0, 0 },
+  { 0x1f84, 0x3b1, 0, 0 },
+  { 0x1f85, 0x3b1, 0, 0 },
+  { 0x1f86, 0x3b1, 0, 0 },
+  { 0x1f87, 0x3b1, 0, 0 },
+  { 0x1f88, 0x391, 0, 0 },
+  { 0x1f89, 0x391, 0, 0 },
+  { 0x1f8a, 0x391, 0, 0 },
+  { 0x1f8b, 0x391, 0, 0 },
+  { 0x1f8c, 0x391, 0, 0 },
+  { 0x1f8d, 0x391, 0, 0 },
+  { 0x1f8e, 0x391, 0, 0 },
+  { 0x1f8f, 0x391, 0, 0 },
+  { 0x1f90, 0x3b7, 0, 0 },
+  { 0x1f91, 0x3b7, 0, 0 },
+  { 0x1f92, 0x3b7, 0, 0 },
+  { 0x1f93, 0x3b7, 0, 0 },
+  { 0x1f94, 0x3b7, 0, 0 },
+  { 0x1f95, 0x3b7, 0, 0 },
+  { 0x1f96, 0x3b7, 0, 0 },
+  { 0x1f97, 0x3b7, 0, 0 },
+  { 0x1f98, 0x397, 0, 0 },
+  { 0x1f99, 0x397, 0, 0 },
+  { 0x1f9a, 0x397, 0, 0 },
+  { 0x1f9b, 0x397, 0, 0 },
+  { 0x1f9c, 0x397, 0, 0 },
+  { 0x1f9d, 0x397, 0, 0 },
+  { 0x1f9e, 0x397, 0, 0 },
+  { 0x1f9f, 0x397, 0, 0 },
+  { 0x1fa0, 0x3c9, 0, 0 },
+  { 0x1fa1, 0x3c9, 0, 0 },
+  { 0x1fa2, 0x3c9, 0, 0 },
+  { 0x1fa3, 0x3c9, 0, 0 },
+  { 0x1fa4, 0x3c9, 0, 0 },
+  { 0x1fa5, 0x3c9, 0, 0 },
+  { 0x1fa6, 0x3c9, 0, 0 },
+  { 0x1fa7, 0x3c9, 0, 0 },
+  { 0x1fa8, 0x3a9, 0, 0 },
+  { 0x1fa9, 0x3a9, 0, 0 },
+  { 0x1faa, 0x3a9, 0, 0 },
+  { 0x1fab, 0x3a9, 0, 0 },
+  { 0x1fac, 0x3a9, 0, 0 },
+  { 0x1fad, 0x3a9, 0, 0 },
+  { 0x1fae, 0x3a9, 0, 0 },
+  { 0x1faf, 0x3a9, 0, 0 },
+  { 0x1fb0, 0x3b1, 0, 0 },
+  { 0x1fb1, 0x3b1, 0, 0 },
+  { 0x1fb2, 0x3b1, 0, 0 },
+  { 0x1fb3, 0x3b1, 0, 0 },
+  { 0x1fb4, 0x3b1, 0, 0 },
+  { 0x1fb6, 0x3b1, 0, 0 },
+  { 0x1fb7, 0x3b1, 0, 0 },
+  { 0x1fb8, 0x391, 0, 0 },
+  { 0x1fb9, 0x391, 0, 0 },
+  { 0x1fba, 0x391, 0, 0 },
+  { 0x1fbb, 0x391, 0, 0 },
+  { 0x1fbc, 0x391, 0, 0 },
+  { 0x1fc2, 0x3b7, 0, 0 },
+  { 0x1fc3, 0x3b7, 0, 0 },
+  { 0x1fc4, 0x3b7, 0, 0 },
+  { 0x1fc6, 0x3b7, 0, 0 },
+  { 0x1fc7, 0x3b7, 0, 0 },
+  { 0x1fc8, 0x395, 0, 0 },
+  { 0x1fc9, 0x395, 0, 0 },
+  { 0x1fca, 0x397, 0, 0 },
+  { 0x1fcb, 0x397, 0, 0 },
+  { 0x1fcc, 0x397, 0, 0 },
+  { 0x1fd0, 0x3b9, 0, 0 },
+  { 0x1fd1, 0x3b9, 0, 0 },
+  { 0x1fd2, 0x3b9, 0, 0 },
+  { 0x1fd3, 0x3b9, 0, 0 },
+  { 0x1fd6, 0x3b9, 0, 0 },
+  { 0x1fd7, 0x3b9, 0, 0 },
+  { 0x1fd8, 0x399, 0, 0 },
+  { 0x1fd9, 0x399, 0, 0 },
+  { 0x1fda, 0x399, 0, 0 },
+  { 0x1fdb, 0x399, 0, 0 },
+  { 0x1fe0, 0x3c5, 0, 0 },
+  { 0x1fe1, 0x3c5, 0, 0 },
+  { 0x1fe2, 0x3c5, 0, 0 },
+  { 0x1fe3, 0x3c5, 0, 0 },
+  { 0x1fe4, 0x3c1, 0, 0 },
+  { 0x1fe5, 0x3c1, 0, 0 },
+  { 0x1fe6, 0x3c5, 0, 0 },
+  { 0x1fe7, 0x3c5, 0, 0 },
+  { 0x1fe8, 0x3a5, 0, 0 },
+  { 0x1fe9, 0x3a5, 0, 0 },
+  { 0x1fea, 0x3a5, 0, 0 },
+  { 0x1feb, 0x3a5, 0, 0 },
+  { 0x1fec, 0x3a1, 0, 0 },
+  { 0x1ff2, 0x3c9, 0, 0 },
+  { 0x1ff3, 0x3c9, 0, 0 },
+  { 0x1ff4, 0x3c9, 0, 0 },
+  { 0x1ff6, 0x3c9, 0, 0 },
+  { 0x1ff7, 0x3c9, 0, 0 },
+  { 0x1ff8, 0x39f, 0, 0 },
+  { 0x1ff9, 0x39f, 0, 0 },
+  { 0x1ffa, 0x3a9, 0, 0 },
+  { 0x1ffb, 0x3a9, 0, 0 },
+  { 0x1ffc, 0x3a9, 0, 0 },
+  { 0xfb1d, 0x5d9, 0, 0 },
+  { 0xfb2a, 0x5e9, 0, 0 },
+  { 0xfb2b, 0x5e9, 0, 0 },
+  { 0xfb2c, 0x5e9, 0, 0 },
+  { 0xfb2d, 0x5e9, 0, 0 },
+  { 0xfb2e, 0x5d0, 0, 0 },
+  { 0xfb2f, 0x5d0, 0, 0 },
+  { 0xfb30, 0x5d0, 0, 0 },
+  { 0xfb31, 0x5d1, 0, 0 },
+  { 0xfb32, 0x5d2, 0, 0 },
+  { 0xfb33, 0x5d3, 0, 0 },
+  { 0xfb34, 0x5d4, 0, 0 },
+  { 0xfb35, 0x5d5, 0, 0 },
+  { 0xfb36, 0x5d6, 0, 0 },
+  { 0xfb38, 0x5d8, 0, 0 },
+  { 0xfb39, 0x5d9, 0, 0 },
+  { 0xfb3a, 0x5da, 0, 0 },
+  { 0xfb3b, 0x5db, 0, 0 },
+  { 0xfb3c, 0x5dc, 0, 0 },
+  { 0xfb3e, 0x5de, 0, 0 },
+  { 0xfb40, 0x5e0, 0, 0 },
+  { 0xfb41, 0x5e1, 0, 0 },
+  { 0xfb43, 0x5e3, 0, 0 },
+  { 0xfb44, 0x5e4, 0, 0 },
+  { 0xfb46, 0x5e6, 0, 0 },
+  { 0xfb47, 0x5e7, 0, 0 },
+  { 0xfb48, 0x5e8, 0, 0 },
+  { 0xfb49, 0x5e9, 0, 0 },
+  { 0xfb4a, 0x5ea, 0, 0 },
+  { 0xfb4b, 0x5d5, 0, 0 },
+  { 0xfb4c, 0x5d1, 0, 0 },
+  { 0xfb4d, 0x5db, 0, 0 },
+  { 0xfb4e, 0x5e4, 0, 0 },
+  { 0x300, 0x41, 0, 0 },
+  { 0x301, 0x41, 0, 0 },
+  { 0x302, 0x41, 1594, 4 },
+  { 0x303, 0x41, 0, 0 },
+  { 0x304, 0x41, 0, 0 },
+  { 0x306, 0x41, 1598, 4 },
+  { 0x307, 0x41, 1602, 1 },
+  { 0x308, 0x41, 1603, 1 },
+  { 0x309, 0x41, 0, 0 },
+  { 0x30a, 0x41, 1604, 1 },
+  { 0x30c, 0x41, 0, 0 },
+  { 0x30f, 0x41, 0, 0 },
+  { 0x311, 0x41, 0, 0 },
+  { 0x323, 0x41, 1605, 2 },
+  { 0x325, 0x41, 0, 0 },
+  { 0x328, 0x41, 0, 0 },
+  { 0x307, 0x42, 0, 0 },
+  { 0x323, 0x42, 0, 0 },
+  { 0x331, 0x42, 0, 0 },
+  { 0x301, 0x43, 0, 0 },
+  { 0x302, 0x43, 0, 0 },
+  { 0x307, 0x43, 0, 0 },
+  { 0x30c, 0x43, 0, 0 },
+  { 0x327, 0x43, 1607, 1 },
+  { 0x307, 0x44, 0, 0 },
+  { 0x30c, 0x44, 0, 0 },
+  { 0x323, 0x44, 0, 0 },
+  { 0x327, 0x44, 0, 0 },
+  { 0x32d, 0x44, 0, 0 },
+  { 0x331, 0x44, 0, 0 },
+  { 0x300, 0x45, 0, 0 },
+  { 0x301, 0x45, 0, 0 },
+  { 0x302, 0x45, 1608, 4 },
+  { 0x303, 0x45, 0, 0 },
+  { 0x304, 0x45, 1612, 2 },
+  { 0x306, 0x45, 0, 0 },
+  { 0x307, 0x45, 0, 0 },
+  { 0x308, 0x45, 0, 0 },
+  { 0x309, 0x45, 0, 0 },
+  { 0x30c, 0x45, 0, 0 },
+  { 0x30f, 0x45, 0, 0 },
+  { 0x311, 0x45, 0, 0 },
+  { 0x323, 0x45, 1614, 1 },
+  { 0x327, 0x45, 1615, 1 },
+  { 0x328, 0x45, 0, 0 },
+  { 0x32d, 0x45, 0, 0 },
+  { 0x330, 0x45, 0, 0 },
+  { 0x307, 0x46, 0, 0 },
+  { 0x301, 0x47, 0, 0 },
+  { 0x302, 0x47, 0, 0 },
+  { 0x304, 0x47, 0, 0 },
+  { 0x306, 0x47, 0, 0 },
+  { 0x307, 0x47, 0, 0 },
+  { 0x30c, 0x47, 0, 0 },
+  { 0x327, 0x47, 0, 0 },
+  { 0x302, 0x48, 0, 0 },
+  { 0x307, 0x48, 0, 0 },
+  { 0x308, 0x48, 0, 0 },
+  { 0x30c, 0x48, 0, 0 },
+  { 0x323, 0x48, 0, 0 },
+  { 0x327, 0x48, 0, 0 },
+  { 0x32e, 0x48, 0, 0 },
+  { 0x300, 0x49, 0, 0 },
+  { 0x301, 0x49, 0, 0 },
+  { 0x302, 0x49, 0, 0 },
+  { 0x303, 0x49, 0, 0 },
+  { 0x304, 0x49, 0, 0 },
+  { 0x306, 0x49, 0, 0 },
+  { 0x307, 0x49, 0, 0 },
+  { 0x308, 0x49, 1616, 1 },
+  { 0x309, 0x49, 0, 0 },
+  { 0x30c, 0x49, 0, 0 },
+  { 0x30f, 0x49, 0, 0 },
+  { 0x311, 0x49, 0, 0 },
+  { 0x323, 0x49, 0, 0 },
+  { 0x328, 0x49, 0, 0 },
+  { 0x330, 0x49, 0, 0 },
+  { 0x302, 0x4a, 0, 0 },
+  { 0x301, 0x4b, 0, 0 },
+  { 0x30c, 0x4b, 0, 0 },
+  { 0x323, 0x4b, 0, 0 },
+  { 0x327, 0x4b, 0, 0 },
+  { 0x331, 0x4b, 0, 0 },
+  { 0x301, 0x4c, 0, 0 },
+  { 0x30c, 0x4c, 0, 0 },
+  { 0x323, 0x4c, 1617, 1 },
+  { 0x327, 0x4c, 0, 0 },
+  { 0x32d, 0x4c, 0, 0 },
+  { 0x331, 0x4c, 0, 0 },
+  { 0x301, 0x4d, 0, 0 },
+  { 0x307, 0x4d, 0, 0 },
+  { 0x323, 0x4d, 0, 0 },
+  { 0x300, 0x4e, 0, 0 },
+  { 0x301, 0x4e, 0, 0 },
+  { 0x303, 0x4e, 0, 0 },
+  { 0x307, 0x4e, 0, 0 },
+  { 0x30c, 0x4e, 0, 0 },
+  { 0x323, 0x4e, 0, 0 },
+  { 0x327, 0x4e, 0, 0 },
+  { 0x32d, 0x4e, 0, 0 },
+  { 0x331, 0x4e, 0, 0 },
+  { 0x300, 0x4f, 0, 0 },
+  { 0x301, 0x4f, 0, 0 },
+  { 0x302, 0x4f, 1618, 4 },
+  { 0x303, 0x4f, 1622, 3 },
+  { 0x304, 0x4f, 1625, 2 },
+  { 0x306, 0x4f, 0, 0 },
+  { 0x307, 0x4f, 1627, 1 },
+  { 0x308, 0x4f, 1628, 1 },
+  { 0x309, 0x4f, 0, 0 },
+  { 0x30b, 0x4f, 0, 0 },
+  { 0x30c, 0x4f, 0, 0 },
+  { 0x30f, 0x4f, 0, 0 },
+  { 0x311, 0x4f, 0, 0 },
+  { 0x31b, 0x4f, 1629, 5 },
+  { 0x323, 0x4f, 1634, 1 },
+  { 0x328, 0x4f, 1635, 1 },
+  { 0x301, 0x50, 0, 0 },
+  { 0x307, 0x50, 0, 0 },
+  { 0x301, 0x52, 0, 0 },
+  { 0x307, 0x52, 0, 0 },
+  { 0x30c, 0x52, 0, 0 },
+  { 0x30f, 0x52, 0, 0 },
+  { 0x311, 0x52, 0, 0 },
+  { 0x323, 0x52, 1636, 1 },
+  { 0x327, 0x52, 0, 0 },
+  { 0x331, 0x52, 0, 0 },
+  { 0x301, 0x53, 1637, 1 },
+  { 0x302, 0x53, 0, 0 },
+  { 0x307, 0x53, 0, 0 },
+  { 0x30c, 0x53, 1638, 1 },
+  { 0x323, 0x53, 1639, 1 },
+  { 0x326, 0x53, 0, 0 },
+  { 0x327, 0x53, 0, 0 },
+  { 0x307, 0x54, 0, 0 },
+  { 0x30c, 0x54, 0, 0 },
+  { 0x323, 0x54, 0, 0 },
+  { 0x326, 0x54, 0, 0 },
+  { 0x327, 0x54, 0, 0 },
+  { 0x32d, 0x54, 0, 0 },
+  { 0x331, 0x54, 0, 0 },
+  { 0x300, 0x55, 0, 0 },
+  { 0x301, 0x55, 0, 0 },
+  { 0x302, 0x55, 0, 0 },
+  { 0x303, 0x55, 1640, 1 },
+  { 0x304, 0x55, 1641, 1 },
+  { 0x306, 0x55, 0, 0 },
+  { 0x308, 0x55, 1642, 4 },
+  { 0x309, 0x55, 0, 0 },
+  { 0x30a, 0x55, 0, 0 },
+  { 0x30b, 0x55, 0, 0 },
+  { 0x30c, 0x55, 0, 0 },
+  { 0x30f, 0x55, 0, 0 },
+  { 0x311, 0x55, 0, 0 },
+  { 0x31b, 0x55, 1646, 5 },
+  { 0x323, 0x55, 0, 0 },
+  { 0x324, 0x55, 0, 0 },
+  { 0x328, 0x55, 0, 0 },
+  { 0x32d, 0x55, 0, 0 },
+  { 0x330, 0x55, 0, 0 },
+  { 0x303, 0x56, 0, 0 },
+  { 0x323, 0x56, 0, 0 },
+  { 0x300, 0x57, 0, 0 },
+  { 0x301, 0x57, 0, 0 },
+  { 0x302, 0x57, 0, 0 },
+  { 0x307, 0x57, 0, 0 },
+  { 0x308, 0x57, 0, 0 },
+  { 0x323, 0x57, 0, 0 },
+  { 0x307, 0x58, 0, 0 },
+  { 0x308, 0x58, 0, 0 },
+  { 0x300, 0x59, 0, 0 },
+  { 0x301, 0x59, 0, 0 },
+  { 0x302, 0x59, 0, 0 },
+  { 0x303, 0x59, 0, 0 },
+  { 0x304, 0x59, 0, 0 },
+  { 0x307, 0x59, 0, 0 },
+  { 0x308, 0x59, 0, 0 },
+  { 0x309, 0x59, 0, 0 },
+  { 0x323, 0x59, 0, 0 },
+  { 0x301, 0x5a, 0, 0 },
+  { 0x302, 0x5a, 0, 0 },
+  { 0x307, 0x5a, 0, 0 },
+  { 0x30c, 0x5a, 0, 0 },
+  { 0x323, 0x5a, 0, 0 },
+  { 0x331, 0x5a, 0, 0 },
+  { 0x300, 0x61, 0, 0 },
+  { 0x301, 0x61, 0, 0 },
+  { 0x302, 0x61, 1651, 4 },
+  { 0x303, 0x61, 0, 0 },
+  { 0x304, 0x61, 0, 0 },
+  { 0x306, 0x61, 1655, 4 },
+  { 0x307, 0x61, 1659, 1 },
+  { 0x308, 0x61, 1660, 1 },
+  { 0x309, 0x61, 0, 0 },
+  { 0x30a, 0x61, 1661, 1 },
+  { 0x30c, 0x61, 0, 0 },
+  { 0x30f, 0x61, 0, 0 },
+  { 0x311, 0x61, 0, 0 },
+  { 0x323, 0x61, 1662, 2 },
+  { 0x325, 0x61, 0, 0 },
+  { 0x328, 0x61, 0, 0 },
+  { 0x307, 0x62, 0, 0 },
+  { 0x323, 0x62, 0, 0 },
+  { 0x331, 0x62, 0, 0 },
+  { 0x301, 0x63, 0, 0 },
+  { 0x302, 0x63, 0, 0 },
+  { 0x307, 0x63, 0, 0 },
+  { 0x30c, 0x63, 0, 0 },
+  { 0x327, 0x63, 1664, 1 },
+  { 0x307, 0x64, 0, 0 },
+  { 0x30c, 0x64, 0, 0 },
+  { 0x323, 0x64, 0, 0 },
+  { 0x327, 0x64, 0, 0 },
+  { 0x32d, 0x64, 0, 0 },
+  { 0x331, 0x64, 0, 0 },
+  { 0x300, 0x65, 0, 0 },
+  { 0x301, 0x65, 0, 0 },
+  { 0x302, 0x65, 1665, 4 },
+  { 0x303, 0x65, 0, 0 },
+  { 0x304, 0x65, 1669, 2 },
+  { 0x306, 0x65, 0, 0 },
+  { 0x307, 0x65, 0, 0 },
+  { 0x308, 0x65, 0, 0 },
+  { 0x309, 0x65, 0, 0 },
+  { 0x30c, 0x65, 0, 0 },
+  { 0x30f, 0x65, 0, 0 },
+  { 0x311, 0x65, 0, 0 },
+  { 0x323, 0x65, 1671, 1 },
+  { 0x327, 0x65, 1672, 1 },
+  { 0x328, 0x65, 0, 0 },
+  { 0x32d, 0x65, 0, 0 },
+  { 0x330, 0x65, 0, 0 },
+  { 0x307, 0x66, 0, 0 },
+  { 0x301, 0x67, 0, 0 },
+  { 0x302, 0x67, 0, 0 },
+  { 0x304, 0x67, 0, 0 },
+  { 0x306, 0x67, 0, 0 },
+  { 0x307, 0x67, 0, 0 },
+  { 0x30c, 0x67, 0, 0 },
+  { 0x327, 0x67, 0, 0 },
+  { 0x302, 0x68, 0, 0 },
+  { 0x307, 0x68, 0, 0 },
+  { 0x308, 0x68, 0, 0 },
+  { 0x30c, 0x68, 0, 0 },
+  { 0x323, 0x68, 0, 0 },
+  { 0x327, 0x68, 0, 0 },
+  { 0x32e, 0x68, 0, 0 },
+  { 0x331, 0x68, 0, 0 },
+  { 0x300, 0x69, 0, 0 },
+  { 0x301, 0x69, 0, 0 },
+  { 0x302, 0x69, 0, 0 },
+  { 0x303, 0x69, 0, 0 },
+  { 0x304, 0x69, 0, 0 },
+  { 0x306, 0x69, 0, 0 },
+  { 0x308, 0x69, 1673, 1 },
+  { 0x309, 0x69, 0, 0 },
+  { 0x30c, 0x69, 0, 0 },
+  { 0x30f, 0x69, 0, 0 },
+  { 0x311, 0x69, 0, 0 },
+  { 0x323, 0x69, 0, 0 },
+  { 0x328, 0x69, 0, 0 },
+  { 0x330, 0x69, 0, 0 },
+  { 0x302, 0x6a, 0, 0 },
+  { 0x30c, 0x6a, 0, 0 },
+  { 0x301, 0x6b, 0, 0 },
+  { 0x30c, 0x6b, 0, 0 },
+  { 0x323, 0x6b, 0, 0 },
+  { 0x327, 0x6b, 0, 0 },
+  { 0x331, 0x6b, 0, 0 },
+  { 0x301, 0x6c, 0, 0 },
+  { 0x30c, 0x6c, 0, 0 },
+  { 0x323, 0x6c, 1674, 1 },
+  { 0x327, 0x6c, 0, 0 },
+  { 0x32d, 0x6c, 0, 0 },
+  { 0x331, 0x6c, 0, 0 },
+  { 0x301, 0x6d, 0, 0 },
+  { 0x307, 0x6d, 0, 0 },
+  { 0x323, 0x6d, 0, 0 },
+  { 0x300, 0x6e, 0, 0 },
+  { 0x301, 0x6e, 0, 0 },
+  { 0x303, 0x6e, 0, 0 },
+  { 0x307, 0x6e, 0, 0 },
+  { 0x30c, 0x6e, 0, 0 },
+  { 0x323, 0x6e, 0, 0 },
+  { 0x327, 0x6e, 0, 0 },
+  { 0x32d, 0x6e, 0, 0 },
+  { 0x331, 0x6e, 0, 0 },
+  { 0x300, 0x6f, 0, 0 },
+  { 0x301, 0x6f, 0, 0 },
+  { 0x302, 0x6f, 1675, 4 },
+  { 0x303, 0x6f, 1679, 3 },
+  { 0x304, 0x6f, 1682, 2 },
+  { 0x306, 0x6f, 0, 0 },
+  { 0x307, 0x6f, 1684, 1 },
+  { 0x308, 0x6f, 1685, 1 },
+  { 0x309, 0x6f, 0, 0 },
+  { 0x30b, 0x6f, 0, 0 },
+  { 0x30c, 0x6f, 0, 0 },
+  { 0x30f, 0x6f, 0, 0 },
+  { 0x311, 0x6f, 0, 0 },
+  { 0x31b, 0x6f, 1686, 5 },
+  { 0x323, 0x6f, 1691, 1 },
+  { 0x328, 0x6f, 1692, 1 },
+  { 0x301, 0x70, 0, 0 },
+  { 0x307, 0x70, 0, 0 },
+  { 0x301, 0x72, 0, 0 },
+  { 0x307, 0x72, 0, 0 },
+  { 0x30c, 0x72, 0, 0 },
+  { 0x30f, 0x72, 0, 0 },
+  { 0x311, 0x72, 0, 0 },
+  { 0x323, 0x72, 1693, 1 },
+  { 0x327, 0x72, 0, 0 },
+  { 0x331, 0x72, 0, 0 },
+  { 0x301, 0x73, 1694, 1 },
+  { 0x302, 0x73, 0, 0 },
+  { 0x307, 0x73, 0, 0 },
+  { 0x30c, 0x73, 1695, 1 },
+  { 0x323, 0x73, 1696, 1 },
+  { 0x326, 0x73, 0, 0 },
+  { 0x327, 0x73, 0, 0 },
+  { 0x307, 0x74, 0, 0 },
+  { 0x308, 0x74, 0, 0 },
+  { 0x30c, 0x74, 0, 0 },
+  { 0x323, 0x74, 0, 0 },
+  { 0x326, 0x74, 0, 0 },
+  { 0x327, 0x74, 0, 0 },
+  { 0x32d, 0x74, 0, 0 },
+  { 0x331, 0x74, 0, 0 },
+  { 0x300, 0x75, 0, 0 },
+  { 0x301, 0x75, 0, 0 },
+  { 0x302, 0x75, 0, 0 },
+  { 0x303, 0x75, 1697, 1 },
+  { 0x304, 0x75, 1698, 1 },
+  { 0x306, 0x75, 0, 0 },
+  { 0x308, 0x75, 1699, 4 },
+  { 0x309, 0x75, 0, 0 },
+  { 0x30a, 0x75, 0, 0 },
+  { 0x30b, 0x75, 0, 0 },
+  { 0x30c, 0x75, 0, 0 },
+  { 0x30f, 0x75, 0, 0 },
+  { 0x311, 0x75, 0, 0 },
+  { 0x31b, 0x75, 1703, 5 },
+  { 0x323, 0x75, 0, 0 },
+  { 0x324, 0x75, 0, 0 },
+  { 0x328, 0x75, 0, 0 },
+  { 0x32d, 0x75, 0, 0 },
+  { 0x330, 0x75, 0, 0 },
+  { 0x303, 0x76, 0, 0 },
+  { 0x323, 0x76, 0, 0 },
+  { 0x300, 0x77, 0, 0 },
+  { 0x301, 0x77, 0, 0 },
+  { 0x302, 0x77, 0, 0 },
+  { 0x307, 0x77, 0, 0 },
+  { 0x308, 0x77, 0, 0 },
+  { 0x30a, 0x77, 0, 0 },
+  { 0x323, 0x77, 0, 0 },
+  { 0x307, 0x78, 0, 0 },
+  { 0x308, 0x78, 0, 0 },
+  { 0x300, 0x79, 0, 0 },
+  { 0x301, 0x79, 0, 0 },
+  { 0x302, 0x79, 0, 0 },
+  { 0x303, 0x79, 0, 0 },
+  { 0x304, 0x79, 0, 0 },
+  { 0x307, 0x79, 0, 0 },
+  { 0x308, 0x79, 0, 0 },
+  { 0x309, 0x79, 0, 0 },
+  { 0x30a, 0x79, 0, 0 },
+  { 0x323, 0x79, 0, 0 },
+  { 0x301, 0x7a, 0, 0 },
+  { 0x302, 0x7a, 0, 0 },
+  { 0x307, 0x7a, 0, 0 },
+  { 0x30c, 0x7a, 0, 0 },
+  { 0x323, 0x7a, 0, 0 },
+  { 0x331, 0x7a, 0, 0 },
+  { 0x301, 0xc6, 0, 0 },
+  { 0x304, 0xc6, 0, 0 },
+  { 0x301, 0xd8, 0, 0 },
+  { 0x301, 0xe6, 0, 0 },
+  { 0x304, 0xe6, 0, 0 },
+  { 0x301, 0xf8, 0, 0 },
+  { 0x307, 0x17f, 0, 0 },
+  { 0x30c, 0x1b7, 0, 0 },
+  { 0x30c, 0x292, 0, 0 },
+  { 0x300, 0x391, 0, 0 },
+  { 0x301, 0x391, 0, 0 },
+  { 0x304, 0x391, 0, 0 },
+  { 0x306, 0x391, 0, 0 },
+  { 0x313, 0x391, 1708, 3 },
+  { 0x314, 0x391, 1711, 3 },
+  { 0x300, 0x395, 0, 0 },
+  { 0x301, 0x395, 0, 0 },
+  { 0x313, 0x395, 1714, 2 },
+  { 0x314, 0x395, 1716, 2 },
+  { 0x300, 0x397, 0, 0 },
+  { 0x301, 0x397, 0, 0 },
+  { 0x313, 0x397, 1718, 3 },
+  { 0x314, 0x397, 1721, 3 },
+  { 0x300, 0x399, 0, 0 },
+  { 0x301, 0x399, 0, 0 },
+  { 0x304, 0x399, 0, 0 },
+  { 0x306, 0x399, 0, 0 },
+  { 0x308, 0x399, 0, 0 },
+  { 0x313, 0x399, 1724, 3 },
+  { 0x314, 0x399, 1727, 3 },
+  { 0x300, 0x39f, 0, 0 },
+  { 0x301, 0x39f, 0, 0 },
+  { 0x313, 0x39f, 1730, 2 },
+  { 0x314, 0x39f, 1732, 2 },
+  { 0x314, 0x3a1, 0, 0 },
+  { 0x300, 0x3a5, 0, 0 },
+  { 0x301, 0x3a5, 0, 0 },
+  { 0x304, 0x3a5, 0, 0 },
+  { 0x306, 0x3a5, 0, 0 },
+  { 0x308, 0x3a5, 0, 0 },
+  { 0x314, 0x3a5, 1734, 3 },
+  { 0x300, 0x3a9, 0, 0 },
+  { 0x301, 0x3a9, 0, 0 },
+  { 0x313, 0x3a9, 1737, 3 },
+  { 0x314, 0x3a9, 1740, 3 },
+  { 0x300, 0x3b1, 0, 0 },
+  { 0x301, 0x3b1, 0, 0 },
+  { 0x304, 0x3b1, 0, 0 },
+  { 0x306, 0x3b1, 0, 0 },
+  { 0x313, 0x3b1, 1743, 3 },
+  { 0x314, 0x3b1, 1746, 3 },
+  { 0x342, 0x3b1, 0, 0 },
+  { 0x300, 0x3b5, 0, 0 },
+  { 0x301, 0x3b5, 0, 0 },
+  { 0x313, 0x3b5, 1749, 2 },
+  { 0x314, 0x3b5, 1751, 2 },
+  { 0x300, 0x3b7, 0, 0 },
+  { 0x301, 0x3b7, 0, 0 },
+  { 0x313, 0x3b7, 1753, 3 },
+  { 0x314, 0x3b7, 1756, 3 },
+  { 0x342, 0x3b7, 0, 0 },
+  { 0x300, 0x3b9, 0, 0 },
+  { 0x301, 0x3b9, 0, 0 },
+  { 0x304, 0x3b9, 0, 0 },
+  { 0x306, 0x3b9, 0, 0 },
+  { 0x308, 0x3b9, 1759, 3 },
+  { 0x313, 0x3b9, 1762, 3 },
+  { 0x314, 0x3b9, 1765, 3 },
+  { 0x342, 0x3b9, 0, 0 },
+  { 0x300, 0x3bf, 0, 0 },
+  { 0x301, 0x3bf, 0, 0 },
+  { 0x313, 0x3bf, 1768, 2 },
+  { 0x314, 0x3bf, 1770, 2 },
+  { 0x313, 0x3c1, 0, 0 },
+  { 0x314, 0x3c1, 0, 0 },
+  { 0x300, 0x3c5, 0, 0 },
+  { 0x301, 0x3c5, 0, 0 },
+  { 0x304, 0x3c5, 0, 0 },
+  { 0x306, 0x3c5, 0, 0 },
+  { 0x308, 0x3c5, 1772, 3 },
+  { 0x313, 0x3c5, 1775, 3 },
+  { 0x314, 0x3c5, 1778, 3 },
+  { 0x342, 0x3c5, 0, 0 },
+  { 0x300, 0x3c9, 0, 0 },
+  { 0x301, 0x3c9, 0, 0 },
+  { 0x313, 0x3c9, 1781, 3 },
+  { 0x314, 0x3c9, 1784, 3 },
+  { 0x342, 0x3c9, 0, 0 },
+  { 0x301, 0x3d2, 0, 0 },
+  { 0x308, 0x3d2, 0, 0 },
+  { 0x306, 0x410, 0, 0 },
+  { 0x308, 0x410, 0, 0 },
+  { 0x300, 0x415, 0, 0 },
+  { 0x306, 0x415, 0, 0 },
+  { 0x306, 0x416, 0, 0 },
+  { 0x308, 0x416, 0, 0 },
+  { 0x308, 0x417, 0, 0 },
+  { 0x300, 0x418, 0, 0 },
+  { 0x304, 0x418, 0, 0 },
+  { 0x308, 0x418, 0, 0 },
+  { 0x308, 0x41e, 0, 0 },
+  { 0x304, 0x423, 0, 0 },
+  { 0x308, 0x423, 0, 0 },
+  { 0x30b, 0x423, 0, 0 },
+  { 0x308, 0x427, 0, 0 },
+  { 0x308, 0x42b, 0, 0 },
+  { 0x308, 0x42d, 0, 0 },
+  { 0x306, 0x430, 0, 0 },
+  { 0x308, 0x430, 0, 0 },
+  { 0x300, 0x435, 0, 0 },
+  { 0x306, 0x435, 0, 0 },
+  { 0x306, 0x436, 0, 0 },
+  { 0x308, 0x436, 0, 0 },
+  { 0x308, 0x437, 0, 0 },
+  { 0x300, 0x438, 0, 0 },
+  { 0x304, 0x438, 0, 0 },
+  { 0x308, 0x438, 0, 0 },
+  { 0x308, 0x43e, 0, 0 },
+  { 0x304, 0x443, 0, 0 },
+  { 0x308, 0x443, 0, 0 },
+  { 0x30b, 0x443, 0, 0 },
+  { 0x308, 0x447, 0, 0 },
+  { 0x308, 0x44b, 0, 0 },
+  { 0x308, 0x44d, 0, 0 },
+  { 0x30f, 0x474, 0, 0 },
+  { 0x30f, 0x475, 0, 0 },
+  { 0x308, 0x4d8, 0, 0 },
+  { 0x308, 0x4d9, 0, 0 },
+  { 0x308, 0x4e8, 0, 0 },
+  { 0x308, 0x4e9, 0, 0 },
+  { 0x5b7, 0x5d0, 0, 0 },
+  { 0x5b8, 0x5d0, 0, 0 },
+  { 0x5bc, 0x5d0, 0, 0 },
+  { 0x5bc, 0x5d1, 0, 0 },
+  { 0x5bf, 0x5d1, 0, 0 },
+  { 0x5bc, 0x5d2, 0, 0 },
+  { 0x5bc, 0x5d3, 0, 0 },
+  { 0x5bc, 0x5d4, 0, 0 },
+  { 0x5b9, 0x5d5, 0, 0 },
+  { 0x5bc, 0x5d5, 0, 0 },
+  { 0x5bc, 0x5d6, 0, 0 },
+  { 0x5bc, 0x5d8, 0, 0 },
+  { 0x5b4, 0x5d9, 0, 0 },
+  { 0x5bc, 0x5d9, 0, 0 },
+  { 0x5bc, 0x5da, 0, 0 },
+  { 0x5bc, 0x5db, 0, 0 },
+  { 0x5bf, 0x5db, 0, 0 },
+  { 0x5bc, 0x5dc, 0, 0 },
+  { 0x5bc, 0x5de, 0, 0 },
+  { 0x5bc, 0x5e0, 0, 0 },
+  { 0x5bc, 0x5e1, 0, 0 },
+  { 0x5bc, 0x5e3, 0, 0 },
+  { 0x5bc, 0x5e4, 0, 0 },
+  { 0x5bf, 0x5e4, 0, 0 },
+  { 0x5bc, 0x5e6, 0, 0 },
+  { 0x5bc, 0x5e7, 0, 0 },
+  { 0x5bc, 0x5e8, 0, 0 },
+  { 0x5bc, 0x5e9, 1787, 2 },
+  { 0x5c1, 0x5e9, 0, 0 },
+  { 0x5c2, 0x5e9, 0, 0 },
+  { 0x5bc, 0x5ea, 0, 0 },
+  { 0x300, 0x41, 0, 0 },
+  { 0x301, 0x41, 0, 0 },
+  { 0x303, 0x41, 0, 0 },
+  { 0x309, 0x41, 0, 0 },
+  { 0x300, 0x41, 0, 0 },
+  { 0x301, 0x41, 0, 0 },
+  { 0x303, 0x41, 0, 0 },
+  { 0x309, 0x41, 0, 0 },
+  { 0x304, 0x41, 0, 0 },
+  { 0x304, 0x41, 0, 0 },
+  { 0x301, 0x41, 0, 0 },
+  { 0x302, 0x41, 0, 0 },
+  { 0x306, 0x41, 0, 0 },
+  { 0x301, 0x43, 0, 0 },
+  { 0x300, 0x45, 0, 0 },
+  { 0x301, 0x45, 0, 0 },
+  { 0x303, 0x45, 0, 0 },
+  { 0x309, 0x45, 0, 0 },
+  { 0x300, 0x45, 0, 0 },
+  { 0x301, 0x45, 0, 0 },
+  { 0x302, 0x45, 0, 0 },
+  { 0x306, 0x45, 0, 0 },
+  { 0x301, 0x49, 0, 0 },
+  { 0x304, 0x4c, 0, 0 },
+  { 0x300, 0x4f, 0, 0 },
+  { 0x301, 0x4f, 0, 0 },
+  { 0x303, 0x4f, 0, 0 },
+  { 0x309, 0x4f, 0, 0 },
+  { 0x301, 0x4f, 0, 0 },
+  { 0x304, 0x4f, 0, 0 },
+  { 0x308, 0x4f, 0, 0 },
+  { 0x300, 0x4f, 0, 0 },
+  { 0x301, 0x4f, 0, 0 },
+  { 0x304, 0x4f, 0, 0 },
+  { 0x304, 0x4f, 0, 0 },
+  { 0x300, 0x4f, 0, 0 },
+  { 0x301, 0x4f, 0, 0 },
+  { 0x303, 0x4f, 0, 0 },
+  { 0x309, 0x4f, 0, 0 },
+  { 0x323, 0x4f, 0, 0 },
+  { 0x302, 0x4f, 0, 0 },
+  { 0x304, 0x4f, 0, 0 },
+  { 0x304, 0x52, 0, 0 },
+  { 0x307, 0x53, 0, 0 },
+  { 0x307, 0x53, 0, 0 },
+  { 0x307, 0x53, 0, 0 },
+  { 0x301, 0x55, 0, 0 },
+  { 0x308, 0x55, 0, 0 },
+  { 0x300, 0x55, 0, 0 },
+  { 0x301, 0x55, 0, 0 },
+  { 0x304, 0x55, 0, 0 },
+  { 0x30c, 0x55, 0, 0 },
+  { 0x300, 0x55, 0, 0 },
+  { 0x301, 0x55, 0, 0 },
+  { 0x303, 0x55, 0, 0 },
+  { 0x309, 0x55, 0, 0 },
+  { 0x323, 0x55, 0, 0 },
+  { 0x300, 0x61, 0, 0 },
+  { 0x301, 0x61, 0, 0 },
+  { 0x303, 0x61, 0, 0 },
+  { 0x309, 0x61, 0, 0 },
+  { 0x300, 0x61, 0, 0 },
+  { 0x301, 0x61, 0, 0 },
+  { 0x303, 0x61, 0, 0 },
+  { 0x309, 0x61, 0, 0 },
+  { 0x304, 0x61, 0, 0 },
+  { 0x304, 0x61, 0, 0 },
+  { 0x301, 0x61, 0, 0 },
+  { 0x302, 0x61, 0, 0 },
+  { 0x306, 0x61, 0, 0 },
+  { 0x301, 0x63, 0, 0 },
+  { 0x300, 0x65, 0, 0 },
+  { 0x301, 0x65, 0, 0 },
+  { 0x303, 0x65, 0, 0 },
+  { 0x309, 0x65, 0, 0 },
+  { 0x300, 0x65, 0, 0 },
+  { 0x301, 0x65, 0, 0 },
+  { 0x302, 0x65, 0, 0 },
+  { 0x306, 0x65, 0, 0 },
+  { 0x301, 0x69, 0, 0 },
+  { 0x304, 0x6c, 0, 0 },
+  { 0x300, 0x6f, 0, 0 },
+  { 0x301, 0x6f, 0, 0 },
+  { 0x303, 0x6f, 0, 0 },
+  { 0x309, 0x6f, 0, 0 },
+  { 0x301, 0x6f, 0, 0 },
+  { 0x304, 0x6f, 0, 0 },
+  { 0x308, 0x6f, 0, 0 },
+  { 0x300, 0x6f, 0, 0 },
+  { 0x301, 0x6f, 0, 0 },
+  { 0x304, 0x6f, 0, 0 },
+  { 0x304, 0x6f, 0, 0 },
+  { 0x300, 0x6f, 0, 0 },
+  { 0x301, 0x6f, 0, 0 },
+  { 0x303, 0x6f, 0, 0 },
+  { 0x309, 0x6f, 0, 0 },
+  { 0x323, 0x6f, 0, 0 },
+  { 0x302, 0x6f, 0, 0 },
+  { 0x304, 0x6f, 0, 0 },
+  { 0x304, 0x72, 0, 0 },
+  { 0x307, 0x73, 0, 0 },
+  { 0x307, 0x73, 0, 0 },
+  { 0x307, 0x73, 0, 0 },
+  { 0x301, 0x75, 0, 0 },
+  { 0x308, 0x75, 0, 0 },
+  { 0x300, 0x75, 0, 0 },
+  { 0x301, 0x75, 0, 0 },
+  { 0x304, 0x75, 0, 0 },
+  { 0x30c, 0x75, 0, 0 },
+  { 0x300, 0x75, 0, 0 },
+  { 0x301, 0x75, 0, 0 },
+  { 0x303, 0x75, 0, 0 },
+  { 0x309, 0x75, 0, 0 },
+  { 0x323, 0x75, 0, 0 },
+  { 0x300, 0x391, 0, 0 },
+  { 0x301, 0x391, 0, 0 },
+  { 0x342, 0x391, 0, 0 },
+  { 0x300, 0x391, 0, 0 },
+  { 0x301, 0x391, 0, 0 },
+  { 0x342, 0x391, 0, 0 },
+  { 0x300, 0x395, 0, 0 },
+  { 0x301, 0x395, 0, 0 },
+  { 0x300, 0x395, 0, 0 },
+  { 0x301, 0x395, 0, 0 },
+  { 0x300, 0x397, 0, 0 },
+  { 0x301, 0x397, 0, 0 },
+  { 0x342, 0x397, 0, 0 },
+  { 0x300, 0x397, 0, 0 },
+  { 0x301, 0x397, 0, 0 },
+  { 0x342, 0x397, 0, 0 },
+  { 0x300, 0x399, 0, 0 },
+  { 0x301, 0x399, 0, 0 },
+  { 0x342, 0x399, 0, 0 },
+  { 0x300, 0x399, 0, 0 },
+  { 0x301, 0x399, 0, 0 },
+  { 0x342, 0x399, 0, 0 },
+  { 0x300, 0x39f, 0, 0 },
+  { 0x301, 0x39f, 0, 0 },
+  { 0x300, 0x39f, 0, 0 },
+  { 0x301, 0x39f, 0, 0 },
+  { 0x300, 0x3a5, 0, 0 },
+  { 0x301, 0x3a5, 0, 0 },
+  { 0x342, 0x3a5, 0, 0 },
+  { 0x300, 0x3a9, 0, 0 },
+  { 0x301, 0x3a9, 0, 0 },
+  { 0x342, 0x3a9, 0, 0 },
+  { 0x300, 0x3a9, 0, 0 },
+  { 0x301, 0x3a9, 0, 0 },
+  { 0x342, 0x3a9, 0, 0 },
+  { 0x300, 0x3b1, 0, 0 },
+  { 0x301, 0x3b1, 0, 0 },
+  { 0x342, 0x3b1, 0, 0 },
+  { 0x300, 0x3b1, 0, 0 },
+  { 0x301, 0x3b1, 0, 0 },
+  { 0x342, 0x3b1, 0, 0 },
+  { 0x300, 0x3b5, 0, 0 },
+  { 0x301, 0x3b5, 0, 0 },
+  { 0x300, 0x3b5, 0, 0 },
+  { 0x301, 0x3b5, 0, 0 },
+  { 0x300, 0x3b7, 0, 0 },
+  { 0x301, 0x3b7, 0, 0 },
+  { 0x342, 0x3b7, 0, 0 },
+  { 0x300, 0x3b7, 0, 0 },
+  { 0x301, 0x3b7, 0, 0 },
+  { 0x342, 0x3b7, 0, 0 },
+  { 0x300, 0x3b9, 0, 0 },
+  { 0x301, 0x3b9, 0, 0 },
+  { 0x342, 0x3b9, 0, 0 },
+  { 0x300, 0x3b9, 0, 0 },
+  { 0x301, 0x3b9, 0, 0 },
+  { 0x342, 0x3b9, 0, 0 },
+  { 0x300, 0x3b9, 0, 0 },
+  { 0x301, 0x3b9, 0, 0 },
+  { 0x342, 0x3b9, 0, 0 },
+  { 0x300, 0x3bf, 0, 0 },
+  { 0x301, 0x3bf, 0, 0 },
+  { 0x300, 0x3bf, 0, 0 },
+  { 0x301, 0x3bf, 0, 0 },
+  { 0x300, 0x3c5, 0, 0 },
+  { 0x301, 0x3c5, 0, 0 },
+  { 0x342, 0x3c5, 0, 0 },
+  { 0x300, 0x3c5, 0, 0 },
+  { 0x301, 0x3c5, 0, 0 },
+  { 0x342, 0x3c5, 0, 0 },
+  { 0x300, 0x3c5, 0, 0 },
+  { 0x301, 0x3c5, 0, 0 },
+  { 0x342, 0x3c5, 0, 0 },
+  { 0x300, 0x3c9, 0, 0 },
+  { 0x301, 0x3c9, 0, 0 },
+  { 0x342, 0x3c9, 0, 0 },
+  { 0x300, 0x3c9, 0, 0 },
+  { 0x301, 0x3c9, 0, 0 },
+  { 0x342, 0x3c9, 0, 0 },
+  { 0x5c1, 0x5e9, 0, 0 },
+  { 0x5c2, 0x5e9, 0, 0 }
+};
+
 wchar foldDiacritic( wchar const * in, size_t size, size_t & consumed )
 {
-  if ( size > 0 )
+  if ( !size )
   {
-    switch( in[ 0 ] )
-    {
-      case 0x41:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x41;
-            case 0x301:
-              consumed = 2; return 0x41;
-            case 0x302:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x41;
-                  case 0x301:
-                    consumed = 3; return 0x41;
-                  case 0x303:
-                    consumed = 3; return 0x41;
-                  case 0x309:
-                    consumed = 3; return 0x41;
-                }
-              }
-              consumed = 2; return 0x41;
-            case 0x303:
-              consumed = 2; return 0x41;
-            case 0x304:
-              consumed = 2; return 0x41;
-            case 0x306:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x41;
-                  case 0x301:
-                    consumed = 3; return 0x41;
-                  case 0x303:
-                    consumed = 3; return 0x41;
-                  case 0x309:
-                    consumed = 3; return 0x41;
-                }
-              }
-              consumed = 2; return 0x41;
-            case 0x307:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x304:
-                    consumed = 3; return 0x41;
-                }
-              }
-              consumed = 2; return 0x41;
-            case 0x308:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x304:
-                    consumed = 3; return 0x41;
-                }
-              }
-              consumed = 2; return 0x41;
-            case 0x309:
-              consumed = 2; return 0x41;
-            case 0x30a:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x301:
-                    consumed = 3; return 0x41;
-                }
-              }
-              consumed = 2; return 0x41;
-            case 0x30c:
-              consumed = 2; return 0x41;
-            case 0x30f:
-              consumed = 2; return 0x41;
-            case 0x311:
-              consumed = 2; return 0x41;
-            case 0x323:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x302:
-                    consumed = 3; return 0x41;
-                  case 0x306:
-                    consumed = 3; return 0x41;
-                }
-              }
-              consumed = 2; return 0x41;
-            case 0x325:
-              consumed = 2; return 0x41;
-            case 0x328:
-              consumed = 2; return 0x41;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x42:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x307:
-              consumed = 2; return 0x42;
-            case 0x323:
-              consumed = 2; return 0x42;
-            case 0x331:
-              consumed = 2; return 0x42;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x43:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0x43;
-            case 0x302:
-              consumed = 2; return 0x43;
-            case 0x307:
-              consumed = 2; return 0x43;
-            case 0x30c:
-              consumed = 2; return 0x43;
-            case 0x327:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x301:
-                    consumed = 3; return 0x43;
-                }
-              }
-              consumed = 2; return 0x43;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x44:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x307:
-              consumed = 2; return 0x44;
-            case 0x30c:
-              consumed = 2; return 0x44;
-            case 0x323:
-              consumed = 2; return 0x44;
-            case 0x327:
-              consumed = 2; return 0x44;
-            case 0x32d:
-              consumed = 2; return 0x44;
-            case 0x331:
-              consumed = 2; return 0x44;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x45:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x45;
-            case 0x301:
-              consumed = 2; return 0x45;
-            case 0x302:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x45;
-                  case 0x301:
-                    consumed = 3; return 0x45;
-                  case 0x303:
-                    consumed = 3; return 0x45;
-                  case 0x309:
-                    consumed = 3; return 0x45;
-                }
-              }
-              consumed = 2; return 0x45;
-            case 0x303:
-              consumed = 2; return 0x45;
-            case 0x304:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x45;
-                  case 0x301:
-                    consumed = 3; return 0x45;
-                }
-              }
-              consumed = 2; return 0x45;
-            case 0x306:
-              consumed = 2; return 0x45;
-            case 0x307:
-              consumed = 2; return 0x45;
-            case 0x308:
-              consumed = 2; return 0x45;
-            case 0x309:
-              consumed = 2; return 0x45;
-            case 0x30c:
-              consumed = 2; return 0x45;
-            case 0x30f:
-              consumed = 2; return 0x45;
-            case 0x311:
-              consumed = 2; return 0x45;
-            case 0x323:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x302:
-                    consumed = 3; return 0x45;
-                }
-              }
-              consumed = 2; return 0x45;
-            case 0x327:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x306:
-                    consumed = 3; return 0x45;
-                }
-              }
-              consumed = 2; return 0x45;
-            case 0x328:
-              consumed = 2; return 0x45;
-            case 0x32d:
-              consumed = 2; return 0x45;
-            case 0x330:
-              consumed = 2; return 0x45;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x46:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x307:
-              consumed = 2; return 0x46;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x47:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0x47;
-            case 0x302:
-              consumed = 2; return 0x47;
-            case 0x304:
-              consumed = 2; return 0x47;
-            case 0x306:
-              consumed = 2; return 0x47;
-            case 0x307:
-              consumed = 2; return 0x47;
-            case 0x30c:
-              consumed = 2; return 0x47;
-            case 0x327:
-              consumed = 2; return 0x47;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x48:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x302:
-              consumed = 2; return 0x48;
-            case 0x307:
-              consumed = 2; return 0x48;
-            case 0x308:
-              consumed = 2; return 0x48;
-            case 0x30c:
-              consumed = 2; return 0x48;
-            case 0x323:
-              consumed = 2; return 0x48;
-            case 0x327:
-              consumed = 2; return 0x48;
-            case 0x32e:
-              consumed = 2; return 0x48;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x49:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x49;
-            case 0x301:
-              consumed = 2; return 0x49;
-            case 0x302:
-              consumed = 2; return 0x49;
-            case 0x303:
-              consumed = 2; return 0x49;
-            case 0x304:
-              consumed = 2; return 0x49;
-            case 0x306:
-              consumed = 2; return 0x49;
-            case 0x307:
-              consumed = 2; return 0x49;
-            case 0x308:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x301:
-                    consumed = 3; return 0x49;
-                }
-              }
-              consumed = 2; return 0x49;
-            case 0x309:
-              consumed = 2; return 0x49;
-            case 0x30c:
-              consumed = 2; return 0x49;
-            case 0x30f:
-              consumed = 2; return 0x49;
-            case 0x311:
-              consumed = 2; return 0x49;
-            case 0x323:
-              consumed = 2; return 0x49;
-            case 0x328:
-              consumed = 2; return 0x49;
-            case 0x330:
-              consumed = 2; return 0x49;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x4a:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x302:
-              consumed = 2; return 0x4a;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x4b:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0x4b;
-            case 0x30c:
-              consumed = 2; return 0x4b;
-            case 0x323:
-              consumed = 2; return 0x4b;
-            case 0x327:
-              consumed = 2; return 0x4b;
-            case 0x331:
-              consumed = 2; return 0x4b;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x4c:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0x4c;
-            case 0x30c:
-              consumed = 2; return 0x4c;
-            case 0x323:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x304:
-                    consumed = 3; return 0x4c;
-                }
-              }
-              consumed = 2; return 0x4c;
-            case 0x327:
-              consumed = 2; return 0x4c;
-            case 0x32d:
-              consumed = 2; return 0x4c;
-            case 0x331:
-              consumed = 2; return 0x4c;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x4d:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0x4d;
-            case 0x307:
-              consumed = 2; return 0x4d;
-            case 0x323:
-              consumed = 2; return 0x4d;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x4e:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x4e;
-            case 0x301:
-              consumed = 2; return 0x4e;
-            case 0x303:
-              consumed = 2; return 0x4e;
-            case 0x307:
-              consumed = 2; return 0x4e;
-            case 0x30c:
-              consumed = 2; return 0x4e;
-            case 0x323:
-              consumed = 2; return 0x4e;
-            case 0x327:
-              consumed = 2; return 0x4e;
-            case 0x32d:
-              consumed = 2; return 0x4e;
-            case 0x331:
-              consumed = 2; return 0x4e;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x4f:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x4f;
-            case 0x301:
-              consumed = 2; return 0x4f;
-            case 0x302:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x4f;
-                  case 0x301:
-                    consumed = 3; return 0x4f;
-                  case 0x303:
-                    consumed = 3; return 0x4f;
-                  case 0x309:
-                    consumed = 3; return 0x4f;
-                }
-              }
-              consumed = 2; return 0x4f;
-            case 0x303:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x301:
-                    consumed = 3; return 0x4f;
-                  case 0x304:
-                    consumed = 3; return 0x4f;
-                  case 0x308:
-                    consumed = 3; return 0x4f;
-                }
-              }
-              consumed = 2; return 0x4f;
-            case 0x304:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x4f;
-                  case 0x301:
-                    consumed = 3; return 0x4f;
-                }
-              }
-              consumed = 2; return 0x4f;
-            case 0x306:
-              consumed = 2; return 0x4f;
-            case 0x307:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x304:
-                    consumed = 3; return 0x4f;
-                }
-              }
-              consumed = 2; return 0x4f;
-            case 0x308:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x304:
-                    consumed = 3; return 0x4f;
-                }
-              }
-              consumed = 2; return 0x4f;
-            case 0x309:
-              consumed = 2; return 0x4f;
-            case 0x30b:
-              consumed = 2; return 0x4f;
-            case 0x30c:
-              consumed = 2; return 0x4f;
-            case 0x30f:
-              consumed = 2; return 0x4f;
-            case 0x311:
-              consumed = 2; return 0x4f;
-            case 0x31b:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x4f;
-                  case 0x301:
-                    consumed = 3; return 0x4f;
-                  case 0x303:
-                    consumed = 3; return 0x4f;
-                  case 0x309:
-                    consumed = 3; return 0x4f;
-                  case 0x323:
-                    consumed = 3; return 0x4f;
-                }
-              }
-              consumed = 2; return 0x4f;
-            case 0x323:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x302:
-                    consumed = 3; return 0x4f;
-                }
-              }
-              consumed = 2; return 0x4f;
-            case 0x328:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x304:
-                    consumed = 3; return 0x4f;
-                }
-              }
-              consumed = 2; return 0x4f;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x50:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0x50;
-            case 0x307:
-              consumed = 2; return 0x50;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x52:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0x52;
-            case 0x307:
-              consumed = 2; return 0x52;
-            case 0x30c:
-              consumed = 2; return 0x52;
-            case 0x30f:
-              consumed = 2; return 0x52;
-            case 0x311:
-              consumed = 2; return 0x52;
-            case 0x323:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x304:
-                    consumed = 3; return 0x52;
-                }
-              }
-              consumed = 2; return 0x52;
-            case 0x327:
-              consumed = 2; return 0x52;
-            case 0x331:
-              consumed = 2; return 0x52;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x53:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x307:
-                    consumed = 3; return 0x53;
-                }
-              }
-              consumed = 2; return 0x53;
-            case 0x302:
-              consumed = 2; return 0x53;
-            case 0x307:
-              consumed = 2; return 0x53;
-            case 0x30c:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x307:
-                    consumed = 3; return 0x53;
-                }
-              }
-              consumed = 2; return 0x53;
-            case 0x323:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x307:
-                    consumed = 3; return 0x53;
-                }
-              }
-              consumed = 2; return 0x53;
-            case 0x326:
-              consumed = 2; return 0x53;
-            case 0x327:
-              consumed = 2; return 0x53;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x54:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x307:
-              consumed = 2; return 0x54;
-            case 0x30c:
-              consumed = 2; return 0x54;
-            case 0x323:
-              consumed = 2; return 0x54;
-            case 0x326:
-              consumed = 2; return 0x54;
-            case 0x327:
-              consumed = 2; return 0x54;
-            case 0x32d:
-              consumed = 2; return 0x54;
-            case 0x331:
-              consumed = 2; return 0x54;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x55:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x55;
-            case 0x301:
-              consumed = 2; return 0x55;
-            case 0x302:
-              consumed = 2; return 0x55;
-            case 0x303:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x301:
-                    consumed = 3; return 0x55;
-                }
-              }
-              consumed = 2; return 0x55;
-            case 0x304:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x308:
-                    consumed = 3; return 0x55;
-                }
-              }
-              consumed = 2; return 0x55;
-            case 0x306:
-              consumed = 2; return 0x55;
-            case 0x308:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x55;
-                  case 0x301:
-                    consumed = 3; return 0x55;
-                  case 0x304:
-                    consumed = 3; return 0x55;
-                  case 0x30c:
-                    consumed = 3; return 0x55;
-                }
-              }
-              consumed = 2; return 0x55;
-            case 0x309:
-              consumed = 2; return 0x55;
-            case 0x30a:
-              consumed = 2; return 0x55;
-            case 0x30b:
-              consumed = 2; return 0x55;
-            case 0x30c:
-              consumed = 2; return 0x55;
-            case 0x30f:
-              consumed = 2; return 0x55;
-            case 0x311:
-              consumed = 2; return 0x55;
-            case 0x31b:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x55;
-                  case 0x301:
-                    consumed = 3; return 0x55;
-                  case 0x303:
-                    consumed = 3; return 0x55;
-                  case 0x309:
-                    consumed = 3; return 0x55;
-                  case 0x323:
-                    consumed = 3; return 0x55;
-                }
-              }
-              consumed = 2; return 0x55;
-            case 0x323:
-              consumed = 2; return 0x55;
-            case 0x324:
-              consumed = 2; return 0x55;
-            case 0x328:
-              consumed = 2; return 0x55;
-            case 0x32d:
-              consumed = 2; return 0x55;
-            case 0x330:
-              consumed = 2; return 0x55;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x56:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x303:
-              consumed = 2; return 0x56;
-            case 0x323:
-              consumed = 2; return 0x56;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x57:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x57;
-            case 0x301:
-              consumed = 2; return 0x57;
-            case 0x302:
-              consumed = 2; return 0x57;
-            case 0x307:
-              consumed = 2; return 0x57;
-            case 0x308:
-              consumed = 2; return 0x57;
-            case 0x323:
-              consumed = 2; return 0x57;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x58:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x307:
-              consumed = 2; return 0x58;
-            case 0x308:
-              consumed = 2; return 0x58;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x59:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x59;
-            case 0x301:
-              consumed = 2; return 0x59;
-            case 0x302:
-              consumed = 2; return 0x59;
-            case 0x303:
-              consumed = 2; return 0x59;
-            case 0x304:
-              consumed = 2; return 0x59;
-            case 0x307:
-              consumed = 2; return 0x59;
-            case 0x308:
-              consumed = 2; return 0x59;
-            case 0x309:
-              consumed = 2; return 0x59;
-            case 0x323:
-              consumed = 2; return 0x59;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5a:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0x5a;
-            case 0x302:
-              consumed = 2; return 0x5a;
-            case 0x307:
-              consumed = 2; return 0x5a;
-            case 0x30c:
-              consumed = 2; return 0x5a;
-            case 0x323:
-              consumed = 2; return 0x5a;
-            case 0x331:
-              consumed = 2; return 0x5a;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x61:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x61;
-            case 0x301:
-              consumed = 2; return 0x61;
-            case 0x302:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x61;
-                  case 0x301:
-                    consumed = 3; return 0x61;
-                  case 0x303:
-                    consumed = 3; return 0x61;
-                  case 0x309:
-                    consumed = 3; return 0x61;
-                }
-              }
-              consumed = 2; return 0x61;
-            case 0x303:
-              consumed = 2; return 0x61;
-            case 0x304:
-              consumed = 2; return 0x61;
-            case 0x306:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x61;
-                  case 0x301:
-                    consumed = 3; return 0x61;
-                  case 0x303:
-                    consumed = 3; return 0x61;
-                  case 0x309:
-                    consumed = 3; return 0x61;
-                }
-              }
-              consumed = 2; return 0x61;
-            case 0x307:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x304:
-                    consumed = 3; return 0x61;
-                }
-              }
-              consumed = 2; return 0x61;
-            case 0x308:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x304:
-                    consumed = 3; return 0x61;
-                }
-              }
-              consumed = 2; return 0x61;
-            case 0x309:
-              consumed = 2; return 0x61;
-            case 0x30a:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x301:
-                    consumed = 3; return 0x61;
-                }
-              }
-              consumed = 2; return 0x61;
-            case 0x30c:
-              consumed = 2; return 0x61;
-            case 0x30f:
-              consumed = 2; return 0x61;
-            case 0x311:
-              consumed = 2; return 0x61;
-            case 0x323:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x302:
-                    consumed = 3; return 0x61;
-                  case 0x306:
-                    consumed = 3; return 0x61;
-                }
-              }
-              consumed = 2; return 0x61;
-            case 0x325:
-              consumed = 2; return 0x61;
-            case 0x328:
-              consumed = 2; return 0x61;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x62:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x307:
-              consumed = 2; return 0x62;
-            case 0x323:
-              consumed = 2; return 0x62;
-            case 0x331:
-              consumed = 2; return 0x62;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x63:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0x63;
-            case 0x302:
-              consumed = 2; return 0x63;
-            case 0x307:
-              consumed = 2; return 0x63;
-            case 0x30c:
-              consumed = 2; return 0x63;
-            case 0x327:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x301:
-                    consumed = 3; return 0x63;
-                }
-              }
-              consumed = 2; return 0x63;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x64:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x307:
-              consumed = 2; return 0x64;
-            case 0x30c:
-              consumed = 2; return 0x64;
-            case 0x323:
-              consumed = 2; return 0x64;
-            case 0x327:
-              consumed = 2; return 0x64;
-            case 0x32d:
-              consumed = 2; return 0x64;
-            case 0x331:
-              consumed = 2; return 0x64;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x65:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x65;
-            case 0x301:
-              consumed = 2; return 0x65;
-            case 0x302:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x65;
-                  case 0x301:
-                    consumed = 3; return 0x65;
-                  case 0x303:
-                    consumed = 3; return 0x65;
-                  case 0x309:
-                    consumed = 3; return 0x65;
-                }
-              }
-              consumed = 2; return 0x65;
-            case 0x303:
-              consumed = 2; return 0x65;
-            case 0x304:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x65;
-                  case 0x301:
-                    consumed = 3; return 0x65;
-                }
-              }
-              consumed = 2; return 0x65;
-            case 0x306:
-              consumed = 2; return 0x65;
-            case 0x307:
-              consumed = 2; return 0x65;
-            case 0x308:
-              consumed = 2; return 0x65;
-            case 0x309:
-              consumed = 2; return 0x65;
-            case 0x30c:
-              consumed = 2; return 0x65;
-            case 0x30f:
-              consumed = 2; return 0x65;
-            case 0x311:
-              consumed = 2; return 0x65;
-            case 0x323:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x302:
-                    consumed = 3; return 0x65;
-                }
-              }
-              consumed = 2; return 0x65;
-            case 0x327:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x306:
-                    consumed = 3; return 0x65;
-                }
-              }
-              consumed = 2; return 0x65;
-            case 0x328:
-              consumed = 2; return 0x65;
-            case 0x32d:
-              consumed = 2; return 0x65;
-            case 0x330:
-              consumed = 2; return 0x65;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x66:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x307:
-              consumed = 2; return 0x66;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x67:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0x67;
-            case 0x302:
-              consumed = 2; return 0x67;
-            case 0x304:
-              consumed = 2; return 0x67;
-            case 0x306:
-              consumed = 2; return 0x67;
-            case 0x307:
-              consumed = 2; return 0x67;
-            case 0x30c:
-              consumed = 2; return 0x67;
-            case 0x327:
-              consumed = 2; return 0x67;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x68:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x302:
-              consumed = 2; return 0x68;
-            case 0x307:
-              consumed = 2; return 0x68;
-            case 0x308:
-              consumed = 2; return 0x68;
-            case 0x30c:
-              consumed = 2; return 0x68;
-            case 0x323:
-              consumed = 2; return 0x68;
-            case 0x327:
-              consumed = 2; return 0x68;
-            case 0x32e:
-              consumed = 2; return 0x68;
-            case 0x331:
-              consumed = 2; return 0x68;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x69:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x69;
-            case 0x301:
-              consumed = 2; return 0x69;
-            case 0x302:
-              consumed = 2; return 0x69;
-            case 0x303:
-              consumed = 2; return 0x69;
-            case 0x304:
-              consumed = 2; return 0x69;
-            case 0x306:
-              consumed = 2; return 0x69;
-            case 0x308:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x301:
-                    consumed = 3; return 0x69;
-                }
-              }
-              consumed = 2; return 0x69;
-            case 0x309:
-              consumed = 2; return 0x69;
-            case 0x30c:
-              consumed = 2; return 0x69;
-            case 0x30f:
-              consumed = 2; return 0x69;
-            case 0x311:
-              consumed = 2; return 0x69;
-            case 0x323:
-              consumed = 2; return 0x69;
-            case 0x328:
-              consumed = 2; return 0x69;
-            case 0x330:
-              consumed = 2; return 0x69;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x6a:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x302:
-              consumed = 2; return 0x6a;
-            case 0x30c:
-              consumed = 2; return 0x6a;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x6b:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0x6b;
-            case 0x30c:
-              consumed = 2; return 0x6b;
-            case 0x323:
-              consumed = 2; return 0x6b;
-            case 0x327:
-              consumed = 2; return 0x6b;
-            case 0x331:
-              consumed = 2; return 0x6b;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x6c:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0x6c;
-            case 0x30c:
-              consumed = 2; return 0x6c;
-            case 0x323:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x304:
-                    consumed = 3; return 0x6c;
-                }
-              }
-              consumed = 2; return 0x6c;
-            case 0x327:
-              consumed = 2; return 0x6c;
-            case 0x32d:
-              consumed = 2; return 0x6c;
-            case 0x331:
-              consumed = 2; return 0x6c;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x6d:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0x6d;
-            case 0x307:
-              consumed = 2; return 0x6d;
-            case 0x323:
-              consumed = 2; return 0x6d;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x6e:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x6e;
-            case 0x301:
-              consumed = 2; return 0x6e;
-            case 0x303:
-              consumed = 2; return 0x6e;
-            case 0x307:
-              consumed = 2; return 0x6e;
-            case 0x30c:
-              consumed = 2; return 0x6e;
-            case 0x323:
-              consumed = 2; return 0x6e;
-            case 0x327:
-              consumed = 2; return 0x6e;
-            case 0x32d:
-              consumed = 2; return 0x6e;
-            case 0x331:
-              consumed = 2; return 0x6e;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x6f:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x6f;
-            case 0x301:
-              consumed = 2; return 0x6f;
-            case 0x302:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x6f;
-                  case 0x301:
-                    consumed = 3; return 0x6f;
-                  case 0x303:
-                    consumed = 3; return 0x6f;
-                  case 0x309:
-                    consumed = 3; return 0x6f;
-                }
-              }
-              consumed = 2; return 0x6f;
-            case 0x303:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x301:
-                    consumed = 3; return 0x6f;
-                  case 0x304:
-                    consumed = 3; return 0x6f;
-                  case 0x308:
-                    consumed = 3; return 0x6f;
-                }
-              }
-              consumed = 2; return 0x6f;
-            case 0x304:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x6f;
-                  case 0x301:
-                    consumed = 3; return 0x6f;
-                }
-              }
-              consumed = 2; return 0x6f;
-            case 0x306:
-              consumed = 2; return 0x6f;
-            case 0x307:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x304:
-                    consumed = 3; return 0x6f;
-                }
-              }
-              consumed = 2; return 0x6f;
-            case 0x308:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x304:
-                    consumed = 3; return 0x6f;
-                }
-              }
-              consumed = 2; return 0x6f;
-            case 0x309:
-              consumed = 2; return 0x6f;
-            case 0x30b:
-              consumed = 2; return 0x6f;
-            case 0x30c:
-              consumed = 2; return 0x6f;
-            case 0x30f:
-              consumed = 2; return 0x6f;
-            case 0x311:
-              consumed = 2; return 0x6f;
-            case 0x31b:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x6f;
-                  case 0x301:
-                    consumed = 3; return 0x6f;
-                  case 0x303:
-                    consumed = 3; return 0x6f;
-                  case 0x309:
-                    consumed = 3; return 0x6f;
-                  case 0x323:
-                    consumed = 3; return 0x6f;
-                }
-              }
-              consumed = 2; return 0x6f;
-            case 0x323:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x302:
-                    consumed = 3; return 0x6f;
-                }
-              }
-              consumed = 2; return 0x6f;
-            case 0x328:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x304:
-                    consumed = 3; return 0x6f;
-                }
-              }
-              consumed = 2; return 0x6f;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x70:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0x70;
-            case 0x307:
-              consumed = 2; return 0x70;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x72:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0x72;
-            case 0x307:
-              consumed = 2; return 0x72;
-            case 0x30c:
-              consumed = 2; return 0x72;
-            case 0x30f:
-              consumed = 2; return 0x72;
-            case 0x311:
-              consumed = 2; return 0x72;
-            case 0x323:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x304:
-                    consumed = 3; return 0x72;
-                }
-              }
-              consumed = 2; return 0x72;
-            case 0x327:
-              consumed = 2; return 0x72;
-            case 0x331:
-              consumed = 2; return 0x72;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x73:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x307:
-                    consumed = 3; return 0x73;
-                }
-              }
-              consumed = 2; return 0x73;
-            case 0x302:
-              consumed = 2; return 0x73;
-            case 0x307:
-              consumed = 2; return 0x73;
-            case 0x30c:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x307:
-                    consumed = 3; return 0x73;
-                }
-              }
-              consumed = 2; return 0x73;
-            case 0x323:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x307:
-                    consumed = 3; return 0x73;
-                }
-              }
-              consumed = 2; return 0x73;
-            case 0x326:
-              consumed = 2; return 0x73;
-            case 0x327:
-              consumed = 2; return 0x73;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x74:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x307:
-              consumed = 2; return 0x74;
-            case 0x308:
-              consumed = 2; return 0x74;
-            case 0x30c:
-              consumed = 2; return 0x74;
-            case 0x323:
-              consumed = 2; return 0x74;
-            case 0x326:
-              consumed = 2; return 0x74;
-            case 0x327:
-              consumed = 2; return 0x74;
-            case 0x32d:
-              consumed = 2; return 0x74;
-            case 0x331:
-              consumed = 2; return 0x74;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x75:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x75;
-            case 0x301:
-              consumed = 2; return 0x75;
-            case 0x302:
-              consumed = 2; return 0x75;
-            case 0x303:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x301:
-                    consumed = 3; return 0x75;
-                }
-              }
-              consumed = 2; return 0x75;
-            case 0x304:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x308:
-                    consumed = 3; return 0x75;
-                }
-              }
-              consumed = 2; return 0x75;
-            case 0x306:
-              consumed = 2; return 0x75;
-            case 0x308:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x75;
-                  case 0x301:
-                    consumed = 3; return 0x75;
-                  case 0x304:
-                    consumed = 3; return 0x75;
-                  case 0x30c:
-                    consumed = 3; return 0x75;
-                }
-              }
-              consumed = 2; return 0x75;
-            case 0x309:
-              consumed = 2; return 0x75;
-            case 0x30a:
-              consumed = 2; return 0x75;
-            case 0x30b:
-              consumed = 2; return 0x75;
-            case 0x30c:
-              consumed = 2; return 0x75;
-            case 0x30f:
-              consumed = 2; return 0x75;
-            case 0x311:
-              consumed = 2; return 0x75;
-            case 0x31b:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x75;
-                  case 0x301:
-                    consumed = 3; return 0x75;
-                  case 0x303:
-                    consumed = 3; return 0x75;
-                  case 0x309:
-                    consumed = 3; return 0x75;
-                  case 0x323:
-                    consumed = 3; return 0x75;
-                }
-              }
-              consumed = 2; return 0x75;
-            case 0x323:
-              consumed = 2; return 0x75;
-            case 0x324:
-              consumed = 2; return 0x75;
-            case 0x328:
-              consumed = 2; return 0x75;
-            case 0x32d:
-              consumed = 2; return 0x75;
-            case 0x330:
-              consumed = 2; return 0x75;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x76:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x303:
-              consumed = 2; return 0x76;
-            case 0x323:
-              consumed = 2; return 0x76;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x77:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x77;
-            case 0x301:
-              consumed = 2; return 0x77;
-            case 0x302:
-              consumed = 2; return 0x77;
-            case 0x307:
-              consumed = 2; return 0x77;
-            case 0x308:
-              consumed = 2; return 0x77;
-            case 0x30a:
-              consumed = 2; return 0x77;
-            case 0x323:
-              consumed = 2; return 0x77;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x78:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x307:
-              consumed = 2; return 0x78;
-            case 0x308:
-              consumed = 2; return 0x78;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x79:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x79;
-            case 0x301:
-              consumed = 2; return 0x79;
-            case 0x302:
-              consumed = 2; return 0x79;
-            case 0x303:
-              consumed = 2; return 0x79;
-            case 0x304:
-              consumed = 2; return 0x79;
-            case 0x307:
-              consumed = 2; return 0x79;
-            case 0x308:
-              consumed = 2; return 0x79;
-            case 0x309:
-              consumed = 2; return 0x79;
-            case 0x30a:
-              consumed = 2; return 0x79;
-            case 0x323:
-              consumed = 2; return 0x79;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x7a:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0x7a;
-            case 0x302:
-              consumed = 2; return 0x7a;
-            case 0x307:
-              consumed = 2; return 0x7a;
-            case 0x30c:
-              consumed = 2; return 0x7a;
-            case 0x323:
-              consumed = 2; return 0x7a;
-            case 0x331:
-              consumed = 2; return 0x7a;
-          }
-        }
-        consumed = 1; return *in;
-      case 0xc0:
-        consumed = 1; return 0x41;
-      case 0xc1:
-        consumed = 1; return 0x41;
-      case 0xc2:
-        consumed = 1; return 0x41;
-      case 0xc3:
-        consumed = 1; return 0x41;
-      case 0xc4:
-        consumed = 1; return 0x41;
-      case 0xc5:
-        consumed = 1; return 0x41;
-      case 0xc6:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0xc6;
-            case 0x304:
-              consumed = 2; return 0xc6;
-          }
-        }
-        consumed = 1; return *in;
-      case 0xc7:
-        consumed = 1; return 0x43;
-      case 0xc8:
-        consumed = 1; return 0x45;
-      case 0xc9:
-        consumed = 1; return 0x45;
-      case 0xca:
-        consumed = 1; return 0x45;
-      case 0xcb:
-        consumed = 1; return 0x45;
-      case 0xcc:
-        consumed = 1; return 0x49;
-      case 0xcd:
-        consumed = 1; return 0x49;
-      case 0xce:
-        consumed = 1; return 0x49;
-      case 0xcf:
-        consumed = 1; return 0x49;
-      case 0xd1:
-        consumed = 1; return 0x4e;
-      case 0xd2:
-        consumed = 1; return 0x4f;
-      case 0xd3:
-        consumed = 1; return 0x4f;
-      case 0xd4:
-        consumed = 1; return 0x4f;
-      case 0xd5:
-        consumed = 1; return 0x4f;
-      case 0xd6:
-        consumed = 1; return 0x4f;
-      case 0xd8:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0xd8;
-          }
-        }
-        consumed = 1; return 0x4f;
-      case 0xd9:
-        consumed = 1; return 0x55;
-      case 0xda:
-        consumed = 1; return 0x55;
-      case 0xdb:
-        consumed = 1; return 0x55;
-      case 0xdc:
-        consumed = 1; return 0x55;
-      case 0xdd:
-        consumed = 1; return 0x59;
-      case 0xe0:
-        consumed = 1; return 0x61;
-      case 0xe1:
-        consumed = 1; return 0x61;
-      case 0xe2:
-        consumed = 1; return 0x61;
-      case 0xe3:
-        consumed = 1; return 0x61;
-      case 0xe4:
-        consumed = 1; return 0x61;
-      case 0xe5:
-        consumed = 1; return 0x61;
-      case 0xe6:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0xe6;
-            case 0x304:
-              consumed = 2; return 0xe6;
-          }
-        }
-        consumed = 1; return *in;
-      case 0xe7:
-        consumed = 1; return 0x63;
-      case 0xe8:
-        consumed = 1; return 0x65;
-      case 0xe9:
-        consumed = 1; return 0x65;
-      case 0xea:
-        consumed = 1; return 0x65;
-      case 0xeb:
-        consumed = 1; return 0x65;
-      case 0xec:
-        consumed = 1; return 0x69;
-      case 0xed:
-        consumed = 1; return 0x69;
-      case 0xee:
-        consumed = 1; return 0x69;
-      case 0xef:
-        consumed = 1; return 0x69;
-      case 0xf1:
-        consumed = 1; return 0x6e;
-      case 0xf2:
-        consumed = 1; return 0x6f;
-      case 0xf3:
-        consumed = 1; return 0x6f;
-      case 0xf4:
-        consumed = 1; return 0x6f;
-      case 0xf5:
-        consumed = 1; return 0x6f;
-      case 0xf6:
-        consumed = 1; return 0x6f;
-      case 0xf8:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0xf8;
-          }
-        }
-        consumed = 1; return 0x6f;
-      case 0xf9:
-        consumed = 1; return 0x75;
-      case 0xfa:
-        consumed = 1; return 0x75;
-      case 0xfb:
-        consumed = 1; return 0x75;
-      case 0xfc:
-        consumed = 1; return 0x75;
-      case 0xfd:
-        consumed = 1; return 0x79;
-      case 0xff:
-        consumed = 1; return 0x79;
-      case 0x100:
-        consumed = 1; return 0x41;
-      case 0x101:
-        consumed = 1; return 0x61;
-      case 0x102:
-        consumed = 1; return 0x41;
-      case 0x103:
-        consumed = 1; return 0x61;
-      case 0x104:
-        consumed = 1; return 0x41;
-      case 0x105:
-        consumed = 1; return 0x61;
-      case 0x106:
-        consumed = 1; return 0x43;
-      case 0x107:
-        consumed = 1; return 0x63;
-      case 0x108:
-        consumed = 1; return 0x43;
-      case 0x109:
-        consumed = 1; return 0x63;
-      case 0x10a:
-        consumed = 1; return 0x43;
-      case 0x10b:
-        consumed = 1; return 0x63;
-      case 0x10c:
-        consumed = 1; return 0x43;
-      case 0x10d:
-        consumed = 1; return 0x63;
-      case 0x10e:
-        consumed = 1; return 0x44;
-      case 0x10f:
-        consumed = 1; return 0x64;
-      case 0x110:
-        consumed = 1; return 0x44;
-      case 0x111:
-        consumed = 1; return 0x64;
-      case 0x112:
-        consumed = 1; return 0x45;
-      case 0x113:
-        consumed = 1; return 0x65;
-      case 0x114:
-        consumed = 1; return 0x45;
-      case 0x115:
-        consumed = 1; return 0x65;
-      case 0x116:
-        consumed = 1; return 0x45;
-      case 0x117:
-        consumed = 1; return 0x65;
-      case 0x118:
-        consumed = 1; return 0x45;
-      case 0x119:
-        consumed = 1; return 0x65;
-      case 0x11a:
-        consumed = 1; return 0x45;
-      case 0x11b:
-        consumed = 1; return 0x65;
-      case 0x11c:
-        consumed = 1; return 0x47;
-      case 0x11d:
-        consumed = 1; return 0x67;
-      case 0x11e:
-        consumed = 1; return 0x47;
-      case 0x11f:
-        consumed = 1; return 0x67;
-      case 0x120:
-        consumed = 1; return 0x47;
-      case 0x121:
-        consumed = 1; return 0x67;
-      case 0x122:
-        consumed = 1; return 0x47;
-      case 0x123:
-        consumed = 1; return 0x67;
-      case 0x124:
-        consumed = 1; return 0x48;
-      case 0x125:
-        consumed = 1; return 0x68;
-      case 0x126:
-        consumed = 1; return 0x48;
-      case 0x127:
-        consumed = 1; return 0x68;
-      case 0x128:
-        consumed = 1; return 0x49;
-      case 0x129:
-        consumed = 1; return 0x69;
-      case 0x12a:
-        consumed = 1; return 0x49;
-      case 0x12b:
-        consumed = 1; return 0x69;
-      case 0x12c:
-        consumed = 1; return 0x49;
-      case 0x12d:
-        consumed = 1; return 0x69;
-      case 0x12e:
-        consumed = 1; return 0x49;
-      case 0x12f:
-        consumed = 1; return 0x69;
-      case 0x130:
-        consumed = 1; return 0x49;
-      case 0x134:
-        consumed = 1; return 0x4a;
-      case 0x135:
-        consumed = 1; return 0x6a;
-      case 0x136:
-        consumed = 1; return 0x4b;
-      case 0x137:
-        consumed = 1; return 0x6b;
-      case 0x139:
-        consumed = 1; return 0x4c;
-      case 0x13a:
-        consumed = 1; return 0x6c;
-      case 0x13b:
-        consumed = 1; return 0x4c;
-      case 0x13c:
-        consumed = 1; return 0x6c;
-      case 0x13d:
-        consumed = 1; return 0x4c;
-      case 0x13e:
-        consumed = 1; return 0x6c;
-      case 0x140:
-        consumed = 1; return 0x6c;
-      case 0x141:
-        consumed = 1; return 0x4c;
-      case 0x142:
-        consumed = 1; return 0x6c;
-      case 0x143:
-        consumed = 1; return 0x4e;
-      case 0x144:
-        consumed = 1; return 0x6e;
-      case 0x145:
-        consumed = 1; return 0x4e;
-      case 0x146:
-        consumed = 1; return 0x6e;
-      case 0x147:
-        consumed = 1; return 0x4e;
-      case 0x148:
-        consumed = 1; return 0x6e;
-      case 0x14c:
-        consumed = 1; return 0x4f;
-      case 0x14d:
-        consumed = 1; return 0x6f;
-      case 0x14e:
-        consumed = 1; return 0x4f;
-      case 0x14f:
-        consumed = 1; return 0x6f;
-      case 0x150:
-        consumed = 1; return 0x4f;
-      case 0x151:
-        consumed = 1; return 0x6f;
-      case 0x154:
-        consumed = 1; return 0x52;
-      case 0x155:
-        consumed = 1; return 0x72;
-      case 0x156:
-        consumed = 1; return 0x52;
-      case 0x157:
-        consumed = 1; return 0x72;
-      case 0x158:
-        consumed = 1; return 0x52;
-      case 0x159:
-        consumed = 1; return 0x72;
-      case 0x15a:
-        consumed = 1; return 0x53;
-      case 0x15b:
-        consumed = 1; return 0x73;
-      case 0x15c:
-        consumed = 1; return 0x53;
-      case 0x15d:
-        consumed = 1; return 0x73;
-      case 0x15e:
-        consumed = 1; return 0x53;
-      case 0x15f:
-        consumed = 1; return 0x73;
-      case 0x160:
-        consumed = 1; return 0x53;
-      case 0x161:
-        consumed = 1; return 0x73;
-      case 0x162:
-        consumed = 1; return 0x54;
-      case 0x163:
-        consumed = 1; return 0x74;
-      case 0x164:
-        consumed = 1; return 0x54;
-      case 0x165:
-        consumed = 1; return 0x74;
-      case 0x166:
-        consumed = 1; return 0x54;
-      case 0x167:
-        consumed = 1; return 0x74;
-      case 0x168:
-        consumed = 1; return 0x55;
-      case 0x169:
-        consumed = 1; return 0x75;
-      case 0x16a:
-        consumed = 1; return 0x55;
-      case 0x16b:
-        consumed = 1; return 0x75;
-      case 0x16c:
-        consumed = 1; return 0x55;
-      case 0x16d:
-        consumed = 1; return 0x75;
-      case 0x16e:
-        consumed = 1; return 0x55;
-      case 0x16f:
-        consumed = 1; return 0x75;
-      case 0x170:
-        consumed = 1; return 0x55;
-      case 0x171:
-        consumed = 1; return 0x75;
-      case 0x172:
-        consumed = 1; return 0x55;
-      case 0x173:
-        consumed = 1; return 0x75;
-      case 0x174:
-        consumed = 1; return 0x57;
-      case 0x175:
-        consumed = 1; return 0x77;
-      case 0x176:
-        consumed = 1; return 0x59;
-      case 0x177:
-        consumed = 1; return 0x79;
-      case 0x178:
-        consumed = 1; return 0x59;
-      case 0x179:
-        consumed = 1; return 0x5a;
-      case 0x17a:
-        consumed = 1; return 0x7a;
-      case 0x17b:
-        consumed = 1; return 0x5a;
-      case 0x17c:
-        consumed = 1; return 0x7a;
-      case 0x17d:
-        consumed = 1; return 0x5a;
-      case 0x17e:
-        consumed = 1; return 0x7a;
-      case 0x17f:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x307:
-              consumed = 2; return 0x17f;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x180:
-        consumed = 1; return 0x62;
-      case 0x181:
-        consumed = 1; return 0x42;
-      case 0x182:
-        consumed = 1; return 0x42;
-      case 0x183:
-        consumed = 1; return 0x62;
-      case 0x187:
-        consumed = 1; return 0x43;
-      case 0x188:
-        consumed = 1; return 0x63;
-      case 0x18a:
-        consumed = 1; return 0x44;
-      case 0x18b:
-        consumed = 1; return 0x44;
-      case 0x18c:
-        consumed = 1; return 0x64;
-      case 0x191:
-        consumed = 1; return 0x46;
-      case 0x192:
-        consumed = 1; return 0x66;
-      case 0x193:
-        consumed = 1; return 0x47;
-      case 0x197:
-        consumed = 1; return 0x49;
-      case 0x198:
-        consumed = 1; return 0x4b;
-      case 0x199:
-        consumed = 1; return 0x6b;
-      case 0x19a:
-        consumed = 1; return 0x6c;
-      case 0x19d:
-        consumed = 1; return 0x4e;
-      case 0x19e:
-        consumed = 1; return 0x6e;
-      case 0x19f:
-        consumed = 1; return 0x4f;
-      case 0x1a0:
-        consumed = 1; return 0x4f;
-      case 0x1a1:
-        consumed = 1; return 0x6f;
-      case 0x1a4:
-        consumed = 1; return 0x50;
-      case 0x1a5:
-        consumed = 1; return 0x70;
-      case 0x1ab:
-        consumed = 1; return 0x74;
-      case 0x1ac:
-        consumed = 1; return 0x54;
-      case 0x1ad:
-        consumed = 1; return 0x74;
-      case 0x1ae:
-        consumed = 1; return 0x54;
-      case 0x1af:
-        consumed = 1; return 0x55;
-      case 0x1b0:
-        consumed = 1; return 0x75;
-      case 0x1b2:
-        consumed = 1; return 0x56;
-      case 0x1b3:
-        consumed = 1; return 0x59;
-      case 0x1b4:
-        consumed = 1; return 0x79;
-      case 0x1b5:
-        consumed = 1; return 0x5a;
-      case 0x1b6:
-        consumed = 1; return 0x7a;
-      case 0x1b7:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x30c:
-              consumed = 2; return 0x1b7;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x1ba:
-        consumed = 1; return 0x292;
-      case 0x1cd:
-        consumed = 1; return 0x41;
-      case 0x1ce:
-        consumed = 1; return 0x61;
-      case 0x1cf:
-        consumed = 1; return 0x49;
-      case 0x1d0:
-        consumed = 1; return 0x69;
-      case 0x1d1:
-        consumed = 1; return 0x4f;
-      case 0x1d2:
-        consumed = 1; return 0x6f;
-      case 0x1d3:
-        consumed = 1; return 0x55;
-      case 0x1d4:
-        consumed = 1; return 0x75;
-      case 0x1d5:
-        consumed = 1; return 0x55;
-      case 0x1d6:
-        consumed = 1; return 0x75;
-      case 0x1d7:
-        consumed = 1; return 0x55;
-      case 0x1d8:
-        consumed = 1; return 0x75;
-      case 0x1d9:
-        consumed = 1; return 0x55;
-      case 0x1da:
-        consumed = 1; return 0x75;
-      case 0x1db:
-        consumed = 1; return 0x55;
-      case 0x1dc:
-        consumed = 1; return 0x75;
-      case 0x1de:
-        consumed = 1; return 0x41;
-      case 0x1df:
-        consumed = 1; return 0x61;
-      case 0x1e0:
-        consumed = 1; return 0x41;
-      case 0x1e1:
-        consumed = 1; return 0x61;
-      case 0x1e2:
-        consumed = 1; return 0xc6;
-      case 0x1e3:
-        consumed = 1; return 0xe6;
-      case 0x1e4:
-        consumed = 1; return 0x47;
-      case 0x1e5:
-        consumed = 1; return 0x67;
-      case 0x1e6:
-        consumed = 1; return 0x47;
-      case 0x1e7:
-        consumed = 1; return 0x67;
-      case 0x1e8:
-        consumed = 1; return 0x4b;
-      case 0x1e9:
-        consumed = 1; return 0x6b;
-      case 0x1ea:
-        consumed = 1; return 0x4f;
-      case 0x1eb:
-        consumed = 1; return 0x6f;
-      case 0x1ec:
-        consumed = 1; return 0x4f;
-      case 0x1ed:
-        consumed = 1; return 0x6f;
-      case 0x1ee:
-        consumed = 1; return 0x1b7;
-      case 0x1ef:
-        consumed = 1; return 0x292;
-      case 0x1f0:
-        consumed = 1; return 0x6a;
-      case 0x1f4:
-        consumed = 1; return 0x47;
-      case 0x1f5:
-        consumed = 1; return 0x67;
-      case 0x1f8:
-        consumed = 1; return 0x4e;
-      case 0x1f9:
-        consumed = 1; return 0x6e;
-      case 0x1fa:
-        consumed = 1; return 0x41;
-      case 0x1fb:
-        consumed = 1; return 0x61;
-      case 0x1fc:
-        consumed = 1; return 0xc6;
-      case 0x1fd:
-        consumed = 1; return 0xe6;
-      case 0x1fe:
-        consumed = 1; return 0x4f;
-      case 0x1ff:
-        consumed = 1; return 0x6f;
-      case 0x200:
-        consumed = 1; return 0x41;
-      case 0x201:
-        consumed = 1; return 0x61;
-      case 0x202:
-        consumed = 1; return 0x41;
-      case 0x203:
-        consumed = 1; return 0x61;
-      case 0x204:
-        consumed = 1; return 0x45;
-      case 0x205:
-        consumed = 1; return 0x65;
-      case 0x206:
-        consumed = 1; return 0x45;
-      case 0x207:
-        consumed = 1; return 0x65;
-      case 0x208:
-        consumed = 1; return 0x49;
-      case 0x209:
-        consumed = 1; return 0x69;
-      case 0x20a:
-        consumed = 1; return 0x49;
-      case 0x20b:
-        consumed = 1; return 0x69;
-      case 0x20c:
-        consumed = 1; return 0x4f;
-      case 0x20d:
-        consumed = 1; return 0x6f;
-      case 0x20e:
-        consumed = 1; return 0x4f;
-      case 0x20f:
-        consumed = 1; return 0x6f;
-      case 0x210:
-        consumed = 1; return 0x52;
-      case 0x211:
-        consumed = 1; return 0x72;
-      case 0x212:
-        consumed = 1; return 0x52;
-      case 0x213:
-        consumed = 1; return 0x72;
-      case 0x214:
-        consumed = 1; return 0x55;
-      case 0x215:
-        consumed = 1; return 0x75;
-      case 0x216:
-        consumed = 1; return 0x55;
-      case 0x217:
-        consumed = 1; return 0x75;
-      case 0x218:
-        consumed = 1; return 0x53;
-      case 0x219:
-        consumed = 1; return 0x73;
-      case 0x21a:
-        consumed = 1; return 0x54;
-      case 0x21b:
-        consumed = 1; return 0x74;
-      case 0x21e:
-        consumed = 1; return 0x48;
-      case 0x21f:
-        consumed = 1; return 0x68;
-      case 0x220:
-        consumed = 1; return 0x4e;
-      case 0x221:
-        consumed = 1; return 0x64;
-      case 0x224:
-        consumed = 1; return 0x5a;
-      case 0x225:
-        consumed = 1; return 0x7a;
-      case 0x226:
-        consumed = 1; return 0x41;
-      case 0x227:
-        consumed = 1; return 0x61;
-      case 0x228:
-        consumed = 1; return 0x45;
-      case 0x229:
-        consumed = 1; return 0x65;
-      case 0x22a:
-        consumed = 1; return 0x4f;
-      case 0x22b:
-        consumed = 1; return 0x6f;
-      case 0x22c:
-        consumed = 1; return 0x4f;
-      case 0x22d:
-        consumed = 1; return 0x6f;
-      case 0x22e:
-        consumed = 1; return 0x4f;
-      case 0x22f:
-        consumed = 1; return 0x6f;
-      case 0x230:
-        consumed = 1; return 0x4f;
-      case 0x231:
-        consumed = 1; return 0x6f;
-      case 0x232:
-        consumed = 1; return 0x59;
-      case 0x233:
-        consumed = 1; return 0x79;
-      case 0x234:
-        consumed = 1; return 0x6c;
-      case 0x235:
-        consumed = 1; return 0x6e;
-      case 0x236:
-        consumed = 1; return 0x74;
-      case 0x253:
-        consumed = 1; return 0x62;
-      case 0x255:
-        consumed = 1; return 0x63;
-      case 0x256:
-        consumed = 1; return 0x64;
-      case 0x257:
-        consumed = 1; return 0x64;
-      case 0x25a:
-        consumed = 1; return 0x259;
-      case 0x260:
-        consumed = 1; return 0x67;
-      case 0x266:
-        consumed = 1; return 0x68;
-      case 0x268:
-        consumed = 1; return 0x69;
-      case 0x26b:
-        consumed = 1; return 0x6c;
-      case 0x26c:
-        consumed = 1; return 0x6c;
-      case 0x26d:
-        consumed = 1; return 0x6c;
-      case 0x271:
-        consumed = 1; return 0x6d;
-      case 0x272:
-        consumed = 1; return 0x6e;
-      case 0x273:
-        consumed = 1; return 0x6e;
-      case 0x27c:
-        consumed = 1; return 0x72;
-      case 0x27d:
-        consumed = 1; return 0x72;
-      case 0x282:
-        consumed = 1; return 0x73;
-      case 0x286:
-        consumed = 1; return 0x283;
-      case 0x288:
-        consumed = 1; return 0x74;
-      case 0x28b:
-        consumed = 1; return 0x76;
-      case 0x290:
-        consumed = 1; return 0x7a;
-      case 0x291:
-        consumed = 1; return 0x7a;
-      case 0x292:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x30c:
-              consumed = 2; return 0x292;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x293:
-        consumed = 1; return 0x292;
-      case 0x29d:
-        consumed = 1; return 0x6a;
-      case 0x2a0:
-        consumed = 1; return 0x71;
-      case 0x386:
-        consumed = 1; return 0x391;
-      case 0x388:
-        consumed = 1; return 0x395;
-      case 0x389:
-        consumed = 1; return 0x397;
-      case 0x38a:
-        consumed = 1; return 0x399;
-      case 0x38c:
-        consumed = 1; return 0x39f;
-      case 0x38e:
-        consumed = 1; return 0x3a5;
-      case 0x38f:
-        consumed = 1; return 0x3a9;
-      case 0x390:
-        consumed = 1; return 0x3b9;
-      case 0x391:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x391;
-            case 0x301:
-              consumed = 2; return 0x391;
-            case 0x304:
-              consumed = 2; return 0x391;
-            case 0x306:
-              consumed = 2; return 0x391;
-            case 0x313:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x391;
-                  case 0x301:
-                    consumed = 3; return 0x391;
-                  case 0x342:
-                    consumed = 3; return 0x391;
-                }
-              }
-              consumed = 2; return 0x391;
-            case 0x314:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x391;
-                  case 0x301:
-                    consumed = 3; return 0x391;
-                  case 0x342:
-                    consumed = 3; return 0x391;
-                }
-              }
-              consumed = 2; return 0x391;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x395:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x395;
-            case 0x301:
-              consumed = 2; return 0x395;
-            case 0x313:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x395;
-                  case 0x301:
-                    consumed = 3; return 0x395;
-                }
-              }
-              consumed = 2; return 0x395;
-            case 0x314:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x395;
-                  case 0x301:
-                    consumed = 3; return 0x395;
-                }
-              }
-              consumed = 2; return 0x395;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x397:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x397;
-            case 0x301:
-              consumed = 2; return 0x397;
-            case 0x313:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x397;
-                  case 0x301:
-                    consumed = 3; return 0x397;
-                  case 0x342:
-                    consumed = 3; return 0x397;
-                }
-              }
-              consumed = 2; return 0x397;
-            case 0x314:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x397;
-                  case 0x301:
-                    consumed = 3; return 0x397;
-                  case 0x342:
-                    consumed = 3; return 0x397;
-                }
-              }
-              consumed = 2; return 0x397;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x399:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x399;
-            case 0x301:
-              consumed = 2; return 0x399;
-            case 0x304:
-              consumed = 2; return 0x399;
-            case 0x306:
-              consumed = 2; return 0x399;
-            case 0x308:
-              consumed = 2; return 0x399;
-            case 0x313:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x399;
-                  case 0x301:
-                    consumed = 3; return 0x399;
-                  case 0x342:
-                    consumed = 3; return 0x399;
-                }
-              }
-              consumed = 2; return 0x399;
-            case 0x314:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x399;
-                  case 0x301:
-                    consumed = 3; return 0x399;
-                  case 0x342:
-                    consumed = 3; return 0x399;
-                }
-              }
-              consumed = 2; return 0x399;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x39f:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x39f;
-            case 0x301:
-              consumed = 2; return 0x39f;
-            case 0x313:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x39f;
-                  case 0x301:
-                    consumed = 3; return 0x39f;
-                }
-              }
-              consumed = 2; return 0x39f;
-            case 0x314:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x39f;
-                  case 0x301:
-                    consumed = 3; return 0x39f;
-                }
-              }
-              consumed = 2; return 0x39f;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x3a1:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x314:
-              consumed = 2; return 0x3a1;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x3a5:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x3a5;
-            case 0x301:
-              consumed = 2; return 0x3a5;
-            case 0x304:
-              consumed = 2; return 0x3a5;
-            case 0x306:
-              consumed = 2; return 0x3a5;
-            case 0x308:
-              consumed = 2; return 0x3a5;
-            case 0x314:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3a5;
-                  case 0x301:
-                    consumed = 3; return 0x3a5;
-                  case 0x342:
-                    consumed = 3; return 0x3a5;
-                }
-              }
-              consumed = 2; return 0x3a5;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x3a9:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x3a9;
-            case 0x301:
-              consumed = 2; return 0x3a9;
-            case 0x313:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3a9;
-                  case 0x301:
-                    consumed = 3; return 0x3a9;
-                  case 0x342:
-                    consumed = 3; return 0x3a9;
-                }
-              }
-              consumed = 2; return 0x3a9;
-            case 0x314:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3a9;
-                  case 0x301:
-                    consumed = 3; return 0x3a9;
-                  case 0x342:
-                    consumed = 3; return 0x3a9;
-                }
-              }
-              consumed = 2; return 0x3a9;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x3aa:
-        consumed = 1; return 0x399;
-      case 0x3ab:
-        consumed = 1; return 0x3a5;
-      case 0x3ac:
-        consumed = 1; return 0x3b1;
-      case 0x3ad:
-        consumed = 1; return 0x3b5;
-      case 0x3ae:
-        consumed = 1; return 0x3b7;
-      case 0x3af:
-        consumed = 1; return 0x3b9;
-      case 0x3b0:
-        consumed = 1; return 0x3c5;
-      case 0x3b1:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x3b1;
-            case 0x301:
-              consumed = 2; return 0x3b1;
-            case 0x304:
-              consumed = 2; return 0x3b1;
-            case 0x306:
-              consumed = 2; return 0x3b1;
-            case 0x313:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3b1;
-                  case 0x301:
-                    consumed = 3; return 0x3b1;
-                  case 0x342:
-                    consumed = 3; return 0x3b1;
-                }
-              }
-              consumed = 2; return 0x3b1;
-            case 0x314:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3b1;
-                  case 0x301:
-                    consumed = 3; return 0x3b1;
-                  case 0x342:
-                    consumed = 3; return 0x3b1;
-                }
-              }
-              consumed = 2; return 0x3b1;
-            case 0x342:
-              consumed = 2; return 0x3b1;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x3b5:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x3b5;
-            case 0x301:
-              consumed = 2; return 0x3b5;
-            case 0x313:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3b5;
-                  case 0x301:
-                    consumed = 3; return 0x3b5;
-                }
-              }
-              consumed = 2; return 0x3b5;
-            case 0x314:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3b5;
-                  case 0x301:
-                    consumed = 3; return 0x3b5;
-                }
-              }
-              consumed = 2; return 0x3b5;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x3b7:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x3b7;
-            case 0x301:
-              consumed = 2; return 0x3b7;
-            case 0x313:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3b7;
-                  case 0x301:
-                    consumed = 3; return 0x3b7;
-                  case 0x342:
-                    consumed = 3; return 0x3b7;
-                }
-              }
-              consumed = 2; return 0x3b7;
-            case 0x314:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3b7;
-                  case 0x301:
-                    consumed = 3; return 0x3b7;
-                  case 0x342:
-                    consumed = 3; return 0x3b7;
-                }
-              }
-              consumed = 2; return 0x3b7;
-            case 0x342:
-              consumed = 2; return 0x3b7;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x3b9:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x3b9;
-            case 0x301:
-              consumed = 2; return 0x3b9;
-            case 0x304:
-              consumed = 2; return 0x3b9;
-            case 0x306:
-              consumed = 2; return 0x3b9;
-            case 0x308:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3b9;
-                  case 0x301:
-                    consumed = 3; return 0x3b9;
-                  case 0x342:
-                    consumed = 3; return 0x3b9;
-                }
-              }
-              consumed = 2; return 0x3b9;
-            case 0x313:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3b9;
-                  case 0x301:
-                    consumed = 3; return 0x3b9;
-                  case 0x342:
-                    consumed = 3; return 0x3b9;
-                }
-              }
-              consumed = 2; return 0x3b9;
-            case 0x314:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3b9;
-                  case 0x301:
-                    consumed = 3; return 0x3b9;
-                  case 0x342:
-                    consumed = 3; return 0x3b9;
-                }
-              }
-              consumed = 2; return 0x3b9;
-            case 0x342:
-              consumed = 2; return 0x3b9;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x3bf:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x3bf;
-            case 0x301:
-              consumed = 2; return 0x3bf;
-            case 0x313:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3bf;
-                  case 0x301:
-                    consumed = 3; return 0x3bf;
-                }
-              }
-              consumed = 2; return 0x3bf;
-            case 0x314:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3bf;
-                  case 0x301:
-                    consumed = 3; return 0x3bf;
-                }
-              }
-              consumed = 2; return 0x3bf;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x3c1:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x313:
-              consumed = 2; return 0x3c1;
-            case 0x314:
-              consumed = 2; return 0x3c1;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x3c5:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x3c5;
-            case 0x301:
-              consumed = 2; return 0x3c5;
-            case 0x304:
-              consumed = 2; return 0x3c5;
-            case 0x306:
-              consumed = 2; return 0x3c5;
-            case 0x308:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3c5;
-                  case 0x301:
-                    consumed = 3; return 0x3c5;
-                  case 0x342:
-                    consumed = 3; return 0x3c5;
-                }
-              }
-              consumed = 2; return 0x3c5;
-            case 0x313:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3c5;
-                  case 0x301:
-                    consumed = 3; return 0x3c5;
-                  case 0x342:
-                    consumed = 3; return 0x3c5;
-                }
-              }
-              consumed = 2; return 0x3c5;
-            case 0x314:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3c5;
-                  case 0x301:
-                    consumed = 3; return 0x3c5;
-                  case 0x342:
-                    consumed = 3; return 0x3c5;
-                }
-              }
-              consumed = 2; return 0x3c5;
-            case 0x342:
-              consumed = 2; return 0x3c5;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x3c9:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x3c9;
-            case 0x301:
-              consumed = 2; return 0x3c9;
-            case 0x313:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3c9;
-                  case 0x301:
-                    consumed = 3; return 0x3c9;
-                  case 0x342:
-                    consumed = 3; return 0x3c9;
-                }
-              }
-              consumed = 2; return 0x3c9;
-            case 0x314:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x300:
-                    consumed = 3; return 0x3c9;
-                  case 0x301:
-                    consumed = 3; return 0x3c9;
-                  case 0x342:
-                    consumed = 3; return 0x3c9;
-                }
-              }
-              consumed = 2; return 0x3c9;
-            case 0x342:
-              consumed = 2; return 0x3c9;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x3ca:
-        consumed = 1; return 0x3b9;
-      case 0x3cb:
-        consumed = 1; return 0x3c5;
-      case 0x3cc:
-        consumed = 1; return 0x3bf;
-      case 0x3cd:
-        consumed = 1; return 0x3c5;
-      case 0x3ce:
-        consumed = 1; return 0x3c9;
-      case 0x3d2:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x301:
-              consumed = 2; return 0x3d2;
-            case 0x308:
-              consumed = 2; return 0x3d2;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x400:
-        consumed = 1; return 0x415;
-      case 0x401:
-        consumed = 1; return 0x415;
-      case 0x40d:
-        consumed = 1; return 0x418;
-      case 0x410:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x306:
-              consumed = 2; return 0x410;
-            case 0x308:
-              consumed = 2; return 0x410;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x415:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x415;
-            case 0x306:
-              consumed = 2; return 0x415;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x416:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x306:
-              consumed = 2; return 0x416;
-            case 0x308:
-              consumed = 2; return 0x416;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x417:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x308:
-              consumed = 2; return 0x417;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x418:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x418;
-            case 0x304:
-              consumed = 2; return 0x418;
-            case 0x308:
-              consumed = 2; return 0x418;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x41e:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x308:
-              consumed = 2; return 0x41e;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x423:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x304:
-              consumed = 2; return 0x423;
-            case 0x308:
-              consumed = 2; return 0x423;
-            case 0x30b:
-              consumed = 2; return 0x423;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x427:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x308:
-              consumed = 2; return 0x427;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x42b:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x308:
-              consumed = 2; return 0x42b;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x42d:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x308:
-              consumed = 2; return 0x42d;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x430:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x306:
-              consumed = 2; return 0x430;
-            case 0x308:
-              consumed = 2; return 0x430;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x435:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x435;
-            case 0x306:
-              consumed = 2; return 0x435;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x436:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x306:
-              consumed = 2; return 0x436;
-            case 0x308:
-              consumed = 2; return 0x436;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x437:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x308:
-              consumed = 2; return 0x437;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x438:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x300:
-              consumed = 2; return 0x438;
-            case 0x304:
-              consumed = 2; return 0x438;
-            case 0x308:
-              consumed = 2; return 0x438;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x43e:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x308:
-              consumed = 2; return 0x43e;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x443:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x304:
-              consumed = 2; return 0x443;
-            case 0x308:
-              consumed = 2; return 0x443;
-            case 0x30b:
-              consumed = 2; return 0x443;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x447:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x308:
-              consumed = 2; return 0x447;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x44b:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x308:
-              consumed = 2; return 0x44b;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x44d:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x308:
-              consumed = 2; return 0x44d;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x450:
-        consumed = 1; return 0x435;
-      case 0x451:
-        consumed = 1; return 0x435;
-      case 0x45d:
-        consumed = 1; return 0x438;
-      case 0x474:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x30f:
-              consumed = 2; return 0x474;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x475:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x30f:
-              consumed = 2; return 0x475;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x476:
-        consumed = 1; return 0x474;
-      case 0x477:
-        consumed = 1; return 0x475;
-      case 0x47c:
-        consumed = 1; return 0x460;
-      case 0x47d:
-        consumed = 1; return 0x461;
-      case 0x48a:
-        consumed = 1; return 0x419;
-      case 0x48b:
-        consumed = 1; return 0x439;
-      case 0x48e:
-        consumed = 1; return 0x420;
-      case 0x48f:
-        consumed = 1; return 0x440;
-      case 0x490:
-        consumed = 1; return 0x413;
-      case 0x491:
-        consumed = 1; return 0x433;
-      case 0x492:
-        consumed = 1; return 0x413;
-      case 0x493:
-        consumed = 1; return 0x433;
-      case 0x494:
-        consumed = 1; return 0x413;
-      case 0x495:
-        consumed = 1; return 0x433;
-      case 0x496:
-        consumed = 1; return 0x416;
-      case 0x497:
-        consumed = 1; return 0x436;
-      case 0x498:
-        consumed = 1; return 0x417;
-      case 0x499:
-        consumed = 1; return 0x437;
-      case 0x49a:
-        consumed = 1; return 0x41a;
-      case 0x49b:
-        consumed = 1; return 0x43a;
-      case 0x49c:
-        consumed = 1; return 0x41a;
-      case 0x49d:
-        consumed = 1; return 0x43a;
-      case 0x49e:
-        consumed = 1; return 0x41a;
-      case 0x49f:
-        consumed = 1; return 0x43a;
-      case 0x4a2:
-        consumed = 1; return 0x41d;
-      case 0x4a3:
-        consumed = 1; return 0x43d;
-      case 0x4a6:
-        consumed = 1; return 0x41f;
-      case 0x4a7:
-        consumed = 1; return 0x43f;
-      case 0x4aa:
-        consumed = 1; return 0x421;
-      case 0x4ab:
-        consumed = 1; return 0x441;
-      case 0x4ac:
-        consumed = 1; return 0x422;
-      case 0x4ad:
-        consumed = 1; return 0x442;
-      case 0x4b0:
-        consumed = 1; return 0x4ae;
-      case 0x4b1:
-        consumed = 1; return 0x4af;
-      case 0x4b2:
-        consumed = 1; return 0x425;
-      case 0x4b3:
-        consumed = 1; return 0x425;
-      case 0x4b6:
-        consumed = 1; return 0x4bc;
-      case 0x4b7:
-        consumed = 1; return 0x4bc;
-      case 0x4b8:
-        consumed = 1; return 0x4bc;
-      case 0x4b9:
-        consumed = 1; return 0x447;
-      case 0x4be:
-        consumed = 1; return 0x4bc;
-      case 0x4bf:
-        consumed = 1; return 0x4bc;
-      case 0x4c1:
-        consumed = 1; return 0x416;
-      case 0x4c2:
-        consumed = 1; return 0x436;
-      case 0x4c3:
-        consumed = 1; return 0x41a;
-      case 0x4c4:
-        consumed = 1; return 0x43a;
-      case 0x4c5:
-        consumed = 1; return 0x41b;
-      case 0x4c6:
-        consumed = 1; return 0x43b;
-      case 0x4c7:
-        consumed = 1; return 0x41d;
-      case 0x4c8:
-        consumed = 1; return 0x43d;
-      case 0x4c9:
-        consumed = 1; return 0x41d;
-      case 0x4ca:
-        consumed = 1; return 0x43d;
-      case 0x4cb:
-        consumed = 1; return 0x4bc;
-      case 0x4cc:
-        consumed = 1; return 0x4bc;
-      case 0x4cd:
-        consumed = 1; return 0x41c;
-      case 0x4ce:
-        consumed = 1; return 0x43c;
-      case 0x4d0:
-        consumed = 1; return 0x410;
-      case 0x4d1:
-        consumed = 1; return 0x430;
-      case 0x4d2:
-        consumed = 1; return 0x410;
-      case 0x4d3:
-        consumed = 1; return 0x430;
-      case 0x4d6:
-        consumed = 1; return 0x415;
-      case 0x4d7:
-        consumed = 1; return 0x435;
-      case 0x4d8:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x308:
-              consumed = 2; return 0x4d8;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x4d9:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x308:
-              consumed = 2; return 0x4d9;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x4da:
-        consumed = 1; return 0x4d8;
-      case 0x4db:
-        consumed = 1; return 0x4d9;
-      case 0x4dc:
-        consumed = 1; return 0x416;
-      case 0x4dd:
-        consumed = 1; return 0x436;
-      case 0x4de:
-        consumed = 1; return 0x417;
-      case 0x4df:
-        consumed = 1; return 0x437;
-      case 0x4e2:
-        consumed = 1; return 0x418;
-      case 0x4e3:
-        consumed = 1; return 0x438;
-      case 0x4e4:
-        consumed = 1; return 0x418;
-      case 0x4e5:
-        consumed = 1; return 0x438;
-      case 0x4e6:
-        consumed = 1; return 0x41e;
-      case 0x4e7:
-        consumed = 1; return 0x43e;
-      case 0x4e8:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x308:
-              consumed = 2; return 0x4e8;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x4e9:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x308:
-              consumed = 2; return 0x4e9;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x4ea:
-        consumed = 1; return 0x4e8;
-      case 0x4eb:
-        consumed = 1; return 0x4e9;
-      case 0x4ec:
-        consumed = 1; return 0x42d;
-      case 0x4ed:
-        consumed = 1; return 0x44d;
-      case 0x4ee:
-        consumed = 1; return 0x423;
-      case 0x4ef:
-        consumed = 1; return 0x443;
-      case 0x4f0:
-        consumed = 1; return 0x423;
-      case 0x4f1:
-        consumed = 1; return 0x443;
-      case 0x4f2:
-        consumed = 1; return 0x423;
-      case 0x4f3:
-        consumed = 1; return 0x443;
-      case 0x4f4:
-        consumed = 1; return 0x427;
-      case 0x4f5:
-        consumed = 1; return 0x447;
-      case 0x4f8:
-        consumed = 1; return 0x42b;
-      case 0x4f9:
-        consumed = 1; return 0x44b;
-      case 0x5d0:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5b7:
-              consumed = 2; return 0x5d0;
-            case 0x5b8:
-              consumed = 2; return 0x5d0;
-            case 0x5bc:
-              consumed = 2; return 0x5d0;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5d1:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5d1;
-            case 0x5bf:
-              consumed = 2; return 0x5d1;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5d2:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5d2;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5d3:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5d3;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5d4:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5d4;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5d5:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5b9:
-              consumed = 2; return 0x5d5;
-            case 0x5bc:
-              consumed = 2; return 0x5d5;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5d6:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5d6;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5d8:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5d8;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5d9:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5b4:
-              consumed = 2; return 0x5d9;
-            case 0x5bc:
-              consumed = 2; return 0x5d9;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5da:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5da;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5db:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5db;
-            case 0x5bf:
-              consumed = 2; return 0x5db;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5dc:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5dc;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5de:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5de;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5e0:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5e0;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5e1:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5e1;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5e3:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5e3;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5e4:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5e4;
-            case 0x5bf:
-              consumed = 2; return 0x5e4;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5e6:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5e6;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5e7:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5e7;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5e8:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5e8;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5e9:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              if ( size > 2 )
-              {
-                switch( in[ 2 ] )
-                {
-                  case 0x5c1:
-                    consumed = 3; return 0x5e9;
-                  case 0x5c2:
-                    consumed = 3; return 0x5e9;
-                }
-              }
-              consumed = 2; return 0x5e9;
-            case 0x5c1:
-              consumed = 2; return 0x5e9;
-            case 0x5c2:
-              consumed = 2; return 0x5e9;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x5ea:
-        if ( size > 1 )
-        {
-          switch( in[ 1 ] )
-          {
-            case 0x5bc:
-              consumed = 2; return 0x5ea;
-          }
-        }
-        consumed = 1; return *in;
-      case 0x1e00:
-        consumed = 1; return 0x41;
-      case 0x1e01:
-        consumed = 1; return 0x61;
-      case 0x1e02:
-        consumed = 1; return 0x42;
-      case 0x1e03:
-        consumed = 1; return 0x62;
-      case 0x1e04:
-        consumed = 1; return 0x42;
-      case 0x1e05:
-        consumed = 1; return 0x62;
-      case 0x1e06:
-        consumed = 1; return 0x42;
-      case 0x1e07:
-        consumed = 1; return 0x62;
-      case 0x1e08:
-        consumed = 1; return 0x43;
-      case 0x1e09:
-        consumed = 1; return 0x63;
-      case 0x1e0a:
-        consumed = 1; return 0x44;
-      case 0x1e0b:
-        consumed = 1; return 0x64;
-      case 0x1e0c:
-        consumed = 1; return 0x44;
-      case 0x1e0d:
-        consumed = 1; return 0x64;
-      case 0x1e0e:
-        consumed = 1; return 0x44;
-      case 0x1e0f:
-        consumed = 1; return 0x64;
-      case 0x1e10:
-        consumed = 1; return 0x44;
-      case 0x1e11:
-        consumed = 1; return 0x64;
-      case 0x1e12:
-        consumed = 1; return 0x44;
-      case 0x1e13:
-        consumed = 1; return 0x64;
-      case 0x1e14:
-        consumed = 1; return 0x45;
-      case 0x1e15:
-        consumed = 1; return 0x65;
-      case 0x1e16:
-        consumed = 1; return 0x45;
-      case 0x1e17:
-        consumed = 1; return 0x65;
-      case 0x1e18:
-        consumed = 1; return 0x45;
-      case 0x1e19:
-        consumed = 1; return 0x65;
-      case 0x1e1a:
-        consumed = 1; return 0x45;
-      case 0x1e1b:
-        consumed = 1; return 0x65;
-      case 0x1e1c:
-        consumed = 1; return 0x45;
-      case 0x1e1d:
-        consumed = 1; return 0x65;
-      case 0x1e1e:
-        consumed = 1; return 0x46;
-      case 0x1e1f:
-        consumed = 1; return 0x66;
-      case 0x1e20:
-        consumed = 1; return 0x47;
-      case 0x1e21:
-        consumed = 1; return 0x67;
-      case 0x1e22:
-        consumed = 1; return 0x48;
-      case 0x1e23:
-        consumed = 1; return 0x68;
-      case 0x1e24:
-        consumed = 1; return 0x48;
-      case 0x1e25:
-        consumed = 1; return 0x68;
-      case 0x1e26:
-        consumed = 1; return 0x48;
-      case 0x1e27:
-        consumed = 1; return 0x68;
-      case 0x1e28:
-        consumed = 1; return 0x48;
-      case 0x1e29:
-        consumed = 1; return 0x68;
-      case 0x1e2a:
-        consumed = 1; return 0x48;
-      case 0x1e2b:
-        consumed = 1; return 0x68;
-      case 0x1e2c:
-        consumed = 1; return 0x49;
-      case 0x1e2d:
-        consumed = 1; return 0x69;
-      case 0x1e2e:
-        consumed = 1; return 0x49;
-      case 0x1e2f:
-        consumed = 1; return 0x69;
-      case 0x1e30:
-        consumed = 1; return 0x4b;
-      case 0x1e31:
-        consumed = 1; return 0x6b;
-      case 0x1e32:
-        consumed = 1; return 0x4b;
-      case 0x1e33:
-        consumed = 1; return 0x6b;
-      case 0x1e34:
-        consumed = 1; return 0x4b;
-      case 0x1e35:
-        consumed = 1; return 0x6b;
-      case 0x1e36:
-        consumed = 1; return 0x4c;
-      case 0x1e37:
-        consumed = 1; return 0x6c;
-      case 0x1e38:
-        consumed = 1; return 0x4c;
-      case 0x1e39:
-        consumed = 1; return 0x6c;
-      case 0x1e3a:
-        consumed = 1; return 0x4c;
-      case 0x1e3b:
-        consumed = 1; return 0x6c;
-      case 0x1e3c:
-        consumed = 1; return 0x4c;
-      case 0x1e3d:
-        consumed = 1; return 0x6c;
-      case 0x1e3e:
-        consumed = 1; return 0x4d;
-      case 0x1e3f:
-        consumed = 1; return 0x6d;
-      case 0x1e40:
-        consumed = 1; return 0x4d;
-      case 0x1e41:
-        consumed = 1; return 0x6d;
-      case 0x1e42:
-        consumed = 1; return 0x4d;
-      case 0x1e43:
-        consumed = 1; return 0x6d;
-      case 0x1e44:
-        consumed = 1; return 0x4e;
-      case 0x1e45:
-        consumed = 1; return 0x6e;
-      case 0x1e46:
-        consumed = 1; return 0x4e;
-      case 0x1e47:
-        consumed = 1; return 0x6e;
-      case 0x1e48:
-        consumed = 1; return 0x4e;
-      case 0x1e49:
-        consumed = 1; return 0x6e;
-      case 0x1e4a:
-        consumed = 1; return 0x4e;
-      case 0x1e4b:
-        consumed = 1; return 0x6e;
-      case 0x1e4c:
-        consumed = 1; return 0x4f;
-      case 0x1e4d:
-        consumed = 1; return 0x6f;
-      case 0x1e4e:
-        consumed = 1; return 0x4f;
-      case 0x1e4f:
-        consumed = 1; return 0x6f;
-      case 0x1e50:
-        consumed = 1; return 0x4f;
-      case 0x1e51:
-        consumed = 1; return 0x6f;
-      case 0x1e52:
-        consumed = 1; return 0x4f;
-      case 0x1e53:
-        consumed = 1; return 0x6f;
-      case 0x1e54:
-        consumed = 1; return 0x50;
-      case 0x1e55:
-        consumed = 1; return 0x70;
-      case 0x1e56:
-        consumed = 1; return 0x50;
-      case 0x1e57:
-        consumed = 1; return 0x70;
-      case 0x1e58:
-        consumed = 1; return 0x52;
-      case 0x1e59:
-        consumed = 1; return 0x72;
-      case 0x1e5a:
-        consumed = 1; return 0x52;
-      case 0x1e5b:
-        consumed = 1; return 0x72;
-      case 0x1e5c:
-        consumed = 1; return 0x52;
-      case 0x1e5d:
-        consumed = 1; return 0x72;
-      case 0x1e5e:
-        consumed = 1; return 0x52;
-      case 0x1e5f:
-        consumed = 1; return 0x72;
-      case 0x1e60:
-        consumed = 1; return 0x53;
-      case 0x1e61:
-        consumed = 1; return 0x73;
-      case 0x1e62:
-        consumed = 1; return 0x53;
-      case 0x1e63:
-        consumed = 1; return 0x73;
-      case 0x1e64:
-        consumed = 1; return 0x53;
-      case 0x1e65:
-        consumed = 1; return 0x73;
-      case 0x1e66:
-        consumed = 1; return 0x53;
-      case 0x1e67:
-        consumed = 1; return 0x73;
-      case 0x1e68:
-        consumed = 1; return 0x53;
-      case 0x1e69:
-        consumed = 1; return 0x73;
-      case 0x1e6a:
-        consumed = 1; return 0x54;
-      case 0x1e6b:
-        consumed = 1; return 0x74;
-      case 0x1e6c:
-        consumed = 1; return 0x54;
-      case 0x1e6d:
-        consumed = 1; return 0x74;
-      case 0x1e6e:
-        consumed = 1; return 0x54;
-      case 0x1e6f:
-        consumed = 1; return 0x74;
-      case 0x1e70:
-        consumed = 1; return 0x54;
-      case 0x1e71:
-        consumed = 1; return 0x74;
-      case 0x1e72:
-        consumed = 1; return 0x55;
-      case 0x1e73:
-        consumed = 1; return 0x75;
-      case 0x1e74:
-        consumed = 1; return 0x55;
-      case 0x1e75:
-        consumed = 1; return 0x75;
-      case 0x1e76:
-        consumed = 1; return 0x55;
-      case 0x1e77:
-        consumed = 1; return 0x75;
-      case 0x1e78:
-        consumed = 1; return 0x55;
-      case 0x1e79:
-        consumed = 1; return 0x75;
-      case 0x1e7a:
-        consumed = 1; return 0x55;
-      case 0x1e7b:
-        consumed = 1; return 0x75;
-      case 0x1e7c:
-        consumed = 1; return 0x56;
-      case 0x1e7d:
-        consumed = 1; return 0x76;
-      case 0x1e7e:
-        consumed = 1; return 0x56;
-      case 0x1e7f:
-        consumed = 1; return 0x76;
-      case 0x1e80:
-        consumed = 1; return 0x57;
-      case 0x1e81:
-        consumed = 1; return 0x77;
-      case 0x1e82:
-        consumed = 1; return 0x57;
-      case 0x1e83:
-        consumed = 1; return 0x77;
-      case 0x1e84:
-        consumed = 1; return 0x57;
-      case 0x1e85:
-        consumed = 1; return 0x77;
-      case 0x1e86:
-        consumed = 1; return 0x57;
-      case 0x1e87:
-        consumed = 1; return 0x77;
-      case 0x1e88:
-        consumed = 1; return 0x57;
-      case 0x1e89:
-        consumed = 1; return 0x77;
-      case 0x1e8a:
-        consumed = 1; return 0x58;
-      case 0x1e8b:
-        consumed = 1; return 0x78;
-      case 0x1e8c:
-        consumed = 1; return 0x58;
-      case 0x1e8d:
-        consumed = 1; return 0x78;
-      case 0x1e8e:
-        consumed = 1; return 0x59;
-      case 0x1e8f:
-        consumed = 1; return 0x79;
-      case 0x1e90:
-        consumed = 1; return 0x5a;
-      case 0x1e91:
-        consumed = 1; return 0x7a;
-      case 0x1e92:
-        consumed = 1; return 0x5a;
-      case 0x1e93:
-        consumed = 1; return 0x7a;
-      case 0x1e94:
-        consumed = 1; return 0x5a;
-      case 0x1e95:
-        consumed = 1; return 0x7a;
-      case 0x1e96:
-        consumed = 1; return 0x68;
-      case 0x1e97:
-        consumed = 1; return 0x74;
-      case 0x1e98:
-        consumed = 1; return 0x77;
-      case 0x1e99:
-        consumed = 1; return 0x79;
-      case 0x1e9a:
-        consumed = 1; return 0x61;
-      case 0x1e9b:
-        consumed = 1; return 0x17f;
-      case 0x1ea0:
-        consumed = 1; return 0x41;
-      case 0x1ea1:
-        consumed = 1; return 0x61;
-      case 0x1ea2:
-        consumed = 1; return 0x41;
-      case 0x1ea3:
-        consumed = 1; return 0x61;
-      case 0x1ea4:
-        consumed = 1; return 0x41;
-      case 0x1ea5:
-        consumed = 1; return 0x61;
-      case 0x1ea6:
-        consumed = 1; return 0x41;
-      case 0x1ea7:
-        consumed = 1; return 0x61;
-      case 0x1ea8:
-        consumed = 1; return 0x41;
-      case 0x1ea9:
-        consumed = 1; return 0x61;
-      case 0x1eaa:
-        consumed = 1; return 0x41;
-      case 0x1eab:
-        consumed = 1; return 0x61;
-      case 0x1eac:
-        consumed = 1; return 0x41;
-      case 0x1ead:
-        consumed = 1; return 0x61;
-      case 0x1eae:
-        consumed = 1; return 0x41;
-      case 0x1eaf:
-        consumed = 1; return 0x61;
-      case 0x1eb0:
-        consumed = 1; return 0x41;
-      case 0x1eb1:
-        consumed = 1; return 0x61;
-      case 0x1eb2:
-        consumed = 1; return 0x41;
-      case 0x1eb3:
-        consumed = 1; return 0x61;
-      case 0x1eb4:
-        consumed = 1; return 0x41;
-      case 0x1eb5:
-        consumed = 1; return 0x61;
-      case 0x1eb6:
-        consumed = 1; return 0x41;
-      case 0x1eb7:
-        consumed = 1; return 0x61;
-      case 0x1eb8:
-        consumed = 1; return 0x45;
-      case 0x1eb9:
-        consumed = 1; return 0x65;
-      case 0x1eba:
-        consumed = 1; return 0x45;
-      case 0x1ebb:
-        consumed = 1; return 0x65;
-      case 0x1ebc:
-        consumed = 1; return 0x45;
-      case 0x1ebd:
-        consumed = 1; return 0x65;
-      case 0x1ebe:
-        consumed = 1; return 0x45;
-      case 0x1ebf:
-        consumed = 1; return 0x65;
-      case 0x1ec0:
-        consumed = 1; return 0x45;
-      case 0x1ec1:
-        consumed = 1; return 0x65;
-      case 0x1ec2:
-        consumed = 1; return 0x45;
-      case 0x1ec3:
-        consumed = 1; return 0x65;
-      case 0x1ec4:
-        consumed = 1; return 0x45;
-      case 0x1ec5:
-        consumed = 1; return 0x65;
-      case 0x1ec6:
-        consumed = 1; return 0x45;
-      case 0x1ec7:
-        consumed = 1; return 0x65;
-      case 0x1ec8:
-        consumed = 1; return 0x49;
-      case 0x1ec9:
-        consumed = 1; return 0x69;
-      case 0x1eca:
-        consumed = 1; return 0x49;
-      case 0x1ecb:
-        consumed = 1; return 0x69;
-      case 0x1ecc:
-        consumed = 1; return 0x4f;
-      case 0x1ecd:
-        consumed = 1; return 0x6f;
-      case 0x1ece:
-        consumed = 1; return 0x4f;
-      case 0x1ecf:
-        consumed = 1; return 0x6f;
-      case 0x1ed0:
-        consumed = 1; return 0x4f;
-      case 0x1ed1:
-        consumed = 1; return 0x6f;
-      case 0x1ed2:
-        consumed = 1; return 0x4f;
-      case 0x1ed3:
-        consumed = 1; return 0x6f;
-      case 0x1ed4:
-        consumed = 1; return 0x4f;
-      case 0x1ed5:
-        consumed = 1; return 0x6f;
-      case 0x1ed6:
-        consumed = 1; return 0x4f;
-      case 0x1ed7:
-        consumed = 1; return 0x6f;
-      case 0x1ed8:
-        consumed = 1; return 0x4f;
-      case 0x1ed9:
-        consumed = 1; return 0x6f;
-      case 0x1eda:
-        consumed = 1; return 0x4f;
-      case 0x1edb:
-        consumed = 1; return 0x6f;
-      case 0x1edc:
-        consumed = 1; return 0x4f;
-      case 0x1edd:
-        consumed = 1; return 0x6f;
-      case 0x1ede:
-        consumed = 1; return 0x4f;
-      case 0x1edf:
-        consumed = 1; return 0x6f;
-      case 0x1ee0:
-        consumed = 1; return 0x4f;
-      case 0x1ee1:
-        consumed = 1; return 0x6f;
-      case 0x1ee2:
-        consumed = 1; return 0x4f;
-      case 0x1ee3:
-        consumed = 1; return 0x6f;
-      case 0x1ee4:
-        consumed = 1; return 0x55;
-      case 0x1ee5:
-        consumed = 1; return 0x75;
-      case 0x1ee6:
-        consumed = 1; return 0x55;
-      case 0x1ee7:
-        consumed = 1; return 0x75;
-      case 0x1ee8:
-        consumed = 1; return 0x55;
-      case 0x1ee9:
-        consumed = 1; return 0x75;
-      case 0x1eea:
-        consumed = 1; return 0x55;
-      case 0x1eeb:
-        consumed = 1; return 0x75;
-      case 0x1eec:
-        consumed = 1; return 0x55;
-      case 0x1eed:
-        consumed = 1; return 0x75;
-      case 0x1eee:
-        consumed = 1; return 0x55;
-      case 0x1eef:
-        consumed = 1; return 0x75;
-      case 0x1ef0:
-        consumed = 1; return 0x55;
-      case 0x1ef1:
-        consumed = 1; return 0x75;
-      case 0x1ef2:
-        consumed = 1; return 0x59;
-      case 0x1ef3:
-        consumed = 1; return 0x79;
-      case 0x1ef4:
-        consumed = 1; return 0x59;
-      case 0x1ef5:
-        consumed = 1; return 0x79;
-      case 0x1ef6:
-        consumed = 1; return 0x59;
-      case 0x1ef7:
-        consumed = 1; return 0x79;
-      case 0x1ef8:
-        consumed = 1; return 0x59;
-      case 0x1ef9:
-        consumed = 1; return 0x79;
-      case 0x1f00:
-        consumed = 1; return 0x3b1;
-      case 0x1f01:
-        consumed = 1; return 0x3b1;
-      case 0x1f02:
-        consumed = 1; return 0x3b1;
-      case 0x1f03:
-        consumed = 1; return 0x3b1;
-      case 0x1f04:
-        consumed = 1; return 0x3b1;
-      case 0x1f05:
-        consumed = 1; return 0x3b1;
-      case 0x1f06:
-        consumed = 1; return 0x3b1;
-      case 0x1f07:
-        consumed = 1; return 0x3b1;
-      case 0x1f08:
-        consumed = 1; return 0x391;
-      case 0x1f09:
-        consumed = 1; return 0x391;
-      case 0x1f0a:
-        consumed = 1; return 0x391;
-      case 0x1f0b:
-        consumed = 1; return 0x391;
-      case 0x1f0c:
-        consumed = 1; return 0x391;
-      case 0x1f0d:
-        consumed = 1; return 0x391;
-      case 0x1f0e:
-        consumed = 1; return 0x391;
-      case 0x1f0f:
-        consumed = 1; return 0x391;
-      case 0x1f10:
-        consumed = 1; return 0x3b5;
-      case 0x1f11:
-        consumed = 1; return 0x3b5;
-      case 0x1f12:
-        consumed = 1; return 0x3b5;
-      case 0x1f13:
-        consumed = 1; return 0x3b5;
-      case 0x1f14:
-        consumed = 1; return 0x3b5;
-      case 0x1f15:
-        consumed = 1; return 0x3b5;
-      case 0x1f18:
-        consumed = 1; return 0x395;
-      case 0x1f19:
-        consumed = 1; return 0x395;
-      case 0x1f1a:
-        consumed = 1; return 0x395;
-      case 0x1f1b:
-        consumed = 1; return 0x395;
-      case 0x1f1c:
-        consumed = 1; return 0x395;
-      case 0x1f1d:
-        consumed = 1; return 0x395;
-      case 0x1f20:
-        consumed = 1; return 0x3b7;
-      case 0x1f21:
-        consumed = 1; return 0x3b7;
-      case 0x1f22:
-        consumed = 1; return 0x3b7;
-      case 0x1f23:
-        consumed = 1; return 0x3b7;
-      case 0x1f24:
-        consumed = 1; return 0x3b7;
-      case 0x1f25:
-        consumed = 1; return 0x3b7;
-      case 0x1f26:
-        consumed = 1; return 0x3b7;
-      case 0x1f27:
-        consumed = 1; return 0x3b7;
-      case 0x1f28:
-        consumed = 1; return 0x397;
-      case 0x1f29:
-        consumed = 1; return 0x397;
-      case 0x1f2a:
-        consumed = 1; return 0x397;
-      case 0x1f2b:
-        consumed = 1; return 0x397;
-      case 0x1f2c:
-        consumed = 1; return 0x397;
-      case 0x1f2d:
-        consumed = 1; return 0x397;
-      case 0x1f2e:
-        consumed = 1; return 0x397;
-      case 0x1f2f:
-        consumed = 1; return 0x397;
-      case 0x1f30:
-        consumed = 1; return 0x3b9;
-      case 0x1f31:
-        consumed = 1; return 0x3b9;
-      case 0x1f32:
-        consumed = 1; return 0x3b9;
-      case 0x1f33:
-        consumed = 1; return 0x3b9;
-      case 0x1f34:
-        consumed = 1; return 0x3b9;
-      case 0x1f35:
-        consumed = 1; return 0x3b9;
-      case 0x1f36:
-        consumed = 1; return 0x3b9;
-      case 0x1f37:
-        consumed = 1; return 0x3b9;
-      case 0x1f38:
-        consumed = 1; return 0x399;
-      case 0x1f39:
-        consumed = 1; return 0x399;
-      case 0x1f3a:
-        consumed = 1; return 0x399;
-      case 0x1f3b:
-        consumed = 1; return 0x399;
-      case 0x1f3c:
-        consumed = 1; return 0x399;
-      case 0x1f3d:
-        consumed = 1; return 0x399;
-      case 0x1f3e:
-        consumed = 1; return 0x399;
-      case 0x1f3f:
-        consumed = 1; return 0x399;
-      case 0x1f40:
-        consumed = 1; return 0x3bf;
-      case 0x1f41:
-        consumed = 1; return 0x3bf;
-      case 0x1f42:
-        consumed = 1; return 0x3bf;
-      case 0x1f43:
-        consumed = 1; return 0x3bf;
-      case 0x1f44:
-        consumed = 1; return 0x3bf;
-      case 0x1f45:
-        consumed = 1; return 0x3bf;
-      case 0x1f48:
-        consumed = 1; return 0x39f;
-      case 0x1f49:
-        consumed = 1; return 0x39f;
-      case 0x1f4a:
-        consumed = 1; return 0x39f;
-      case 0x1f4b:
-        consumed = 1; return 0x39f;
-      case 0x1f4c:
-        consumed = 1; return 0x39f;
-      case 0x1f4d:
-        consumed = 1; return 0x39f;
-      case 0x1f50:
-        consumed = 1; return 0x3c5;
-      case 0x1f51:
-        consumed = 1; return 0x3c5;
-      case 0x1f52:
-        consumed = 1; return 0x3c5;
-      case 0x1f53:
-        consumed = 1; return 0x3c5;
-      case 0x1f54:
-        consumed = 1; return 0x3c5;
-      case 0x1f55:
-        consumed = 1; return 0x3c5;
-      case 0x1f56:
-        consumed = 1; return 0x3c5;
-      case 0x1f57:
-        consumed = 1; return 0x3c5;
-      case 0x1f59:
-        consumed = 1; return 0x3a5;
-      case 0x1f5b:
-        consumed = 1; return 0x3a5;
-      case 0x1f5d:
-        consumed = 1; return 0x3a5;
-      case 0x1f5f:
-        consumed = 1; return 0x3a5;
-      case 0x1f60:
-        consumed = 1; return 0x3c9;
-      case 0x1f61:
-        consumed = 1; return 0x3c9;
-      case 0x1f62:
-        consumed = 1; return 0x3c9;
-      case 0x1f63:
-        consumed = 1; return 0x3c9;
-      case 0x1f64:
-        consumed = 1; return 0x3c9;
-      case 0x1f65:
-        consumed = 1; return 0x3c9;
-      case 0x1f66:
-        consumed = 1; return 0x3c9;
-      case 0x1f67:
-        consumed = 1; return 0x3c9;
-      case 0x1f68:
-        consumed = 1; return 0x3a9;
-      case 0x1f69:
-        consumed = 1; return 0x3a9;
-      case 0x1f6a:
-        consumed = 1; return 0x3a9;
-      case 0x1f6b:
-        consumed = 1; return 0x3a9;
-      case 0x1f6c:
-        consumed = 1; return 0x3a9;
-      case 0x1f6d:
-        consumed = 1; return 0x3a9;
-      case 0x1f6e:
-        consumed = 1; return 0x3a9;
-      case 0x1f6f:
-        consumed = 1; return 0x3a9;
-      case 0x1f70:
-        consumed = 1; return 0x3b1;
-      case 0x1f71:
-        consumed = 1; return 0x3b1;
-      case 0x1f72:
-        consumed = 1; return 0x3b5;
-      case 0x1f73:
-        consumed = 1; return 0x3b5;
-      case 0x1f74:
-        consumed = 1; return 0x3b7;
-      case 0x1f75:
-        consumed = 1; return 0x3b7;
-      case 0x1f76:
-        consumed = 1; return 0x3b9;
-      case 0x1f77:
-        consumed = 1; return 0x3b9;
-      case 0x1f78:
-        consumed = 1; return 0x3bf;
-      case 0x1f79:
-        consumed = 1; return 0x3bf;
-      case 0x1f7a:
-        consumed = 1; return 0x3c5;
-      case 0x1f7b:
-        consumed = 1; return 0x3c5;
-      case 0x1f7c:
-        consumed = 1; return 0x3c9;
-      case 0x1f7d:
-        consumed = 1; return 0x3c9;
-      case 0x1f80:
-        consumed = 1; return 0x3b1;
-      case 0x1f81:
-        consumed = 1; return 0x3b1;
-      case 0x1f82:
-        consumed = 1; return 0x3b1;
-      case 0x1f83:
-        consumed = 1; return 0x3b1;
-      case 0x1f84:
-        consumed = 1; return 0x3b1;
-      case 0x1f85:
-        consumed = 1; return 0x3b1;
-      case 0x1f86:
-        consumed = 1; return 0x3b1;
-      case 0x1f87:
-        consumed = 1; return 0x3b1;
-      case 0x1f88:
-        consumed = 1; return 0x391;
-      case 0x1f89:
-        consumed = 1; return 0x391;
-      case 0x1f8a:
-        consumed = 1; return 0x391;
-      case 0x1f8b:
-        consumed = 1; return 0x391;
-      case 0x1f8c:
-        consumed = 1; return 0x391;
-      case 0x1f8d:
-        consumed = 1; return 0x391;
-      case 0x1f8e:
-        consumed = 1; return 0x391;
-      case 0x1f8f:
-        consumed = 1; return 0x391;
-      case 0x1f90:
-        consumed = 1; return 0x3b7;
-      case 0x1f91:
-        consumed = 1; return 0x3b7;
-      case 0x1f92:
-        consumed = 1; return 0x3b7;
-      case 0x1f93:
-        consumed = 1; return 0x3b7;
-      case 0x1f94:
-        consumed = 1; return 0x3b7;
-      case 0x1f95:
-        consumed = 1; return 0x3b7;
-      case 0x1f96:
-        consumed = 1; return 0x3b7;
-      case 0x1f97:
-        consumed = 1; return 0x3b7;
-      case 0x1f98:
-        consumed = 1; return 0x397;
-      case 0x1f99:
-        consumed = 1; return 0x397;
-      case 0x1f9a:
-        consumed = 1; return 0x397;
-      case 0x1f9b:
-        consumed = 1; return 0x397;
-      case 0x1f9c:
-        consumed = 1; return 0x397;
-      case 0x1f9d:
-        consumed = 1; return 0x397;
-      case 0x1f9e:
-        consumed = 1; return 0x397;
-      case 0x1f9f:
-        consumed = 1; return 0x397;
-      case 0x1fa0:
-        consumed = 1; return 0x3c9;
-      case 0x1fa1:
-        consumed = 1; return 0x3c9;
-      case 0x1fa2:
-        consumed = 1; return 0x3c9;
-      case 0x1fa3:
-        consumed = 1; return 0x3c9;
-      case 0x1fa4:
-        consumed = 1; return 0x3c9;
-      case 0x1fa5:
-        consumed = 1; return 0x3c9;
-      case 0x1fa6:
-        consumed = 1; return 0x3c9;
-      case 0x1fa7:
-        consumed = 1; return 0x3c9;
-      case 0x1fa8:
-        consumed = 1; return 0x3a9;
-      case 0x1fa9:
-        consumed = 1; return 0x3a9;
-      case 0x1faa:
-        consumed = 1; return 0x3a9;
-      case 0x1fab:
-        consumed = 1; return 0x3a9;
-      case 0x1fac:
-        consumed = 1; return 0x3a9;
-      case 0x1fad:
-        consumed = 1; return 0x3a9;
-      case 0x1fae:
-        consumed = 1; return 0x3a9;
-      case 0x1faf:
-        consumed = 1; return 0x3a9;
-      case 0x1fb0:
-        consumed = 1; return 0x3b1;
-      case 0x1fb1:
-        consumed = 1; return 0x3b1;
-      case 0x1fb2:
-        consumed = 1; return 0x3b1;
-      case 0x1fb3:
-        consumed = 1; return 0x3b1;
-      case 0x1fb4:
-        consumed = 1; return 0x3b1;
-      case 0x1fb6:
-        consumed = 1; return 0x3b1;
-      case 0x1fb7:
-        consumed = 1; return 0x3b1;
-      case 0x1fb8:
-        consumed = 1; return 0x391;
-      case 0x1fb9:
-        consumed = 1; return 0x391;
-      case 0x1fba:
-        consumed = 1; return 0x391;
-      case 0x1fbb:
-        consumed = 1; return 0x391;
-      case 0x1fbc:
-        consumed = 1; return 0x391;
-      case 0x1fc2:
-        consumed = 1; return 0x3b7;
-      case 0x1fc3:
-        consumed = 1; return 0x3b7;
-      case 0x1fc4:
-        consumed = 1; return 0x3b7;
-      case 0x1fc6:
-        consumed = 1; return 0x3b7;
-      case 0x1fc7:
-        consumed = 1; return 0x3b7;
-      case 0x1fc8:
-        consumed = 1; return 0x395;
-      case 0x1fc9:
-        consumed = 1; return 0x395;
-      case 0x1fca:
-        consumed = 1; return 0x397;
-      case 0x1fcb:
-        consumed = 1; return 0x397;
-      case 0x1fcc:
-        consumed = 1; return 0x397;
-      case 0x1fd0:
-        consumed = 1; return 0x3b9;
-      case 0x1fd1:
-        consumed = 1; return 0x3b9;
-      case 0x1fd2:
-        consumed = 1; return 0x3b9;
-      case 0x1fd3:
-        consumed = 1; return 0x3b9;
-      case 0x1fd6:
-        consumed = 1; return 0x3b9;
-      case 0x1fd7:
-        consumed = 1; return 0x3b9;
-      case 0x1fd8:
-        consumed = 1; return 0x399;
-      case 0x1fd9:
-        consumed = 1; return 0x399;
-      case 0x1fda:
-        consumed = 1; return 0x399;
-      case 0x1fdb:
-        consumed = 1; return 0x399;
-      case 0x1fe0:
-        consumed = 1; return 0x3c5;
-      case 0x1fe1:
-        consumed = 1; return 0x3c5;
-      case 0x1fe2:
-        consumed = 1; return 0x3c5;
-      case 0x1fe3:
-        consumed = 1; return 0x3c5;
-      case 0x1fe4:
-        consumed = 1; return 0x3c1;
-      case 0x1fe5:
-        consumed = 1; return 0x3c1;
-      case 0x1fe6:
-        consumed = 1; return 0x3c5;
-      case 0x1fe7:
-        consumed = 1; return 0x3c5;
-      case 0x1fe8:
-        consumed = 1; return 0x3a5;
-      case 0x1fe9:
-        consumed = 1; return 0x3a5;
-      case 0x1fea:
-        consumed = 1; return 0x3a5;
-      case 0x1feb:
-        consumed = 1; return 0x3a5;
-      case 0x1fec:
-        consumed = 1; return 0x3a1;
-      case 0x1ff2:
-        consumed = 1; return 0x3c9;
-      case 0x1ff3:
-        consumed = 1; return 0x3c9;
-      case 0x1ff4:
-        consumed = 1; return 0x3c9;
-      case 0x1ff6:
-        consumed = 1; return 0x3c9;
-      case 0x1ff7:
-        consumed = 1; return 0x3c9;
-      case 0x1ff8:
-        consumed = 1; return 0x39f;
-      case 0x1ff9:
-        consumed = 1; return 0x39f;
-      case 0x1ffa:
-        consumed = 1; return 0x3a9;
-      case 0x1ffb:
-        consumed = 1; return 0x3a9;
-      case 0x1ffc:
-        consumed = 1; return 0x3a9;
-      case 0xfb1d:
-        consumed = 1; return 0x5d9;
-      case 0xfb2a:
-        consumed = 1; return 0x5e9;
-      case 0xfb2b:
-        consumed = 1; return 0x5e9;
-      case 0xfb2c:
-        consumed = 1; return 0x5e9;
-      case 0xfb2d:
-        consumed = 1; return 0x5e9;
-      case 0xfb2e:
-        consumed = 1; return 0x5d0;
-      case 0xfb2f:
-        consumed = 1; return 0x5d0;
-      case 0xfb30:
-        consumed = 1; return 0x5d0;
-      case 0xfb31:
-        consumed = 1; return 0x5d1;
-      case 0xfb32:
-        consumed = 1; return 0x5d2;
-      case 0xfb33:
-        consumed = 1; return 0x5d3;
-      case 0xfb34:
-        consumed = 1; return 0x5d4;
-      case 0xfb35:
-        consumed = 1; return 0x5d5;
-      case 0xfb36:
-        consumed = 1; return 0x5d6;
-      case 0xfb38:
-        consumed = 1; return 0x5d8;
-      case 0xfb39:
-        consumed = 1; return 0x5d9;
-      case 0xfb3a:
-        consumed = 1; return 0x5da;
-      case 0xfb3b:
-        consumed = 1; return 0x5db;
-      case 0xfb3c:
-        consumed = 1; return 0x5dc;
-      case 0xfb3e:
-        consumed = 1; return 0x5de;
-      case 0xfb40:
-        consumed = 1; return 0x5e0;
-      case 0xfb41:
-        consumed = 1; return 0x5e1;
-      case 0xfb43:
-        consumed = 1; return 0x5e3;
-      case 0xfb44:
-        consumed = 1; return 0x5e4;
-      case 0xfb46:
-        consumed = 1; return 0x5e6;
-      case 0xfb47:
-        consumed = 1; return 0x5e7;
-      case 0xfb48:
-        consumed = 1; return 0x5e8;
-      case 0xfb49:
-        consumed = 1; return 0x5e9;
-      case 0xfb4a:
-        consumed = 1; return 0x5ea;
-      case 0xfb4b:
-        consumed = 1; return 0x5d5;
-      case 0xfb4c:
-        consumed = 1; return 0x5d1;
-      case 0xfb4d:
-        consumed = 1; return 0x5db;
-      case 0xfb4e:
-        consumed = 1; return 0x5e4;
-    }
+    consumed = 0;
+    return 0;
   }
-  if ( size )
+
+  uint32_t ch = in[ 0 ];
+
+  unsigned node = ch < 0x110000 ?
+                  foldDiacriticRootData[ foldDiacriticRootPages[ ch >> 8 ] ][ ch & 0xFF ] : 0;
+
+  consumed = 1;
+
+  if ( !node )
+    return in[ 0 ];
+
+  wchar result = foldDiacriticNodes[ node ].result;
+
+  // Follow the longest sequence
+  for( size_t depth = 1; depth < size; ++depth )
   {
-    consumed = 1; return *in;
+    FoldDiacriticNode const * child = foldDiacriticNodes + foldDiacriticNodes[ node ].firstChild;
+    FoldDiacriticNode const * end = child + foldDiacriticNodes[ node ].childCount;
+
+    while( child != end && child->ch < in[ depth ] )
+      ++child;
+
+    if ( child == end || child->ch != in[ depth ] )
+      break;
+
+    node = child - foldDiacriticNodes;
+    result = child->result;
+    consumed = depth + 1;
   }
-  consumed = 0; return 0;
+
+  return result;
 }
@@ -5,19 +5,21 @@
 #include "folding.hh"
 #include "wstring_qt.hh"
 #include "language.hh"
+#include "utf8.hh"
 
 #ifdef _MSC_VER
 #include <stub_msvc.h>
 #endif
 
 #include <cctype>
+#include <stdint.h>
+#include <unordered_map>
 #include <QLocale>
 
-LangCoder langCoder;
+// Language codes, sorted by the two-letter ones. The table is constant, so
+// it needs no setting up at startup, and is searched with findByCode2().
 
-// Language codes
-
-static GDLangCode LangCodes[] = {
+static constexpr GDLangCode LangCodes[] = {
 
     { "aa", "aar", -1, "Afar" },
     { "ab", "abk", -1, "Abkhazian" },
@@ -94,6 +96,7 @@ static GDLangCode LangCodes[] = {
     { "it", "ita", 0, "Italian" },
     { "iu", "iku", -1, "Inuktitut" },
     { "ja", "jpn", 0, "Japanese" },
+    { "jb", "jbo", 0, "Lojban" },
     { "jv", "jav", -1, "Javanese" },
     { "ka", "geo", 0, "Georgian" },
     { "kg", "kon", -1, "Kongo" },
@@ -204,25 +207,25 @@ static GDLangCode LangCodes[] = {
     { "za", "zha", -1, "Zhuang" },
     { "zh", "chi", 0, "Chinese" },
     { "zu", "zul", -1, "Zulu" },
-    { "jb", "jbo", 0, "Lojban" },
 
     { "", "", 0, "" }
 };
 
-LangCoder::LangCoder()
+// Not counting the terminating entry
+static size_t const LangCodeCount = sizeof( LangCodes ) / sizeof( LangCodes[ 0 ] ) - 1;
+
+static_assert( isSortedByCode2( LangCodes, LangCodeCount ),
+               "The language codes must be sorted" );
+
+static GDLangCode const * findLangCode( quint32 code )
 {
-  for (int i = 0; true; i++) {
-    const GDLangCode &lc = LangCodes[i];
-    if (lc.lang[0] == 0)
-      break;
-    codeMap[code2toInt(lc.code)] = i;
-  }
+  return findByCode2( LangCodes, LangCodeCount, code );
 }
 
 QString LangCoder::decode(quint32 code)
 {
-  if (langCoder.codeMap.contains(code))
-    return LangCodes[langCoder.codeMap[code]].lang;
+  if ( GDLangCode const * lc = findLangCode( code ) )
+    return lc->lang;
 
   return QString();
 }
@@ -230,10 +233,9 @@ QString LangCoder::decode(quint32 code)
 /*
 QIcon LangCoder::icon(quint32 code)
 {
-  if (langCoder.codeMap.contains(code))
+  if ( GDLangCode const * lc = findLangCode( code ) )
   {
-    const GDLangCode &lc = LangCodes[ langCoder.codeMap[ code ] ];
-    return QIcon( ":/flags/" + QString(lc.code) + ".png" );
+    return QIcon( ":/flags/" + QString(lc->code) + ".png" );
   }
 
   return QIcon();
@@ -245,11 +247,9 @@ LangStruct LangCoder::langStruct(quint32 code)
   LangStruct ls;
   ls.code = code;
   ls.order = -1;
-  if (codeMap.contains(code)) {
-    int order = codeMap[code];
-    const GDLangCode &lc = LangCodes[order];
-    ls.order = order;
-    ls.lang = lc.lang;
+  if ( GDLangCode const * lc = findLangCode( code ) ) {
+    ls.order = lc - LangCodes;
+    ls.lang = lc->lang;
 //    ls.icon = QIcon(":/flags/" + QString(lc.code) + ".png");
   }
   return ls;
@@ -280,21 +280,63 @@ quint32 LangCoder::code3toInt(const std::string& code3)
   return ( ((quint32)code1) << 8 ) + (quint32)code0;
 }
 
-quint32 LangCoder::findIdForLanguage( gd::wstring const & lang )
+namespace {
+
+struct WstringHash
 {
-  gd::wstring langFolded = Folding::apply( lang );
+  size_t operator()( gd::wstring const & str ) const
+  {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+
+    for( size_t x = 0; x < str.size(); ++x )
+      hash = ( hash ^ (uint32_t) str[ x ] ) * 16777619u;
+
+    return hash;
+  }
+};
 
+typedef std::unordered_map< gd::wstring, quint32, WstringHash > LanguageIndex;
+
+LanguageIndex makeLanguageIndex()
+{
+  LanguageIndex index;
+
+  // The first name wins, as it did when the tables were searched in order
   for( GDLangCode const * lc = LangCodes; lc->code[ 0 ]; ++lc )
+    index.insert( LanguageIndex::value_type( Folding::apply( Utf8::decode( lc->lang ) ),
+                                             LangCoder::code2toInt( lc->code ) ) );
+
+  for( int x = 0; x < Language::getBabylonLangCount(); ++x )
   {
-    if ( langFolded == Folding::apply( gd::toWString( lc->lang ) ) )
-    {
-      // We've got a match
-      return code2toInt( lc->code );
-    }
+    Language::BabylonLang const lang = Language::getBabylonLangByIndex( x );
+
+    index.insert( LanguageIndex::value_type( Folding::apply( gd::toWString( lang.englishName ) ),
+                                             lang.id ) );
   }
 
-  return Language::findBlgLangIDByEnglishName( lang );
-  //return 0;
+  return index;
+}
+
+/// Maps the folded English names of all the languages, the Babylon ones
+/// included, to their ids. It's made on the first use and never changes
+/// after that, so it can be used from any thread.
+LanguageIndex const & languageIndex()
+{
+  static LanguageIndex const index = makeLanguageIndex();
+
+  return index;
+}
+
+}
+
+quint32 LangCoder::findIdForLanguage( gd::wstring const & lang )
+{
+  LanguageIndex const & index = languageIndex();
+
+  LanguageIndex::const_iterator i = index.find( Folding::apply( lang ) );
+
+  return i == index.end() ? 0 : i->second;
 }
 
 quint32 LangCoder::findIdForLanguageCode3( const char * code3 )
@@ -364,18 +406,19 @@ QPair<quint32,quint32> LangCoder::findIdsForFilename( QString const & name )
 
 bool LangCoder::isLanguageRTL( quint32 code )
 {
-  if ( langCoder.codeMap.contains( code ) )
+  if ( GDLangCode const * lc = findLangCode( code ) )
   {
-    GDLangCode &lc = LangCodes[ langCoder.codeMap[ code ] ];
-    if( lc.isRTL < 0 )
+    // The table is constant, so what Qt says isn't kept. It's only asked
+    // once for each dictionary
+    if( lc->isRTL < 0 )
     {
 #if QT_VERSION >= 0x040700
-      lc.isRTL = ( int )( QLocale( lc.code ).textDirection() == Qt::RightToLeft );
+      return QLocale( lc->code ).textDirection() == Qt::RightToLeft;
 #else
-      lc.isRTL = 0;
+      return false;
 #endif
     }
-    return lc.isRTL != 0;
+    return lc->isRTL != 0;
   }
 
   return false;
@@ -18,6 +18,48 @@ struct GDLangCode
 template <typename T, int N>
 inline int arraySize(T (&)[N])   { return N; }
 
+/// Compares the two-letter codes the way strcmp() would
+constexpr bool code2Less( char const * a, char const * b )
+{ return (unsigned char) a[ 0 ] < (unsigned char) b[ 0 ] ||
+         ( a[ 0 ] == b[ 0 ] && (unsigned char) a[ 1 ] < (unsigned char) b[ 1 ] ); }
+
+/// Checks at compile time that the first size entries of the table are
+/// sorted by their codes, with no duplicates, so findByCode2() can be used.
+template< typename T, size_t N >
+constexpr bool isSortedByCode2( T const ( & table )[ N ], size_t size = N, size_t x = 0 )
+{ return x + 1 >= size ||
+         ( code2Less( table[ x ].code, table[ x + 1 ].code ) &&
+           isSortedByCode2( table, size, x + 1 ) ); }
+
+/// Finds the entry with the code for the given id, as made by
+/// LangCoder::code2toInt(), with a binary search among the first size entries
+/// of the table. Returns 0 if there's none.
+template< typename T, size_t N >
+T const * findByCode2( T const ( & table )[ N ], size_t size, quint32 id )
+{
+  if ( !id || id > 0xFFFF )
+    return 0;
+
+  char const code[ 2 ] = { char( id & 0xFF ), char( id >> 8 ) };
+
+  T const * begin = table, * end = table + size;
+
+  while( begin != end )
+  {
+    T const * middle = begin + ( end - begin ) / 2;
+
+    if ( code2Less( middle->code, code ) )
+      begin = middle + 1;
+    else
+      end = middle;
+  }
+
+  if ( begin != table + size && begin->code[ 0 ] == code[ 0 ] && begin->code[ 1 ] == code[ 1 ] )
+    return begin;
+
+  return 0;
+}
+
 
 struct LangStruct
 {
@@ -29,7 +71,6 @@ struct LangStruct
 class LangCoder
 {
 public:
-  LangCoder();
 
   static quint32 code2toInt(const char code[2])
   { return ( ((quint32)code[1]) << 8 ) + (quint32)code[0]; }
@@ -52,20 +93,18 @@ public:
   /// Returns decoded name of language or empty string if not found.
   static QString decode(quint32 code);
 
-  /// Return true for RTL languages
+  /// Return true for RTL languages. Like the other lookups, it may be called
+  /// from several threads at once, as the batch mode does: the tables are
+  /// constant, and nothing is cached in them.
   static bool isLanguageRTL(quint32 code);
 
   //const QMap<quint32, int>& codes() { return codeMap; }
 
-  LangStruct langStruct(quint32 code);
+  static LangStruct langStruct(quint32 code);
 
 //	QString CodeToHtml(const QString &code);
 
 //	bool CheckCode(QString &code);
-
-private:
-  QMap<quint32, int> codeMap;
-//	LangStruct dummyLS;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -43,11 +43,12 @@ QString localizedStringForId( Id );
 
 struct BabylonLang{
     Id id;
-    const QString contryCode;
-    const QString englishName;
+    const char * contryCode;
+    const char * englishName;
     const char * localizedName;
 };
 BabylonLang getBabylonLangByIndex( int index );
+int getBabylonLangCount();
 quint32 findBlgLangIDByEnglishName( gd::wstring const & lang );
 }
 
@@ -1,4 +1,6 @@
 #include <QVector>
+#include <QFile>
+#include <QFileInfo>
 
 #ifdef Q_OS_WIN32
 #include <windows.h>
@@ -8,16 +10,641 @@
 
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdint.h>
 #include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <chrono>
+#include <mutex>
 
 #include "folding.hh"
 #include "utf8.hh"
 #include "dsl.hh"
+#include "dslindex.hh"
+#include "glswriter.hh"
+#include "batch.hh"
+#include "shard.hh"
+#include "stats.hh"
+#include "slowest.hh"
+#include "mediamanifest.hh"
+#include "fsencoding.hh"
+#include "ufile.hh"
 #include "langcoder.hh"
 
 using std::string;
 
+// Set by the command line options
+static bool useIndex = false;
+static char const * renderCacheName = 0;
+static unsigned threads = 0; // 0 means one per hardware thread
+static GlsWriter::SyncPolicy syncPolicy = GlsWriter::SyncNever;
+static bool ioHints = false;
+static bool batchMode = false;
+static unsigned planShards = 0;
+static bool shardMode = false;
+static unsigned shardIndex = 0;
+static bool mergeMode = false;
+static bool showStats = false;
+static unsigned slowestCount = 0;
+static bool writeMediaManifest = false;
+
+// Keeps the lists of the slowest articles of the dictionaries converted at
+// once in the batch mode from getting mixed up
+static std::mutex slowestReportMutex;
+
+static unsigned threadCount()
+{
+  if( threads )
+    return threads;
+
+  unsigned n = std::thread::hardware_concurrency();
+  return n ? n : 1;
+}
+
+static void printUsage( char const * programName )
+{
+  printf( "Usage: %s [options] dsl_file gls_file\n"
+          "       %s [options] --batch dsl_dir_or_manifest gls_dir\n"
+          "       %s [options] --plan N dsl_file plan_file\n"
+          "       %s [options] --shard K plan_file\n"
+          "       %s [options] --merge plan_file gls_file\n"
+          "The output is compressed if gls_file ends with .gz, or with .dz for the\n"
+          "dictzip format\n"
+          "Options:\n"
+          "  --max-variants N   Use at most N variants of a headword with optional\n"
+          "                     parts (default %u)\n"
+          "  --index            Keep the dictionary's index in a file next to it,\n"
+          "                     so the next runs don't have to scan it again\n"
+          "  --render-cache FILE  Keep the rendered articles in the given file, and\n"
+          "                     reuse the ones which haven't changed since the last run\n"
+          "  --threads N        Use N threads to index the dictionary and compress the\n"
+          "                     output (default is one per processor)\n"
+          "  --sync MODE        Sync the output file to disk: never (default), end,\n"
+          "                     or buffer (after each written buffer)\n"
+          "  --io-hints         Preallocate the output file and keep it out of the\n"
+          "                     page cache\n"
+          "  --batch            Convert all the dictionaries in a directory, or listed\n"
+          "                     in a manifest file, several at once\n"
+          "  --plan N           Split the conversion into N shards of about the same\n"
+          "                     size, and write the plan for them\n"
+          "  --shard K          Convert the shard K (counting from 0) of the plan. The\n"
+          "                     output goes next to the plan, as plan_file.K\n"
+          "  --merge            Put the converted shards of the plan together\n"
+          "  --stats            Print the counters and the time taken by each phase\n"
+          "                     of the conversion as JSON at the end\n"
+          "  --slowest N        Time each article, and list the N slowest ones at the\n"
+          "                     end\n"
+          "  --media-manifest   List the media files the articles refer to, and where\n"
+          "                     each one is, next to the output as gls_file.media\n",
+          programName, programName, programName, programName, programName,
+          Dsl::Details::getOptionalPartsLimit() );
+}
+
+/// Handles the option at args[ 0 ]. Returns the number of arguments consumed,
+/// or 0 if the option is unknown or malformed.
+static int parseOption( int argsLeft, char const * const * args )
+{
+  if ( strcmp( args[ 0 ], "--max-variants" ) == 0 && argsLeft > 1 )
+  {
+    int n = atoi( args[ 1 ] );
+    if ( n <= 0 )
+      return 0;
+    Dsl::Details::setOptionalPartsLimit( n );
+    return 2;
+  }
+
+  if ( strcmp( args[ 0 ], "--index" ) == 0 )
+  {
+    useIndex = true;
+    return 1;
+  }
+
+  if ( strcmp( args[ 0 ], "--render-cache" ) == 0 && argsLeft > 1 )
+  {
+    renderCacheName = args[ 1 ];
+    return 2;
+  }
+
+  if ( strcmp( args[ 0 ], "--threads" ) == 0 && argsLeft > 1 )
+  {
+    int n = atoi( args[ 1 ] );
+    if ( n <= 0 )
+      return 0;
+    threads = n;
+    return 2;
+  }
+
+  if ( strcmp( args[ 0 ], "--sync" ) == 0 && argsLeft > 1 )
+  {
+    if ( strcmp( args[ 1 ], "never" ) == 0 )
+      syncPolicy = GlsWriter::SyncNever;
+    else
+    if ( strcmp( args[ 1 ], "end" ) == 0 )
+      syncPolicy = GlsWriter::SyncAtEnd;
+    else
+    if ( strcmp( args[ 1 ], "buffer" ) == 0 )
+      syncPolicy = GlsWriter::SyncEachBuffer;
+    else
+      return 0;
+    return 2;
+  }
+
+  if ( strcmp( args[ 0 ], "--io-hints" ) == 0 )
+  {
+    ioHints = true;
+    return 1;
+  }
+
+  if ( strcmp( args[ 0 ], "--batch" ) == 0 )
+  {
+    batchMode = true;
+    return 1;
+  }
+
+  if ( strcmp( args[ 0 ], "--plan" ) == 0 && argsLeft > 1 )
+  {
+    int n = atoi( args[ 1 ] );
+    if ( n <= 0 )
+      return 0;
+    planShards = n;
+    return 2;
+  }
+
+  if ( strcmp( args[ 0 ], "--shard" ) == 0 && argsLeft > 1 )
+  {
+    char * end;
+    shardIndex = strtoul( args[ 1 ], &end, 10 );
+    if ( *end || end == args[ 1 ] )
+      return 0;
+    shardMode = true;
+    return 2;
+  }
+
+  if ( strcmp( args[ 0 ], "--merge" ) == 0 )
+  {
+    mergeMode = true;
+    return 1;
+  }
+
+  if ( strcmp( args[ 0 ], "--stats" ) == 0 )
+  {
+    showStats = true;
+    return 1;
+  }
+
+  if ( strcmp( args[ 0 ], "--slowest" ) == 0 && argsLeft > 1 )
+  {
+    int n = atoi( args[ 1 ] );
+    if ( n <= 0 )
+      return 0;
+    slowestCount = n;
+    return 2;
+  }
+
+  if ( strcmp( args[ 0 ], "--media-manifest" ) == 0 )
+  {
+    writeMediaManifest = true;
+    return 1;
+  }
+
+  return 0;
+}
+
+/// Checks that the options given make sense together, printing what's wrong
+/// if they don't.
+static bool checkOptions()
+{
+  if( batchMode + ( planShards != 0 ) + shardMode + mergeMode > 1 )
+  {
+    printf( "Only one of --batch, --plan, --shard and --merge can be given\n" );
+    return false;
+  }
+
+  // Each shard would replace the cache with its own articles only
+  if( shardMode && renderCacheName )
+  {
+    printf( "The render cache can't be used for the shards\n" );
+    return false;
+  }
+
+  return true;
+}
+
+/// Returns the name of the media manifest for the output file, or nothing if
+/// it isn't wanted.
+static string mediaNameFor( string const & glsName )
+{
+  return writeMediaManifest ? glsName + ".media" : string();
+}
+
+static string makeHeader( DslDictionary & dict, char const * dslName )
+{
+  return "### Glossary title:" + Utf8::encode( dict.getParams().name ) +
+         "\n### Author:\n### Description:" +
+         dict.getDescription( dslName ).toUtf8().data() +
+         "\n### Source language:" + Utf8::encode( dict.getParams().langFrom ) +
+         "\n### Target language:" + Utf8::encode( dict.getParams().langTo ) +
+         "\n### Glossary section:\n\n";
+}
+
+/// Renders the article, adding it to the slowest ones if it's one of them.
+/// The parsing and rendering times are taken from the stats' timers.
+static void timeArticle( DslDictionary & dict, DslCard const & card, string & article,
+                         SlowestArticles & slowest )
+{
+  Stats::Slot const & slot = Stats::local();
+  uint64_t parseStart = slot.nanoseconds[ Stats::Parsing ];
+  uint64_t renderStart = slot.nanoseconds[ Stats::Rendering ];
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  dict.getArticle( card, article );
+
+  double seconds = std::chrono::duration< double >( std::chrono::steady_clock::now()
+                                                    - start ).count();
+
+  if( !slowest.isSlowEnough( seconds ) )
+    return;
+
+  SlowestArticles::Entry entry;
+  entry.headword = Utf8::encode( card.headwords.at( 0 ) );
+  entry.offset = card.offset;
+  entry.size = card.size;
+  entry.seconds = seconds;
+  entry.parseSeconds = ( slot.nanoseconds[ Stats::Parsing ] - parseStart ) / 1e9;
+  entry.renderSeconds = ( slot.nanoseconds[ Stats::Rendering ] - renderStart ) / 1e9;
+  entry.outputBytes = article.size();
+
+  slowest.add( entry );
+}
+
+/// Writes the cards from begin up to end. If the slowest articles are given,
+/// each one is timed for them.
+static void writeCards( DslDictionary & dict, GlsWriter & writer, int begin, int end,
+                        SlowestArticles * slowest = 0 )
+{
+  string article;
+
+  for( int i = begin; i < end; i++ )
+  {
+    DslCard const & card = dict.getCards()[ i ];
+
+    article.clear();
+
+    if( slowest )
+      timeArticle( dict, card, article, *slowest );
+    else
+      dict.getArticle( card, article );
+
+    Stats::Timer timer( Stats::Writing );
+
+    writer.writeUtf8( card.headwords.at( 0 ) );
+
+    for( int j = 1; j < card.headwords.size(); j++ )
+    {
+      writer.write( '|' );
+      writer.writeUtf8( card.headwords.at( j ) );
+    }
+
+    writer.write( '\n' );
+    writer.write( article );
+    writer.write( "\n\n" );
+  }
+}
+
+/// Converts the dictionary into the output file, which is left open. Returns
+/// 0 on success. Otherwise the error is set, unless it was already reported.
+/// If the plan is given, only the shardIndex shard of it is converted. If the
+/// media manifest's name is given, the manifest is written there.
+static int convert( char const * dslName, char const * abrvName, FILE * outFile,
+                    GlsWriter::Format outFormat, unsigned threads, bool verbose,
+                    string const & mediaName, string & error,
+                    Shard::Plan const * plan = 0 )
+{
+  if( renderCacheName && !mediaName.empty() )
+  {
+    error = "the media manifest can't be made with the render cache, the cached "
+            "articles aren't rendered";
+    return -1;
+  }
+
+  DslDictionary dict;
+
+  dict.setIndexingThreads( threads );
+
+  try
+  {
+    int n = dict.setFiles( string( dslName ), abrvName,
+                           useIndex ? DslIndex::nameFor( dslName ) : string() );
+    if( n )
+      return n;
+
+    int begin = 0, end = dict.getCards().size();
+
+    if( plan )
+    {
+      if( end != plan->cardCount )
+      {
+        error = "the dictionary has changed since the plan was made";
+        return -1;
+      }
+
+      begin = plan->shards[ shardIndex ].begin;
+      end = plan->shards[ shardIndex ].end;
+      dict.setOptionalPartMarkers( true );
+    }
+
+    std::unique_ptr< RenderCache > renderCache;
+    if( renderCacheName )
+    {
+      renderCache.reset( new RenderCache( renderCacheName ) );
+      dict.setRenderCache( renderCache.get() );
+    }
+
+    GlsWriter writer( fileno( outFile ), outFormat, threads );
+    writer.setSyncPolicy( syncPolicy );
+
+    if( ioHints )
+    {
+      // The articles' source size is a fair guess of the output size
+      uint64_t expectedSize = 0;
+      for( int i = begin; i < end; i++ )
+        expectedSize += dict.getCards()[ i ].size;
+
+      writer.setDropWrittenPages( true );
+      writer.preallocate( expectedSize );
+    }
+
+    std::unique_ptr< SlowestArticles > slowest;
+    if( slowestCount )
+      slowest.reset( new SlowestArticles( slowestCount ) );
+
+    std::unique_ptr< MediaManifest > media;
+    if( !mediaName.empty() )
+    {
+      media.reset( new MediaManifest( dslName ) );
+      dict.setMediaManifest( media.get() );
+    }
+
+    if( !plan )
+      writer.write( makeHeader( dict, dslName ) );
+    writeCards( dict, writer, begin, end, slowest.get() );
+
+    {
+      Stats::Timer timer( Stats::Writing );
+      writer.finish();
+    }
+
+    Stats::add( Stats::OutputBytes, writer.getBytesWritten() );
+
+    ArticleCache const & cache = dict.getEmbeddedCardsCache();
+    if( verbose && cache.getLookups() )
+      printf( "Embedded cards: %u of %u decoded from cache (%.1f%%), %llu bytes saved\n",
+              cache.getHits(), cache.getLookups(),
+              100.0 * cache.getHits() / cache.getLookups(),
+              (unsigned long long) cache.getBytesSaved() );
+
+    if( slowest )
+    {
+      if( verbose )
+        slowest->print( stdout );
+      else
+      {
+        std::lock_guard< std::mutex > lock( slowestReportMutex );
+        printf( "\n%s:\n", dslName );
+        slowest->print( stdout );
+        fflush( stdout );
+      }
+    }
+
+    if( media )
+    {
+      if( verbose )
+        media->print( stdout );
+
+      if( !media->save( mediaName ) )
+        printf( "Warning: can't save the media manifest\n" );
+    }
+
+    if( renderCache )
+    {
+      if( verbose )
+        printf( "Render cache: %u hits, %u misses (%u not cacheable), %.2f s saved\n",
+                renderCache->getHits(), renderCache->getMisses(),
+                renderCache->getUncacheable(), renderCache->getSecondsSaved() );
+
+      if( !renderCache->commit() )
+        printf( "Warning: can't save the render cache\n" );
+    }
+
+  }
+  catch( std::exception & e )
+  {
+    error = e.what();
+    return -1;
+  }
+  catch( ... )
+  {
+    error = "unknown error";
+    return -1;
+  }
+
+  return 0;
+}
+
+/// Splits the conversion into planShards shards, and writes the plan into the
+/// output file.
+static int makePlan( char const * dslName, char const * abrvName, FILE * outFile,
+                     string & error )
+{
+  DslDictionary dict;
+
+  dict.setIndexingThreads( threadCount() );
+
+  try
+  {
+    int n = dict.setFiles( string( dslName ), abrvName,
+                           useIndex ? DslIndex::nameFor( dslName ) : string() );
+    if( n )
+      return n;
+
+    // The shards may run elsewhere, so the names have to be absolute
+    QFileInfo dslInfo( FsEncoding::decode( dslName ) );
+
+    Shard::Plan plan;
+    plan.dslName = FsEncoding::encode( dslInfo.absoluteFilePath() );
+    if( abrvName[ 0 ] )
+      plan.abrvName = FsEncoding::encode(
+        QFileInfo( FsEncoding::decode( abrvName ) ).absoluteFilePath() );
+    plan.dslStamp = DslIndex::stampFor( dslName );
+    plan.abrvStamp = DslIndex::stampFor( abrvName );
+    plan.optionalPartsLimit = Dsl::Details::getOptionalPartsLimit();
+    plan.cardCount = dict.getCards().size();
+    plan.header = makeHeader( dict, dslName );
+    plan.shards = Shard::split( dict.getCards(), planShards );
+
+    if( !Shard::save( outFile, plan ) )
+    {
+      error = "can't write the plan";
+      return -1;
+    }
+
+    for( unsigned i = 0; i < plan.shards.size(); i++ )
+      printf( "Shard %u: cards %d to %d\n", i, plan.shards[ i ].begin,
+              plan.shards[ i ].end - 1 );
+  }
+  catch( std::exception & e )
+  {
+    error = e.what();
+    return -1;
+  }
+
+  return 0;
+}
+
+/// Converts the shardIndex shard of the plan.
+static int convertShard( char const * planName )
+{
+  Shard::Plan plan;
+  string error;
+
+  if( !Shard::load( planName, plan, error ) )
+  {
+    printf( "\nCan't load the plan: %s\n", error.c_str() );
+    return -1;
+  }
+
+  if( shardIndex >= plan.shards.size() )
+  {
+    printf( "\nThe plan has only %u shards\n", (unsigned) plan.shards.size() );
+    return -1;
+  }
+
+  if( !Shard::checkSources( plan, error ) )
+  {
+    printf( "\nCan't convert the shard: %s\n", error.c_str() );
+    return -1;
+  }
+
+  Dsl::Details::setOptionalPartsLimit( plan.optionalPartsLimit );
+
+  // The shard only appears once it's complete, so the merge never takes an
+  // unfinished one
+  string shardName = Shard::shardName( planName, shardIndex );
+  string tmpName = shardName + ".tmp";
+
+  FILE * outFile = gd_fopen( tmpName.c_str(), "wb" );
+  if( outFile == 0 )
+  {
+    printf( "\nCan't open output file\n" );
+    return -1;
+  }
+
+  int result = convert( plan.dslName.c_str(), plan.abrvName.c_str(), outFile,
+                        GlsWriter::Plain, threadCount(), true, mediaNameFor( shardName ),
+                        error, &plan );
+
+  fclose( outFile );
+
+  if( result == 0 )
+  {
+    QFile::remove( FsEncoding::decode( shardName.c_str() ) );
+    if( !QFile::rename( FsEncoding::decode( tmpName.c_str() ),
+                        FsEncoding::decode( shardName.c_str() ) ) )
+    {
+      error = "can't rename " + tmpName + " to " + shardName;
+      result = -1;
+    }
+  }
+
+  if( result && !error.empty() )
+    printf( "\nConversion failed, error: %s\n", error.c_str() );
+
+  return result;
+}
+
+/// Writes the header and the converted shards of the plan into the output
+/// file.
+static int mergeShards( char const * planName, FILE * outFile,
+                        GlsWriter::Format outFormat, string & error )
+{
+  Shard::Plan plan;
+
+  if( !Shard::load( planName, plan, error ) || !Shard::checkSources( plan, error ) )
+    return -1;
+
+  try
+  {
+    GlsWriter writer( fileno( outFile ), outFormat, threadCount() );
+    writer.setSyncPolicy( syncPolicy );
+
+    if( !Shard::merge( planName, plan, writer, error ) )
+      return -1;
+
+    writer.finish();
+
+    Stats::add( Stats::OutputBytes, writer.getBytesWritten() );
+  }
+  catch( std::exception & e )
+  {
+    error = e.what();
+    return -1;
+  }
+
+  return 0;
+}
+
+/// Converts the dictionaries found in the input directory or manifest into
+/// the output directory.
+static int convertBatch( char const * input, char const * outDir )
+{
+  if( renderCacheName )
+  {
+    printf( "The render cache can't be used in the batch mode\n" );
+    return -1;
+  }
+
+  std::vector< Batch::Job > jobs;
+  string error;
+
+  if( !Batch::findJobs( input, outDir, jobs, error ) )
+  {
+    printf( "\nCan't find the dictionaries to convert: %s\n", error.c_str() );
+    return -1;
+  }
+
+  // The dictionaries are converted in parallel, one thread each
+  unsigned failed = Batch::run( jobs, threadCount(),
+                                []( Batch::Job const & job, string & error ) -> int
+  {
+    FILE * outFile = gd_fopen( job.glsName.c_str(), "wb" );
+    if( outFile == 0 )
+    {
+      error = "can't open output file " + job.glsName;
+      return -1;
+    }
+
+    int result = convert( job.dslName.c_str(), job.abrvName.c_str(), outFile,
+                          GlsWriter::Plain, 1, false, mediaNameFor( job.glsName ), error );
+
+    fclose( outFile );
+    return result;
+  } );
+
+  return failed ? 1 : 0;
+}
+
+/// Prints the stats, if they were asked for, and returns the result.
+static int finishRun( int result )
+{
+  if( showStats )
+    Stats::print( stdout );
+
+  return result;
+}
+
 #ifdef Q_OS_WIN32
 int main()
 {
@@ -26,10 +653,67 @@ int main()
   char uName[ MAX_PATH * 4 ], uAbbrName[ MAX_PATH * 4 ];
 
   LPWSTR *pstr = CommandLineToArgvW( GetCommandLineW(), &num );
-  if( pstr && num > 2 )
+
+  int argPos = 1;
+
+  if( pstr )
+  {
+    std::vector< string > args;
+    std::vector< char const * > argPtrs;
+
+    for( int i = 0; i < num; i++ )
+    {
+      char buf[ MAX_PATH * 4 ];
+      if( WideCharToMultiByte( CP_UTF8, 0, pstr[ i ], -1, buf, MAX_PATH * 4, 0, 0 ) == 0 )
+        buf[ 0 ] = 0;
+      args.push_back( buf );
+    }
+    for( int i = 0; i < num; i++ )
+      argPtrs.push_back( args[ i ].c_str() );
+
+    while( argPos < num && strncmp( argPtrs[ argPos ], "--", 2 ) == 0 )
+    {
+      int n = parseOption( num - argPos, &argPtrs[ argPos ] );
+      if( n == 0 )
+      {
+        printUsage( "DslToGls" );
+        return -1;
+      }
+      argPos += n;
+    }
+
+    if( !checkOptions() )
+      return -1;
+
+    // The slowest articles' parsing and rendering times come from the stats
+    if( showStats || slowestCount )
+      Stats::enable();
+
+    if( batchMode )
+    {
+      if( num - argPos != 2 )
+      {
+        printUsage( "DslToGls" );
+        return -1;
+      }
+      return finishRun( convertBatch( argPtrs[ argPos ], argPtrs[ argPos + 1 ] ) );
+    }
+
+    if( shardMode )
+    {
+      if( num - argPos != 1 )
+      {
+        printUsage( "DslToGls" );
+        return -1;
+      }
+      return finishRun( convertShard( argPtrs[ argPos ] ) );
+    }
+  }
+
+  if( pstr && num - argPos > 1 )
   {
-    wcscpy_s( dslName, MAX_PATH, pstr[ 1 ] );
-    wcscpy_s( glsName, MAX_PATH, pstr[ 2 ] );
+    wcscpy_s( dslName, MAX_PATH, pstr[ argPos ] );
+    wcscpy_s( glsName, MAX_PATH, pstr[ argPos + 1 ] );
     if( wcscmp( dslName, glsName ) == 0 )
     {
       printf( "Names must be different\n" );
@@ -38,7 +722,7 @@ int main()
   }
   else
   {
-    printf( "Usage: DslToGls dsl_file gls_file\n" );
+    printUsage( "DslToGls" );
     return -1;
   }
 
@@ -81,7 +765,13 @@ int main()
     }
   }
 
-  FILE * outFile = _wfopen( glsName, L"wt" );
+  char uGlsName[ MAX_PATH * 4 ];
+  if( WideCharToMultiByte( CP_UTF8, 0, glsName, -1, uGlsName, MAX_PATH * 4, 0, 0 ) == 0 )
+    uGlsName[ 0 ] = 0;
+  GlsWriter::Format outFormat = GlsWriter::formatFor( uGlsName );
+  string mediaName = mediaNameFor( uGlsName );
+
+  FILE * outFile = _wfopen( glsName, L"wb" );
   if( outFile == 0 )
   {
     printf( "\nCan't open output file\n" );
@@ -93,10 +783,50 @@ int main( int argc, char **argv )
 char uAbbrName[ PATH_MAX ];
 char *uName, *glsName;
 
-  if( argc > 2 )
+  int argPos = 1;
+
+  while( argPos < argc && strncmp( argv[ argPos ], "--", 2 ) == 0 )
   {
-    uName = argv[ 1 ];
-    glsName = argv[ 2 ];
+    int n = parseOption( argc - argPos, argv + argPos );
+    if( n == 0 )
+    {
+      printUsage( "dsltogls" );
+      return -1;
+    }
+    argPos += n;
+  }
+
+  if( !checkOptions() )
+    return -1;
+
+  // The slowest articles' parsing and rendering times come from the stats
+  if( showStats || slowestCount )
+    Stats::enable();
+
+  if( batchMode )
+  {
+    if( argc - argPos != 2 )
+    {
+      printUsage( "dsltogls" );
+      return -1;
+    }
+    return finishRun( convertBatch( argv[ argPos ], argv[ argPos + 1 ] ) );
+  }
+
+  if( shardMode )
+  {
+    if( argc - argPos != 1 )
+    {
+      printUsage( "dsltogls" );
+      return -1;
+    }
+    return finishRun( convertShard( argv[ argPos ] ) );
+  }
+
+  if( argc - argPos > 1 )
+  {
+    uName = argv[ argPos ];
+    glsName = argv[ argPos + 1 ];
 
     if( strcmp( uName, glsName ) == 0 )
     {
@@ -106,7 +836,7 @@ char *uName, *glsName;
   }
   else
   {
-    printf( "Usage: dsltogls dsl_file gls_file\n" );
+    printUsage( "dsltogls" );
     return -1;
   }
 
@@ -138,60 +868,31 @@ char *uName, *glsName;
     }
   }
 
-  FILE * outFile = fopen( glsName, "wt" );
+  GlsWriter::Format outFormat = GlsWriter::formatFor( glsName );
+  string mediaName = mediaNameFor( glsName );
+
+  FILE * outFile = fopen( glsName, "wb" );
   if( outFile == 0 )
   {
     printf( "\nCan't open output file\n" );
     return -1;
   }
 #endif
-  DslDictionary dict;
-
-  try
-  {
-    int n = dict.setFiles( string( uName ), uAbbrName );
-    if( n )
-    {
-      fclose( outFile );
-      return n;
-    }
+  string error;
+  int result;
 
-    fprintf( outFile, "### Glossary title:%s\n", Utf8::encode( dict.getParams().name ).c_str() );
-    fprintf( outFile, "### Author:\n" );
-    fprintf( outFile, "### Description:%s\n", dict.getDescription( uName ).toUtf8().data() );
-    fprintf( outFile, "### Source language:%s\n", Utf8::encode( dict.getParams().langFrom ).c_str() );
-    fprintf( outFile, "### Target language:%s\n", Utf8::encode( dict.getParams().langTo ).c_str() );
-    fprintf( outFile, "### Glossary section:\n\n" );
-
-    for( int i = 0; i < dict.getCards().size(); i++ )
-    {
-      DslCard const & card = dict.getCards()[ i ];
-
-      string article;
-      dict.getArticle( card, article );
-
-      fprintf( outFile, "%s", Utf8::encode( card.headwords.at( 0 ) ).c_str() );
-
-      for( int j = 1; j < card.headwords.size(); j++ )
-        fprintf( outFile, "|%s", Utf8::encode( card.headwords.at( j ) ).c_str() );
-
-      fprintf( outFile, "\n%s\n\n", article.c_str() );
-    }
+  if( planShards )
+    result = makePlan( uName, uAbbrName, outFile, error );
+  else
+  if( mergeMode )
+    result = mergeShards( uName, outFile, outFormat, error );
+  else
+    result = convert( uName, uAbbrName, outFile, outFormat, threadCount(), true, mediaName,
+                      error );
 
-  }
-  catch( std::exception & e )
-  {
-    fclose( outFile );
-    printf( "\nConversion failed, error: %s\n", e.what() );
-    return -1;
-  }
-  catch( ... )
-  {
-    fclose( outFile );
-    printf( "\nConversion failed\n" );
-    return -1;
-  }
+  if( result && !error.empty() )
+    printf( "\nConversion failed, error: %s\n", error.c_str() );
 
   fclose( outFile );
-  return 0;
+  return finishRun( result );
 }
@@ -0,0 +1,342 @@
+#include "mediamanifest.hh"
+
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+
+#include "folding.hh"
+#include "fsencoding.hh"
+#include "iconv.hh"
+#include "ufile.hh"
+#include "utf8.hh"
+#include "wstring_qt.hh"
+
+using std::string;
+using std::vector;
+using gd::wstring;
+
+namespace {
+
+/// The zip archives' records and the offsets of their fields. All the
+/// numbers in them are little-endian.
+enum
+{
+  EndOfCentralDirectorySignature = 0x06054b50,
+  EndOfCentralDirectorySize = 22,
+  MaxCommentSize = 0xFFFF,
+
+  Zip64LocatorSignature = 0x07064b50,
+  Zip64LocatorSize = 20,
+
+  Zip64EndOfCentralDirectorySignature = 0x06064b50,
+  Zip64EndOfCentralDirectorySize = 56,
+
+  CentralDirectoryEntrySignature = 0x02014b50,
+  CentralDirectoryEntrySize = 46,
+
+  Utf8NameFlag = 0x800
+};
+
+uint16_t get16( char const * p )
+{
+  unsigned char const * u = (unsigned char const *) p;
+
+  return u[ 0 ] | u[ 1 ] << 8;
+}
+
+uint32_t get32( char const * p )
+{
+  return get16( p ) | (uint32_t) get16( p + 2 ) << 16;
+}
+
+uint64_t get64( char const * p )
+{
+  return get32( p ) | (uint64_t) get32( p + 4 ) << 32;
+}
+
+bool readAt( QFile & file, uint64_t offset, vector< char > & data, size_t size )
+{
+  data.resize( size );
+
+  return file.seek( offset ) &&
+         ( !size || file.read( &data.front(), size ) == (qint64) size );
+}
+
+/// Reads the names of all the files in the archive from its central
+/// directory, decoding them into the wide strings. The archive's data isn't
+/// read at all.
+bool readArchiveNames( QString const & name, vector< wstring > & names )
+{
+  QFile file( name );
+
+  if ( !file.open( QIODevice::ReadOnly ) )
+    return false;
+
+  uint64_t fileSize = file.size();
+
+  // The end of central directory record is the last one, followed only by
+  // the archive's comment
+  size_t tailSize = std::min< uint64_t >( fileSize,
+                                          EndOfCentralDirectorySize + MaxCommentSize );
+
+  vector< char > tail;
+
+  if ( !readAt( file, fileSize - tailSize, tail, tailSize ) )
+    return false;
+
+  if ( tailSize < EndOfCentralDirectorySize )
+    return false;
+
+  // Look for the record's signature, going back from the end
+  size_t end = tailSize - EndOfCentralDirectorySize;
+
+  while( get32( &tail[ end ] ) != EndOfCentralDirectorySignature )
+    if ( !end-- )
+      return false;
+
+  uint64_t entryCount = get16( &tail[ end + 10 ] );
+  uint64_t directorySize = get32( &tail[ end + 12 ] );
+  uint64_t directoryOffset = get32( &tail[ end + 16 ] );
+
+  if ( ( entryCount == 0xFFFF || directorySize == 0xFFFFFFFF ||
+         directoryOffset == 0xFFFFFFFF ) &&
+       end >= Zip64LocatorSize &&
+       get32( &tail[ end - Zip64LocatorSize ] ) == Zip64LocatorSignature )
+  {
+    // The real numbers are in the zip64 record the locator points to
+    vector< char > record;
+
+    if ( !readAt( file, get64( &tail[ end - Zip64LocatorSize + 8 ] ), record,
+                  Zip64EndOfCentralDirectorySize ) ||
+         get32( &record.front() ) != Zip64EndOfCentralDirectorySignature )
+      return false;
+
+    entryCount = get64( &record[ 32 ] );
+    directorySize = get64( &record[ 40 ] );
+    directoryOffset = get64( &record[ 48 ] );
+  }
+
+  if ( directoryOffset > fileSize || directorySize > fileSize - directoryOffset )
+    return false;
+
+  vector< char > directory;
+
+  if ( !readAt( file, directoryOffset, directory, directorySize ) )
+    return false;
+
+  names.reserve( names.size() + std::min< uint64_t >( entryCount, directorySize ) );
+
+  for( size_t x = 0; x + CentralDirectoryEntrySize <= directory.size(); )
+  {
+    char const * entry = &directory[ x ];
+
+    if ( get32( entry ) != CentralDirectoryEntrySignature )
+      return false;
+
+    uint16_t flags = get16( entry + 8 );
+    size_t nameSize = get16( entry + 28 );
+    size_t nextEntry = x + CentralDirectoryEntrySize + nameSize + get16( entry + 30 ) +
+                       get16( entry + 32 );
+
+    if ( nextEntry > directory.size() )
+      return false;
+
+    char const * entryName = entry + CentralDirectoryEntrySize;
+
+    // The directories end with a slash
+    if ( nameSize && entryName[ nameSize - 1 ] != '/' )
+    {
+      // The names are UTF-8 if the flag says so, and CP437 otherwise, but many
+      // archivers store UTF-8 without setting the flag
+      vector< gd::wchar > buffer( nameSize );
+      long decoded = Utf8::decode( entryName, nameSize, &buffer.front() );
+
+      if ( decoded >= 0 )
+        names.push_back( wstring( &buffer.front(), decoded ) );
+      else
+      if ( !( flags & Utf8NameFlag ) )
+      {
+        try
+        {
+          names.push_back( Iconv::toWstring( "CP437", entryName, nameSize ) );
+        }
+        catch( Iconv::Ex & )
+        {
+        }
+      }
+    }
+
+    x = nextEntry;
+  }
+
+  return true;
+}
+
+bool locationLess( std::pair< string, MediaManifest::Location > const & a,
+                   std::pair< string, MediaManifest::Location > const & b )
+{
+  return a.first < b.first;
+}
+
+char const * locationName( MediaManifest::Location location )
+{
+  switch( location )
+  {
+    case MediaManifest::InDirectory:
+      return "dir";
+    case MediaManifest::InArchive:
+      return "zip";
+    case MediaManifest::Missing:
+    default:
+      return "missing";
+  }
+}
+
+}
+
+MediaManifest::MediaManifest( string const & dslName )
+{
+  // The resources are named after the .dsl file, or after the .dsl.dz one
+  QString name = FsEncoding::decode( dslName.c_str() );
+
+  QStringList baseNames;
+  baseNames << name;
+
+  if ( name.endsWith( ".dz", Qt::CaseInsensitive ) )
+    baseNames << name.left( name.size() - 3 );
+
+  for( int x = 0; x < baseNames.size(); ++x )
+  {
+    QString directoryName = baseNames[ x ] + ".files";
+
+    if ( QFileInfo( directoryName ).isDir() )
+      indexDirectory( directoryName );
+
+    QString archiveName = directoryName + ".zip";
+
+    if ( QFileInfo( archiveName ).isFile() && !indexArchive( archiveName ) )
+      printf( "Warning: can't read the resource archive %s\n",
+              FsEncoding::encode( archiveName ).c_str() );
+  }
+}
+
+void MediaManifest::indexDirectory( QString const & name )
+{
+  QDir directory( name );
+  QDirIterator i( name, QDir::Files, QDirIterator::Subdirectories |
+                                     QDirIterator::FollowSymlinks );
+
+  while( i.hasNext() )
+    directoryFiles.insert( keyFor( gd::toWString( directory.relativeFilePath( i.next() ) ) ) );
+}
+
+bool MediaManifest::indexArchive( QString const & name )
+{
+  vector< wstring > names;
+
+  if ( !readArchiveNames( name, names ) )
+    return false;
+
+  for( size_t x = 0; x < names.size(); ++x )
+    archiveFiles.insert( keyFor( names[ x ] ) );
+
+  return true;
+}
+
+string MediaManifest::keyFor( wstring const & name )
+{
+  wstring key = Folding::trimWhitespace( name );
+
+  for( size_t x = 0; x < key.size(); ++x )
+    if ( key[ x ] == L'\\' )
+      key[ x ] = L'/';
+
+  size_t keyBegin = key.find_first_not_of( L'/' );
+
+  if ( keyBegin == wstring::npos )
+    return string();
+
+  return Utf8::encode( Folding::applySimpleCaseOnly( key.substr( keyBegin ) ) );
+}
+
+void MediaManifest::add( string const & name )
+{
+  if ( name.empty() || files.find( name ) != files.end() )
+    return;
+
+  // The spaces around the name are ignored, as they are when its file type
+  // is told, so the file is listed and looked up without them
+  string trimmed, key;
+
+  try
+  {
+    wstring wideName = Folding::trimWhitespace( Utf8::decode( name ) );
+
+    trimmed = Utf8::encode( wideName );
+    key = keyFor( wideName );
+  }
+  catch( Utf8::exCantDecode & )
+  {
+    trimmed = key = name;
+  }
+
+  if ( trimmed.empty() || files.find( trimmed ) != files.end() )
+    return;
+
+  Location location = Missing;
+
+  if ( directoryFiles.count( key ) )
+    location = InDirectory;
+  else
+  if ( archiveFiles.count( key ) )
+    location = InArchive;
+
+  files[ trimmed ] = location;
+}
+
+bool MediaManifest::save( string const & fileName ) const
+{
+  vector< std::pair< string, Location > > sorted( files.begin(), files.end() );
+  std::sort( sorted.begin(), sorted.end(), locationLess );
+
+  FILE * f = gd_fopen( fileName.c_str(), "wb" );
+
+  if ( !f )
+    return false;
+
+  for( size_t x = 0; x < sorted.size(); ++x )
+    fprintf( f, "%s\t%s\n", locationName( sorted[ x ].second ), sorted[ x ].first.c_str() );
+
+  bool ok = !ferror( f );
+
+  return fclose( f ) == 0 && ok;
+}
+
+void MediaManifest::print( FILE * f ) const
+{
+  unsigned counts[ 3 ] = { 0, 0, 0 };
+  vector< string > missing;
+
+  for( std::unordered_map< string, Location >::const_iterator i = files.begin();
+       i != files.end(); ++i )
+  {
+    ++counts[ i->second ];
+
+    if ( i->second == Missing )
+      missing.push_back( i->first );
+  }
+
+  std::sort( missing.begin(), missing.end() );
+
+  fprintf( f, "Media: %u files, %u in the resource directory, %u in the archive, "
+              "%u missing\n", (unsigned) files.size(), counts[ InDirectory ],
+           counts[ InArchive ], counts[ Missing ] );
+
+  for( size_t x = 0; x < missing.size(); ++x )
+    fprintf( f, "  missing: %s\n", missing[ x ].c_str() );
+}
@@ -0,0 +1,64 @@
+#ifndef __MEDIAMANIFEST_HH_INCLUDED__
+#define __MEDIAMANIFEST_HH_INCLUDED__
+
+#include <stdio.h>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include "wstring.hh"
+
+class QString;
+
+/// Collects the media files the articles refer to with the [s] tags, each one
+/// once, and finds out where each one is: in the dictionary's resource
+/// directory (dictionary.dsl.files), in its resource archive
+/// (dictionary.dsl.files.zip), or nowhere. Both are indexed when the manifest
+/// is made, the archive by its central directory, so each file is looked up
+/// in a hash table, and the archive is never read again. The names are
+/// matched ignoring their case and the kind of their slashes, as they would
+/// be on Windows, where most of the dictionaries are made.
+class MediaManifest
+{
+public:
+
+  enum Location
+  {
+    Missing,
+    InDirectory,
+    InArchive
+  };
+
+  /// Indexes the resources of the given dictionary, which is named in the
+  /// file system encoding.
+  explicit MediaManifest( std::string const & dslName );
+
+  /// Adds the file with the given UTF-8 name, unless it's there already. The
+  /// whitespace around the name is dropped.
+  void add( std::string const & name );
+
+  /// Writes the files, sorted by name, one per line: where the file is (dir,
+  /// zip or missing), a tab and its name. Returns false if it can't be
+  /// written.
+  bool save( std::string const & fileName ) const;
+
+  /// Prints how many files are where, and lists the missing ones.
+  void print( FILE * ) const;
+
+private:
+
+  /// The keys of the files found in the directory and in the archive
+  std::unordered_set< std::string > directoryFiles, archiveFiles;
+
+  std::unordered_map< std::string, Location > files;
+
+  /// Returns the key the name is matched by: case-folded, with forward
+  /// slashes, no leading ones and no whitespace around it.
+  static std::string keyFor( gd::wstring const & name );
+
+  void indexDirectory( QString const & name );
+
+  /// Returns false if the archive's central directory can't be read.
+  bool indexArchive( QString const & name );
+};
+
+#endif
@@ -0,0 +1,175 @@
+#include "rendercache.hh"
+#include "fsencoding.hh"
+#include "gddebug.hh"
+
+#include <QCoreApplication>
+
+#include <string.h>
+
+namespace {
+
+enum
+{
+  Signature = 0x52475444, // DTGR on little-endian machines
+  CurrentFormatVersion = 1
+};
+
+// The file is the signature and the version, followed by the records. Each
+// record is the two key hashes, the 32-bit size and the html itself
+
+size_t const HeaderSize = sizeof( uint32_t ) * 2;
+size_t const RecordHeaderSize = sizeof( uint64_t ) * 2 + sizeof( uint32_t );
+
+}
+
+RenderCache::Hasher & RenderCache::Hasher::add( void const * data, size_t size )
+{
+  unsigned char const * ptr = (unsigned char const *) data;
+
+  for( size_t x = 0; x < size; ++x )
+  {
+    h1 ^= ptr[ x ];
+    h1 *= 1099511628211ULL;
+    h2 = ( h2 << 5 ) + h2 + ptr[ x ] + ( h2 >> 41 );
+  }
+
+  return *this;
+}
+
+RenderCache::RenderCache( std::string const & fileName_ ):
+  fileName( FsEncoding::decode( fileName_.c_str() ) ),
+  // Several processes, e.g. the shards of a plan, may be using the same
+  // cache, so each one writes its own new file
+  newFileName( fileName + QString( ".%1.tmp" ).arg( QCoreApplication::applicationPid() ) ),
+  oldFile( fileName ), newFile( newFileName ),
+  oldData( 0 ), writeFailed( false ), committed( false ),
+  hits( 0 ), misses( 0 ), uncacheable( 0 ),
+  renderedCount( 0 ), renderedSeconds( 0 )
+{
+  if ( oldFile.open( QIODevice::ReadOnly ) )
+  {
+    qint64 size = oldFile.size();
+
+    if ( size >= (qint64) HeaderSize )
+      oldData = oldFile.map( 0, size );
+
+    uint32_t header[ 2 ];
+
+    if ( oldData )
+      memcpy( header, oldData, sizeof( header ) );
+
+    if ( oldData && header[ 0 ] == Signature && header[ 1 ] == CurrentFormatVersion )
+    {
+      for( uint64_t offset = HeaderSize; size - offset >= RecordHeaderSize; )
+      {
+        Key key;
+        Location location;
+
+        memcpy( &key.h1, oldData + offset, sizeof( key.h1 ) );
+        memcpy( &key.h2, oldData + offset + sizeof( key.h1 ), sizeof( key.h2 ) );
+        memcpy( &location.size, oldData + offset + sizeof( key.h1 ) * 2,
+                sizeof( location.size ) );
+
+        location.offset = offset + RecordHeaderSize;
+
+        if ( size - location.offset < location.size )
+          break; // Truncated
+
+        oldEntries[ key ] = location;
+        offset = location.offset + location.size;
+      }
+    }
+    else
+      oldData = 0;
+  }
+
+  if ( newFile.open( QIODevice::WriteOnly | QIODevice::Truncate ) )
+  {
+    uint32_t header[ 2 ] = { Signature, CurrentFormatVersion };
+    writeFailed = newFile.write( (char const *) header, sizeof( header ) ) != sizeof( header );
+  }
+  else
+    writeFailed = true;
+
+  if ( writeFailed )
+    gdWarning( "Warning: can't write render cache file %s\n", fileName_.c_str() );
+}
+
+RenderCache::~RenderCache()
+{
+  if ( !committed )
+  {
+    newFile.close();
+    QFile::remove( newFileName );
+  }
+}
+
+bool RenderCache::get( Key const & key, std::string & html )
+{
+  std::unordered_map< Key, Location, KeyHash >::const_iterator i = oldEntries.find( key );
+
+  if ( i == oldEntries.end() )
+  {
+    ++misses;
+    return false;
+  }
+
+  ++hits;
+
+  html.assign( (char const *) oldData + i->second.offset, i->second.size );
+
+  // Carry it over to the new cache, since it's still in use
+  write( key, html.data(), html.size() );
+
+  return true;
+}
+
+void RenderCache::put( Key const & key, std::string const & html, double renderSeconds )
+{
+  ++renderedCount;
+  renderedSeconds += renderSeconds;
+
+  write( key, html.data(), html.size() );
+}
+
+bool RenderCache::write( Key const & key, char const * html, uint32_t size )
+{
+  if ( writeFailed )
+    return false;
+
+  char header[ RecordHeaderSize ];
+
+  memcpy( header, &key.h1, sizeof( key.h1 ) );
+  memcpy( header + sizeof( key.h1 ), &key.h2, sizeof( key.h2 ) );
+  memcpy( header + sizeof( key.h1 ) * 2, &size, sizeof( size ) );
+
+  writeFailed = newFile.write( header, sizeof( header ) ) != sizeof( header )
+                || newFile.write( html, size ) != size;
+
+  return !writeFailed;
+}
+
+bool RenderCache::commit()
+{
+  newFile.close();
+
+  if ( writeFailed )
+    return false;
+
+  oldFile.close();
+  oldData = 0;
+  oldEntries.clear();
+
+  QFile::remove( fileName );
+  committed = QFile::rename( newFileName, fileName );
+
+  return committed;
+}
+
+double RenderCache::getSecondsSaved() const
+{
+  if ( !renderedCount )
+    return 0;
+
+  return hits * ( renderedSeconds / renderedCount );
+}
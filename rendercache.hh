@@ -0,0 +1,113 @@
+#ifndef __RENDERCACHE_HH_INCLUDED__
+#define __RENDERCACHE_HH_INCLUDED__
+
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+
+#include <QFile>
+
+/// An on-disk cache of the rendered articles, addressed by a hash of
+/// everything the rendering depends on. When an updated dictionary gets
+/// reconverted, the articles which haven't changed are taken from there.
+/// The cache is a single file. Each run writes a new one, holding only the
+/// articles of that run, so the stale ones don't pile up.
+class RenderCache
+{
+public:
+
+  struct Key
+  {
+    uint64_t h1, h2;
+
+    bool operator == ( Key const & other ) const
+    { return h1 == other.h1 && h2 == other.h2; }
+  };
+
+  /// Makes the key out of any data given. Two different hashes are combined
+  /// to make the collisions practically impossible.
+  class Hasher
+  {
+    uint64_t h1, h2;
+
+  public:
+
+    Hasher(): h1( 14695981039346656037ULL ), h2( 5381 )
+    {}
+
+    Hasher & add( void const * data, size_t size );
+
+    Hasher & add( std::string const & str )
+    { return add( (uint32_t) str.size() ).add( str.data(), str.size() ); }
+
+    Hasher & add( uint32_t value )
+    { return add( &value, sizeof( value ) ); }
+
+    Key result() const
+    { Key key = { h1, h2 }; return key; }
+  };
+
+  /// Opens the cache with the given file name. A missing or broken file makes
+  /// for an empty cache.
+  explicit RenderCache( std::string const & fileName );
+
+  /// Discards the new cache file unless it was committed.
+  ~RenderCache();
+
+  /// Looks the article up, counting a hit or a miss.
+  bool get( Key const &, std::string & html );
+
+  /// Stores the article rendered after a miss. The time it took to render it
+  /// is used to estimate the time saved by the hits.
+  void put( Key const &, std::string const & html, double renderSeconds );
+
+  /// Counts an article which can't be cached.
+  void skip()
+  { ++uncacheable; }
+
+  /// Replaces the old cache file with the new one.
+  bool commit();
+
+  unsigned getHits() const
+  { return hits; }
+
+  unsigned getMisses() const
+  { return misses; }
+
+  unsigned getUncacheable() const
+  { return uncacheable; }
+
+  /// Estimated from the average time it took to render the misses.
+  double getSecondsSaved() const;
+
+private:
+
+  struct KeyHash
+  {
+    size_t operator () ( Key const & key ) const
+    { return (size_t) key.h1; }
+  };
+
+  struct Location
+  {
+    uint64_t offset;
+    uint32_t size;
+  };
+
+  RenderCache( RenderCache const & );
+  void operator = ( RenderCache const & );
+
+  bool write( Key const &, char const * html, uint32_t size );
+
+  QString fileName, newFileName;
+  QFile oldFile, newFile;
+  uchar const * oldData;
+  std::unordered_map< Key, Location, KeyHash > oldEntries;
+  bool writeFailed, committed;
+
+  unsigned hits, misses, uncacheable;
+  unsigned renderedCount;
+  double renderedSeconds;
+};
+
+#endif
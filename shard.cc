@@ -0,0 +1,263 @@
+#include "shard.hh"
+#include "ufile.hh"
+
+#include <stdlib.h>
+#include <string.h>
+
+namespace Shard {
+
+namespace {
+
+char const Signature[] = "DslToGls shard plan 2";
+
+/// Reads a line without the newline. Returns false at the end of file.
+bool readLine( FILE * f, string & line )
+{
+  line.clear();
+
+  for( int c; ( c = fgetc( f ) ) != EOF; )
+  {
+    if ( c == '\n' )
+      return true;
+    line.push_back( c );
+  }
+
+  return !line.empty();
+}
+
+/// Reads a "name: value" line with the given name.
+bool readField( FILE * f, char const * name, string & value )
+{
+  string line;
+  size_t n = strlen( name );
+
+  if ( !readLine( f, line ) || line.compare( 0, n, name ) != 0 ||
+       line.compare( n, 2, ": " ) != 0 )
+    return false;
+
+  value = line.substr( n + 2 );
+  return true;
+}
+
+bool readNumber( FILE * f, char const * name, uint64_t & value )
+{
+  string str;
+  char * end;
+
+  if ( !readField( f, name, str ) || str.empty() )
+    return false;
+
+  value = strtoull( str.c_str(), &end, 10 );
+
+  return *end == 0;
+}
+
+void writeStamp( FILE * f, char const * name, DslIndex::FileStamp const & stamp )
+{
+  fprintf( f, "%s: %llu %lld %llu\n", name, (unsigned long long) stamp.size,
+           (long long) stamp.mtime, (unsigned long long) stamp.hash );
+}
+
+bool readStamp( FILE * f, char const * name, DslIndex::FileStamp & stamp )
+{
+  string str;
+  unsigned long long size, hash;
+  long long mtime;
+  int used = 0;
+
+  if ( !readField( f, name, str ) ||
+       sscanf( str.c_str(), "%llu %lld %llu%n", &size, &mtime, &hash, &used ) != 3 ||
+       str[ used ] )
+    return false;
+
+  stamp.size = size;
+  stamp.mtime = mtime;
+  stamp.hash = hash;
+
+  return true;
+}
+
+}
+
+vector< Range > split( QVector< DslCard > const & cards, unsigned count )
+{
+  vector< Range > result;
+
+  uint64_t total = 0;
+  for( int x = 0; x < cards.size(); ++x )
+    total += cards[ x ].size;
+
+  uint64_t done = 0;
+  int begin = 0;
+
+  for( unsigned shard = 1; shard <= count; ++shard )
+  {
+    uint64_t target = total * shard / count;
+    int end = begin;
+
+    if ( shard == count )
+      end = cards.size();
+    else
+      for( ; end < cards.size() && done < target; ++end )
+        done += cards[ end ].size;
+
+    Range range = { begin, end };
+    result.push_back( range );
+
+    begin = end;
+  }
+
+  return result;
+}
+
+bool save( FILE * f, Plan const & plan )
+{
+  fprintf( f, "%s\n", Signature );
+  fprintf( f, "dictionary: %s\n", plan.dslName.c_str() );
+  fprintf( f, "abbreviations: %s\n", plan.abrvName.c_str() );
+  writeStamp( f, "dictionary-stamp", plan.dslStamp );
+  writeStamp( f, "abbreviations-stamp", plan.abrvStamp );
+  fprintf( f, "max-variants: %u\n", plan.optionalPartsLimit );
+  fprintf( f, "cards: %d\n", plan.cardCount );
+  fprintf( f, "shards: %u\n", (unsigned) plan.shards.size() );
+
+  for( size_t x = 0; x < plan.shards.size(); ++x )
+    fprintf( f, "%d %d\n", plan.shards[ x ].begin, plan.shards[ x ].end );
+
+  fprintf( f, "header: %u\n", (unsigned) plan.header.size() );
+
+  return fwrite( plan.header.data(), 1, plan.header.size(), f ) == plan.header.size()
+         && fflush( f ) == 0 && !ferror( f );
+}
+
+bool load( string const & planName, Plan & plan, string & error )
+{
+  FILE * f = gd_fopen( planName.c_str(), "rb" );
+
+  if ( !f )
+  {
+    error = "can't open " + planName;
+    return false;
+  }
+
+  string line;
+  uint64_t optionalPartsLimit = 0, cardCount = 0, shardCount = 0,
+           headerSize = 0;
+
+  bool ok = readLine( f, line ) && line == Signature &&
+            readField( f, "dictionary", plan.dslName ) &&
+            readField( f, "abbreviations", plan.abrvName ) &&
+            readStamp( f, "dictionary-stamp", plan.dslStamp ) &&
+            readStamp( f, "abbreviations-stamp", plan.abrvStamp ) &&
+            readNumber( f, "max-variants", optionalPartsLimit ) &&
+            readNumber( f, "cards", cardCount ) &&
+            readNumber( f, "shards", shardCount );
+
+  plan.optionalPartsLimit = optionalPartsLimit;
+  plan.cardCount = cardCount;
+  plan.shards.clear();
+
+  int expectedBegin = 0;
+
+  for( uint64_t x = 0; ok && x < shardCount; ++x )
+  {
+    Range range;
+
+    ok = readLine( f, line ) &&
+         sscanf( line.c_str(), "%d %d", &range.begin, &range.end ) == 2 &&
+         range.begin == expectedBegin && range.end >= range.begin;
+
+    plan.shards.push_back( range );
+    expectedBegin = range.end;
+  }
+
+  ok = ok && expectedBegin == plan.cardCount &&
+       readNumber( f, "header", headerSize );
+
+  if ( ok )
+  {
+    plan.header.resize( headerSize );
+    ok = fread( &plan.header[ 0 ], 1, headerSize, f ) == headerSize;
+  }
+
+  fclose( f );
+
+  if ( !ok )
+    error = planName + " is not a valid shard plan";
+
+  return ok;
+}
+
+bool checkSources( Plan const & plan, string & error )
+{
+  if ( !( DslIndex::stampFor( plan.dslName ) == plan.dslStamp ) ||
+       !( DslIndex::stampFor( plan.abrvName ) == plan.abrvStamp ) )
+  {
+    error = "the dictionary has changed since the plan was made";
+    return false;
+  }
+
+  return true;
+}
+
+string shardName( string const & planName, unsigned shard )
+{
+  char buf[ 32 ];
+  snprintf( buf, sizeof( buf ), ".%u", shard );
+  return planName + buf;
+}
+
+bool merge( string const & planName, Plan const & plan, GlsWriter & writer,
+            string & error )
+{
+  writer.write( plan.header );
+
+  vector< char > buffer( 1024 * 1024 );
+  int optionalPartNom = 0;
+
+  for( unsigned shard = 0; shard < plan.shards.size(); ++shard )
+  {
+    string name = shardName( planName, shard );
+    FILE * f = gd_fopen( name.c_str(), "rb" );
+
+    if ( !f )
+    {
+      error = "can't open " + name + ", was the shard converted?";
+      return false;
+    }
+
+    for( size_t size; ( size = fread( &buffer.front(), 1, buffer.size(), f ) ); )
+    {
+      char const * ptr = &buffer.front();
+      char const * end = ptr + size;
+
+      // The marker is a single byte, so it can't be split between the reads
+      for( char const * marker;
+           ( marker = (char const *) memchr( ptr, DslDictionary::OptionalPartMarker,
+                                             end - ptr ) ); ptr = marker + 1 )
+      {
+        char number[ 16 ];
+
+        writer.write( ptr, marker - ptr );
+        writer.write( number, snprintf( number, sizeof( number ), "%d",
+                                        optionalPartNom++ ) );
+      }
+
+      writer.write( ptr, end - ptr );
+    }
+
+    bool failed = ferror( f );
+
+    fclose( f );
+
+    if ( failed )
+    {
+      error = "can't read " + name;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}
@@ -0,0 +1,67 @@
+#ifndef __SHARD_HH_INCLUDED__
+#define __SHARD_HH_INCLUDED__
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <QVector>
+
+#include "dsl.hh"
+#include "dslindex.hh"
+#include "glswriter.hh"
+
+/// Splitting the conversion of a large dictionary between several processes,
+/// which may run on different machines sharing the file system. The plan
+/// gives each shard a range of cards with about the same amount of article
+/// text. The shards are converted separately, with the optional parts' ids
+/// left unnumbered, and then merged into the same file a single conversion
+/// would produce.
+namespace Shard {
+
+using std::string;
+using std::vector;
+
+struct Range
+{
+  int begin, end;
+};
+
+struct Plan
+{
+  string dslName, abrvName;
+  /// The dictionary and its abbreviations as they were when the plan was
+  /// made, stamped the same way as for the index
+  DslIndex::FileStamp dslStamp, abrvStamp;
+  unsigned optionalPartsLimit;
+  int cardCount;
+  /// The GLS header, which goes before the articles of the first shard
+  string header;
+  vector< Range > shards;
+};
+
+/// Splits the cards into the given number of ranges of about the same total
+/// size of the articles.
+vector< Range > split( QVector< DslCard > const & cards, unsigned count );
+
+bool save( FILE *, Plan const & );
+
+/// Loads the plan. Returns false and sets the error if it can't be read.
+bool load( string const & planName, Plan &, string & error );
+
+/// Returns false and sets the error if the dictionary or its abbreviations
+/// have changed since the plan was made, so its card ranges are no good.
+bool checkSources( Plan const &, string & error );
+
+/// Returns the name of the output file of the given shard. The shards are
+/// kept next to the plan.
+string shardName( string const & planName, unsigned shard );
+
+/// Writes the outputs of all the shards after the header, numbering the
+/// optional parts' ids. Returns false and sets the error if a shard is missing
+/// or can't be read.
+bool merge( string const & planName, Plan const &, GlsWriter &, string & error );
+
+}
+
+#endif
@@ -0,0 +1,46 @@
+#include "slowest.hh"
+
+#include <algorithm>
+
+namespace {
+
+/// Puts the fastest article on top of the heap
+bool slower( SlowestArticles::Entry const & a, SlowestArticles::Entry const & b )
+{
+  return a.seconds > b.seconds;
+}
+
+}
+
+void SlowestArticles::add( Entry const & entry )
+{
+  if ( !isSlowEnough( entry.seconds ) )
+    return;
+
+  if ( heap.size() == count )
+  {
+    std::pop_heap( heap.begin(), heap.end(), slower );
+    heap.pop_back();
+  }
+
+  heap.push_back( entry );
+  std::push_heap( heap.begin(), heap.end(), slower );
+}
+
+void SlowestArticles::print( FILE * f ) const
+{
+  std::vector< Entry > sorted( heap );
+  std::sort( sorted.begin(), sorted.end(), slower );
+
+  fprintf( f, "Slowest articles:\n"
+              "  total ms   parse ms  render ms     offset       size  bytes out  headword\n" );
+
+  for( size_t x = 0; x < sorted.size(); ++x )
+  {
+    Entry const & e = sorted[ x ];
+
+    fprintf( f, "%9.3f  %9.3f  %9.3f  %9llu  %9u  %9llu  %s\n", e.seconds * 1000,
+             e.parseSeconds * 1000, e.renderSeconds * 1000, (unsigned long long) e.offset,
+             e.size, (unsigned long long) e.outputBytes, e.headword.c_str() );
+  }
+}
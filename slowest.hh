@@ -0,0 +1,45 @@
+#ifndef __SLOWEST_HH_INCLUDED__
+#define __SLOWEST_HH_INCLUDED__
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/// Keeps the given number of the slowest articles seen, to find the
+/// malformed or enormous ones which take most of the conversion time. The
+/// articles are kept in a min-heap by their time, so each one added costs
+/// at most a logarithm of the count.
+class SlowestArticles
+{
+public:
+
+  struct Entry
+  {
+    std::string headword;
+    uint64_t offset;
+    uint32_t size;
+    double seconds, parseSeconds, renderSeconds;
+    uint64_t outputBytes;
+  };
+
+  explicit SlowestArticles( unsigned count_ ): count( count_ )
+  {}
+
+  /// Returns true if an article taking that long would be kept, so the entry
+  /// only has to be made for those.
+  bool isSlowEnough( double seconds ) const
+  { return count && ( heap.size() < count || seconds > heap.front().seconds ); }
+
+  void add( Entry const & );
+
+  /// Prints the articles, the slowest first.
+  void print( FILE * ) const;
+
+private:
+
+  unsigned count;
+  std::vector< Entry > heap;
+};
+
+#endif
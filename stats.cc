@@ -0,0 +1,98 @@
+#include "stats.hh"
+
+#include <string.h>
+#include <mutex>
+#include <vector>
+
+namespace Stats {
+
+bool enabled = false;
+
+namespace {
+
+char const * const CounterNames[ CounterCount ] =
+{
+  "input_bytes", "article_bytes", "output_bytes", "cards", "headword_variants",
+  "chunk_cache_hits", "chunk_cache_misses"
+};
+
+char const * const PhaseNames[ PhaseCount ] =
+{
+  "indexing", "loading", "reading", "parsing", "rendering", "writing",
+  "waiting_for_writer"
+};
+
+std::chrono::steady_clock::time_point startTime;
+
+// The slots are never freed, so the counts of the threads which have
+// finished are still there for the report
+std::mutex slotsMutex;
+std::vector< Slot * > slots;
+
+thread_local Slot * localSlot = 0;
+
+}
+
+Slot & local()
+{
+  if ( !localSlot )
+  {
+    localSlot = new Slot;
+    memset( localSlot, 0, sizeof( Slot ) );
+
+    std::lock_guard< std::mutex > guard( slotsMutex );
+    slots.push_back( localSlot );
+  }
+
+  return *localSlot;
+}
+
+void enable()
+{
+  startTime = std::chrono::steady_clock::now();
+  enabled = true;
+}
+
+void print( FILE * f )
+{
+  Slot total;
+  memset( &total, 0, sizeof( total ) );
+
+  {
+    std::lock_guard< std::mutex > guard( slotsMutex );
+
+    for( size_t x = 0; x < slots.size(); ++x )
+      for( int y = 0; y < CounterCount; ++y )
+        total.counters[ y ] += slots[ x ]->counters[ y ];
+
+    for( size_t x = 0; x < slots.size(); ++x )
+      for( int y = 0; y < PhaseCount; ++y )
+      {
+        total.nanoseconds[ y ] += slots[ x ]->nanoseconds[ y ];
+        total.calls[ y ] += slots[ x ]->calls[ y ];
+      }
+  }
+
+  double wallSeconds = std::chrono::duration< double >( std::chrono::steady_clock::now()
+                                                        - startTime ).count();
+
+  fprintf( f, "{\n  \"wall_seconds\": %.6f,\n", wallSeconds );
+
+  for( int x = 0; x < CounterCount; ++x )
+    fprintf( f, "  \"%s\": %llu,\n", CounterNames[ x ],
+             (unsigned long long) total.counters[ x ] );
+
+  fprintf( f, "  \"phases\": {\n" );
+
+  // The times of the phases run on several threads at once are summed up,
+  // so they may add up to more than the wall time
+  for( int x = 0; x < PhaseCount; ++x )
+    fprintf( f, "    \"%s\": { \"seconds\": %.6f, \"calls\": %llu }%s\n", PhaseNames[ x ],
+             total.nanoseconds[ x ] / 1e9, (unsigned long long) total.calls[ x ],
+             x + 1 < PhaseCount ? "," : "" );
+
+  fprintf( f, "  }\n}\n" );
+  fflush( f );
+}
+
+}
@@ -0,0 +1,106 @@
+#ifndef __STATS_HH_INCLUDED__
+#define __STATS_HH_INCLUDED__
+
+#include <stdio.h>
+#include <stdint.h>
+#include <chrono>
+
+/// The counters and the phase timers of the conversion, reported by --stats.
+/// Each thread adds to its own set, so the hot paths take no locks; the sets
+/// are summed up for the report. Nothing is counted or timed until enable()
+/// is called, which must be done before any work starts.
+namespace Stats {
+
+enum Counter
+{
+  InputBytes, // The dictionaries' files, as they are on disk
+  ArticleBytes, // Read by dict_data_read_(), after inflating
+  OutputBytes, // Written to the output files, after compressing
+  Cards,
+  HeadwordVariants,
+  ChunkCacheHits, // The dictzip chunks found inflated already
+  ChunkCacheMisses,
+  CounterCount
+};
+
+/// The phases may nest: Reading is a part of Loading, Parsing and Rendering
+/// are parts of the rendering done for each article, and WaitingForWriter is
+/// a part of Writing.
+enum Phase
+{
+  Indexing, // DslDictionary::setFiles()
+  Loading, // DslDictionary::loadArticle()
+  Reading, // dict_data_read_()
+  Parsing, // Building the ArticleDom in dslToHtml()
+  Rendering, // Rendering the ArticleDom in dslToHtml()
+  Writing, // Passing the articles to the GlsWriter
+  WaitingForWriter, // GlsWriter::handOff() waiting for the writer thread
+  PhaseCount
+};
+
+/// A set of the counters and the timers of one thread
+struct Slot
+{
+  uint64_t counters[ CounterCount ];
+  uint64_t nanoseconds[ PhaseCount ];
+  uint64_t calls[ PhaseCount ];
+};
+
+extern bool enabled;
+
+/// Returns this thread's slot, allocating it on the first use.
+Slot & local();
+
+/// Starts counting. The wall time is reported since this call.
+void enable();
+
+inline bool isEnabled()
+{ return enabled; }
+
+inline void add( Counter counter, uint64_t value = 1 )
+{
+  if ( enabled )
+    local().counters[ counter ] += value;
+}
+
+/// Adds the time from its construction to its destruction to the phase.
+class Timer
+{
+  Phase phase;
+  bool running;
+  std::chrono::steady_clock::time_point start;
+
+public:
+
+  explicit Timer( Phase phase_ ): phase( phase_ ), running( enabled )
+  {
+    if ( running )
+      start = std::chrono::steady_clock::now();
+  }
+
+  ~Timer()
+  { stop(); }
+
+  /// Adds the time so far, and stops the timer.
+  void stop()
+  {
+    if ( !running )
+      return;
+
+    running = false;
+
+    Slot & slot = local();
+
+    slot.nanoseconds[ phase ] += std::chrono::duration_cast< std::chrono::nanoseconds >(
+      std::chrono::steady_clock::now() - start ).count();
+    ++slot.calls[ phase ];
+  }
+};
+
+/// Writes the totals of all the threads as JSON. Must be called once all the
+/// threads doing the work are finished.
+void print( FILE * );
+
+}
+
+#endif
@@ -2,157 +2,533 @@
  * Part of GoldenDict. Licensed under GPLv3 or later, see the LICENSE file */
 
 #include "utf8.hh"
-#include <vector>
+
+// The vector versions are built where the compiler can have them. With gcc
+// and clang the AVX2 one is compiled for that instruction set alone, and is
+// only used if the processor turns out to have it.
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) ) && defined( __SSE2__ )
+#define UTF8_SSE2
+#define UTF8_AVX2
+#include <immintrin.h>
+#elif defined( _MSC_VER ) && ( defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 ) )
+#define UTF8_SSE2
+#include <emmintrin.h>
+#endif
+
+// The helpers of the vector versions must be inlined into them, so the
+// pointers stay in registers, and the SSE2 code gets the AVX2 encoding when
+// used by the AVX2 versions
+#if defined( __GNUC__ )
+#define UTF8_INLINE inline __attribute__(( always_inline ))
+#elif defined( _MSC_VER )
+#define UTF8_INLINE __forceinline
+#else
+#define UTF8_INLINE inline
+#endif
 
 namespace Utf8 {
 
-size_t encode( wchar const * in, size_t inSize, char * out_ )
+namespace {
+
+/// Encodes one character, returning the end of the output
+UTF8_INLINE unsigned char * encodeChar( wchar in, unsigned char * out )
+{
+  if ( in < 0x80 )
+    *out++ = in;
+  else
+  if ( in < 0x800 )
+  {
+    *out++ = 0xC0 | ( in >> 6 );
+    *out++ = 0x80 | ( in & 0x3F );
+  }
+  else
+  if ( in < 0x10000 )
+  {
+    *out++ = 0xE0 | ( in >> 12 );
+    *out++ = 0x80 | ( ( in >> 6 ) & 0x3F );
+    *out++ = 0x80 | ( in & 0x3F );
+  }
+  else
+  {
+    *out++ = 0xF0 | ( in >> 18 );
+    *out++ = 0x80 | ( ( in >> 12 ) & 0x3F );
+    *out++ = 0x80 | ( ( in >> 6 ) & 0x3F );
+    *out++ = 0x80 | ( in & 0x3F );
+  }
+
+  return out;
+}
+
+/// Decodes one character, advancing the input past it. Returns false if the
+/// UTF-8 is invalid.
+UTF8_INLINE bool decodeChar( unsigned char const * & in, unsigned char const * end,
+                        wchar & result )
+{
+  if ( *in < 0x80 )
+  {
+    // One-byte encoding
+    result = *in++;
+    return true;
+  }
+
+  if ( *in < 0xC0 )
+    // This char is from the middle of encoding, it can't be leading
+    return false;
+
+  if ( *in < 0xE0 )
+  {
+    // Two-byte sequence
+    if ( end - in < 2 || ( in[ 1 ] & 0xC0 ) != 0x80 )
+      return false;
+
+    result = ( (wchar) in[ 0 ] & 0x1F ) << 6 | ( (wchar) in[ 1 ] & 0x3F );
+    in += 2;
+    return true;
+  }
+
+  if ( *in < 0xF0 )
+  {
+    // Three-byte sequence
+    if ( end - in < 3 || ( in[ 1 ] & 0xC0 ) != 0x80 || ( in[ 2 ] & 0xC0 ) != 0x80 )
+      return false;
+
+    result = ( (wchar) in[ 0 ] & 0xF ) << 12 | ( (wchar) in[ 1 ] & 0x3F ) << 6 |
+             ( (wchar) in[ 2 ] & 0x3F );
+    in += 3;
+    return true;
+  }
+
+  if ( *in < 0xF8 )
+  {
+    // Four-byte sequence
+    if ( end - in < 4 || ( in[ 1 ] & 0xC0 ) != 0x80 || ( in[ 2 ] & 0xC0 ) != 0x80 ||
+         ( in[ 3 ] & 0xC0 ) != 0x80 )
+      return false;
+
+    result = ( (wchar) in[ 0 ] & 7 ) << 18 | ( (wchar) in[ 1 ] & 0x3F ) << 12 |
+             ( (wchar) in[ 2 ] & 0x3F ) << 6 | ( (wchar) in[ 3 ] & 0x3F );
+    in += 4;
+    return true;
+  }
+
+  // This can't be
+  return false;
+}
+
+// Where there are no vector versions, and to check them against
+
+size_t encodeScalar( wchar const * in, size_t inSize, char * out_ )
 {
   unsigned char * out = (unsigned char *) out_;
 
-  while( inSize-- )
+  for( wchar const * end = in + inSize; in != end; ++in )
+    out = encodeChar( *in, out );
+
+  return out - (unsigned char *) out_;
+}
+
+long decodeScalar( char const * in_, size_t inSize, wchar * out_ )
+{
+  unsigned char const * in = (unsigned char const *) in_, * end = in + inSize;
+  wchar * out = out_;
+
+  while( in != end )
+    if ( !decodeChar( in, end, *out++ ) )
+      return -1;
+
+  return out - out_;
+}
+
+// The vector versions convert a whole block of the input at a time, as if
+// it all were ASCII, and then keep what was ASCII before the first character
+// which wasn't. The characters from there on are done one by one till the
+// next ASCII one, and the next block starts from it. When a block has little
+// ASCII at its start, the text is taken to be mostly not ASCII, and a few
+// blocks' worth is done one by one without checking. The blocks may overlap
+// the output's end by what the characters not yet converted would take, but
+// never go past the end of the output, since each character takes at least
+// as much as it does in the block. What remains after the last block is done
+// one character at a time as well.
+
+#ifdef UTF8_SSE2
+
+static_assert( sizeof( wchar ) == 4, "The vector code needs 32-bit characters" );
+
+enum
+{
+  BlockSize = 16,
+  /// Below this much ASCII at a block's start, the text is done one by one
+  MinAsciiPrefix = BlockSize / 4,
+  /// How much is done one by one then
+  UncheckedRun = BlockSize * 4
+};
+
+UTF8_INLINE unsigned firstSetBit( unsigned mask )
+{
+#ifdef _MSC_VER
+  unsigned long index;
+  _BitScanForward( &index, mask );
+  return index;
+#else
+  return __builtin_ctz( mask );
+#endif
+}
+
+/// Encodes a block, or the part of the input from it on which is done one
+/// by one. There must be a whole block of the input left.
+UTF8_INLINE void encodeBlock( wchar const * & in, wchar const * end, unsigned char * & out )
+{
+  __m128i const nonAscii = _mm_set1_epi32( ~0x7F );
+  __m128i const zero = _mm_setzero_si128();
+
+  __m128i a = _mm_loadu_si128( (__m128i const *) in );
+  __m128i b = _mm_loadu_si128( (__m128i const *) in + 1 );
+  __m128i c = _mm_loadu_si128( (__m128i const *) in + 2 );
+  __m128i d = _mm_loadu_si128( (__m128i const *) in + 3 );
+
+  // A bit for each character which is ASCII
+  unsigned ascii = _mm_movemask_epi8(
+    _mm_packs_epi16(
+      _mm_packs_epi32( _mm_cmpeq_epi32( _mm_and_si128( a, nonAscii ), zero ),
+                       _mm_cmpeq_epi32( _mm_and_si128( b, nonAscii ), zero ) ),
+      _mm_packs_epi32( _mm_cmpeq_epi32( _mm_and_si128( c, nonAscii ), zero ),
+                       _mm_cmpeq_epi32( _mm_and_si128( d, nonAscii ), zero ) ) ) );
+
+  // The ASCII characters are packed right, the others are cut off
+  _mm_storeu_si128( (__m128i *) out,
+                    _mm_packus_epi16( _mm_packs_epi32( a, b ), _mm_packs_epi32( c, d ) ) );
+
+  if ( ascii == 0xFFFF )
   {
-    if ( *in < 0x80 )
-      *out++ = *in++;
-    else
-    if ( *in < 0x800 )
-    {
-      *out++ = 0xC0 | ( *in >> 6 );
-      *out++ = 0x80 | ( *in++ & 0x3F );
-    }
-    else
-    if ( *in < 0x10000 )
-    {
-      *out++ = 0xE0 | ( *in >> 12 );
-      *out++ = 0x80 | ( ( *in >> 6 ) & 0x3F );
-      *out++ = 0x80 | ( *in++ & 0x3F );
-    }
-    else
+    in += BlockSize;
+    out += BlockSize;
+    return;
+  }
+
+  unsigned prefix = firstSetBit( ~ascii );
+
+  in += prefix;
+  out += prefix;
+
+  if ( prefix < MinAsciiPrefix )
+  {
+    wchar const * stop = end - in > UncheckedRun ? in + UncheckedRun : end;
+
+    do
+      out = encodeChar( *in++, out );
+    while( in != stop );
+  }
+  else
+  {
+    do
+      out = encodeChar( *in++, out );
+    while( in != end && !( *in < 0x80 ) );
+  }
+}
+
+/// Decodes a block, or the part of the input from it on which isn't ASCII.
+/// There must be a whole block of the input left. Returns false if the UTF-8
+/// is invalid.
+UTF8_INLINE bool decodeBlock( unsigned char const * & in, unsigned char const * end, wchar * & out )
+{
+  __m128i const zero = _mm_setzero_si128();
+
+  __m128i v = _mm_loadu_si128( (__m128i const *) in );
+
+  __m128i low = _mm_unpacklo_epi8( v, zero );
+  __m128i high = _mm_unpackhi_epi8( v, zero );
+
+  _mm_storeu_si128( (__m128i *) out, _mm_unpacklo_epi16( low, zero ) );
+  _mm_storeu_si128( (__m128i *) out + 1, _mm_unpackhi_epi16( low, zero ) );
+  _mm_storeu_si128( (__m128i *) out + 2, _mm_unpacklo_epi16( high, zero ) );
+  _mm_storeu_si128( (__m128i *) out + 3, _mm_unpackhi_epi16( high, zero ) );
+
+  // A bit for each byte which isn't ASCII
+  unsigned nonAscii = _mm_movemask_epi8( v );
+
+  if ( !nonAscii )
+  {
+    in += BlockSize;
+    out += BlockSize;
+    return true;
+  }
+
+  unsigned prefix = firstSetBit( nonAscii );
+
+  in += prefix;
+  out += prefix;
+
+  do
+    if ( !decodeChar( in, end, *out++ ) )
+      return false;
+  while( in != end && *in >= 0x80 );
+
+  return true;
+}
+
+size_t encodeSse2( wchar const * in, size_t inSize, char * out_ )
+{
+  unsigned char * out = (unsigned char *) out_;
+  wchar const * end = in + inSize;
+
+  while( end - in >= BlockSize )
+    encodeBlock( in, end, out );
+
+  for( ; in != end; ++in )
+    out = encodeChar( *in, out );
+
+  return out - (unsigned char *) out_;
+}
+
+long decodeSse2( char const * in_, size_t inSize, wchar * out_ )
+{
+  unsigned char const * in = (unsigned char const *) in_, * end = in + inSize;
+  wchar * out = out_;
+
+  while( end - in >= BlockSize )
+    if ( !decodeBlock( in, end, out ) )
+      return -1;
+
+  while( in != end )
+    if ( !decodeChar( in, end, *out++ ) )
+      return -1;
+
+  return out - out_;
+}
+
+#endif
+
+#ifdef UTF8_AVX2
+
+// The AVX2 versions only pass twice as much ASCII at a time. The blocks which
+// aren't all ASCII are done by the SSE2 code, as the wider ones would leave
+// more to be done one by one.
+
+__attribute__(( target( "avx2" ) ))
+size_t encodeAvx2( wchar const * in, size_t inSize, char * out_ )
+{
+  unsigned char * out = (unsigned char *) out_;
+  wchar const * end = in + inSize;
+  __m256i const nonAscii = _mm256_set1_epi32( ~0x7F );
+  // The packs work within the 128-bit halves, this puts the quarters back
+  // in order
+  __m256i const order = _mm256_setr_epi32( 0, 4, 1, 5, 2, 6, 3, 7 );
+
+  while( end - in >= BlockSize * 2 )
+  {
+    __m256i a = _mm256_loadu_si256( (__m256i const *) in );
+    __m256i b = _mm256_loadu_si256( (__m256i const *) in + 1 );
+    __m256i c = _mm256_loadu_si256( (__m256i const *) in + 2 );
+    __m256i d = _mm256_loadu_si256( (__m256i const *) in + 3 );
+
+    if ( !_mm256_testz_si256( _mm256_or_si256( _mm256_or_si256( a, b ),
+                                               _mm256_or_si256( c, d ) ), nonAscii ) )
     {
-      *out++ = 0xF0 | ( *in >> 18 );
-      *out++ = 0x80 | ( ( *in >> 12 ) & 0x3F );
-      *out++ = 0x80 | ( ( *in >> 6 ) & 0x3F );
-      *out++ = 0x80 | ( *in++ & 0x3F );
+      encodeBlock( in, end, out );
+      continue;
     }
+
+    _mm256_storeu_si256( (__m256i *) out, _mm256_permutevar8x32_epi32(
+      _mm256_packus_epi16( _mm256_packs_epi32( a, b ), _mm256_packs_epi32( c, d ) ), order ) );
+
+    in += BlockSize * 2;
+    out += BlockSize * 2;
   }
 
+  if ( end - in >= BlockSize )
+    encodeBlock( in, end, out );
+
+  for( ; in != end; ++in )
+    out = encodeChar( *in, out );
+
   return out - (unsigned char *) out_;
 }
 
-long decode( char const * in_, size_t inSize, wchar * out_ )
+__attribute__(( target( "avx2" ) ))
+long decodeAvx2( char const * in_, size_t inSize, wchar * out_ )
 {
-  unsigned char const * in = (unsigned char const *) in_;
+  unsigned char const * in = (unsigned char const *) in_, * end = in + inSize;
   wchar * out = out_;
 
-  while( inSize-- )
+  while( end - in >= BlockSize * 2 )
   {
-    wchar result;
-
-    if ( *in & 0x80 )
+    if ( _mm256_movemask_epi8( _mm256_loadu_si256( (__m256i const *) in ) ) )
     {
-      if ( *in & 0x40 )
-      {
-        if ( *in & 0x20 )
-        {
-          if ( *in & 0x10 )
-          {
-            // Four-byte sequence
-            if ( *in & 8 )
-              // This can't be
-              return -1;
-
-            if ( inSize < 3 )
-              return -1;
-
-            inSize -= 3;
-
-            result = ( (wchar )*in++ & 7 ) << 18;
-
-            if ( ( *in & 0xC0 ) != 0x80 )
-              return -1;
-            result |= ( (wchar)*in++ & 0x3F ) << 12;
-
-            if ( ( *in & 0xC0 ) != 0x80 )
-              return -1;
-            result |= ( (wchar)*in++ & 0x3F ) << 6;
-
-            if ( ( *in & 0xC0 ) != 0x80 )
-              return -1;
-            result |= (wchar)*in++ & 0x3F;
-          }
-          else
-          {
-            // Three-byte sequence
-
-            if ( inSize < 2 )
-              return -1;
-
-            inSize -= 2;
-
-            result = ( (wchar )*in++ & 0xF ) << 12;
-
-            if ( ( *in & 0xC0 ) != 0x80 )
-              return -1;
-            result |= ( (wchar)*in++ & 0x3F ) << 6;
-
-            if ( ( *in & 0xC0 ) != 0x80 )
-              return -1;
-            result |= (wchar)*in++ & 0x3F;
-          }
-        }
-        else
-        {
-          // Two-byte sequence
-          if ( !inSize )
-            return -1;
-
-          --inSize;
-
-          result = ( (wchar )*in++ & 0x1F ) << 6;
-
-          if ( ( *in & 0xC0 ) != 0x80 )
-            return -1;
-          result |= (wchar)*in++ & 0x3F;
-        }
-      }
-      else
-      {
-        // This char is from the middle of encoding, it can't be leading
+      if ( !decodeBlock( in, end, out ) )
         return -1;
-      }
+
+      continue;
     }
-    else
-      // One-byte encoding
-      result = *in++;
 
-    *out++ = result;
+    for( int x = 0; x < 4; ++x )
+      _mm256_storeu_si256( (__m256i *) out + x, _mm256_cvtepu8_epi32(
+                             _mm_loadl_epi64( (__m128i const *)( in + x * 8 ) ) ) );
+
+    in += BlockSize * 2;
+    out += BlockSize * 2;
   }
 
+  while( end - in >= BlockSize )
+    if ( !decodeBlock( in, end, out ) )
+      return -1;
+
+  while( in != end )
+    if ( !decodeChar( in, end, *out++ ) )
+      return -1;
+
   return out - out_;
 }
 
-string encode( wstring const & in ) throw()
+#endif
+
+#ifdef UTF8_AVX2
+
+typedef size_t ( * EncodeFunction )( wchar const *, size_t, char * );
+typedef long ( * DecodeFunction )( char const *, size_t, wchar * );
+
+bool haveAvx2()
 {
-  std::vector< char > buffer( in.size() * 4 );
+  __builtin_cpu_init();
+  return __builtin_cpu_supports( "avx2" );
+}
+
+#endif
 
-  return string( &buffer.front(),
-                 encode( in.data(), in.size(), &buffer.front() ) );
 }
 
-wstring decode( string const & in ) throw( exCantDecode )
+size_t encode( wchar const * in, size_t inSize, char * out )
 {
-  
-  if ( in.size() == 0 )
-    return wstring();
+#if defined( UTF8_AVX2 )
+  static EncodeFunction const function = haveAvx2() ? encodeAvx2 : encodeSse2;
+
+  return function( in, inSize, out );
+#elif defined( UTF8_SSE2 )
+  return encodeSse2( in, inSize, out );
+#else
+  return encodeScalar( in, inSize, out );
+#endif
+}
 
-  std::vector< wchar > buffer( in.size() );
+long decode( char const * in, size_t inSize, wchar * out )
+{
+#if defined( UTF8_AVX2 )
+  static DecodeFunction const function = haveAvx2() ? decodeAvx2 : decodeSse2;
+
+  return function( in, inSize, out );
+#elif defined( UTF8_SSE2 )
+  return decodeSse2( in, inSize, out );
+#else
+  return decodeScalar( in, inSize, out );
+#endif
+}
 
-  long result = decode( in.data(),  in.size(), &buffer.front() );
+bool hasVersion( Version version )
+{
+  switch( version )
+  {
+    case Scalar:
+      return true;
+#ifdef UTF8_SSE2
+    case Sse2:
+      return true;
+#endif
+#ifdef UTF8_AVX2
+    case Avx2:
+      return haveAvx2();
+#endif
+    default:
+      return false;
+  }
+}
+
+size_t encodeWith( Version version, wchar const * in, size_t inSize, char * out )
+{
+  switch( version )
+  {
+#ifdef UTF8_SSE2
+    case Sse2:
+      return encodeSse2( in, inSize, out );
+#endif
+#ifdef UTF8_AVX2
+    case Avx2:
+      return encodeAvx2( in, inSize, out );
+#endif
+    default:
+      return encodeScalar( in, inSize, out );
+  }
+}
+
+long decodeWith( Version version, char const * in, size_t inSize, wchar * out )
+{
+  switch( version )
+  {
+#ifdef UTF8_SSE2
+    case Sse2:
+      return decodeSse2( in, inSize, out );
+#endif
+#ifdef UTF8_AVX2
+    case Avx2:
+      return decodeAvx2( in, inSize, out );
+#endif
+    default:
+      return decodeScalar( in, inSize, out );
+  }
+}
+
+size_t encodedSize( wchar const * in, size_t inSize )
+{
+  size_t size = inSize;
+
+  for( wchar const * end = in + inSize; in != end; ++in )
+    if ( !( *in < 0x80 ) )
+      size += 1 + !( *in < 0x800 ) + !( *in < 0x10000 );
+
+  return size;
+}
+
+void encodeAppend( wchar const * in, size_t inSize, string & out )
+{
+  size_t size = out.size();
+
+  out.resize( size + encodedSize( in, inSize ) );
+
+  encode( in, inSize, &out[ size ] );
+}
+
+void decodeAppend( char const * in, size_t inSize, wstring & out ) throw( exCantDecode )
+{
+  size_t size = out.size();
+
+  // Each byte makes a character at most
+  out.resize( size + inSize );
+
+  long result = decode( in, inSize, &out[ size ] );
 
   if ( result < 0 )
-    throw exCantDecode( in );
+  {
+    out.resize( size );
+    throw exCantDecode( string( in, inSize ) );
+  }
+
+  out.resize( size + result );
+}
+
+string encode( wstring const & in ) throw()
+{
+  string result;
+
+  encodeAppend( in.data(), in.size(), result );
+
+  return result;
+}
+
+wstring decode( string const & in ) throw( exCantDecode )
+{
+  wstring result;
+
+  decodeAppend( in.data(), in.size(), result );
 
-  return wstring( &buffer.front(), result );
+  return result;
 }
 
 bool isspace( int c )
@@ -1,6 +1,9 @@
 /* This file is (c) 2008-2012 Konstantin Isakov <ikm@goldendict.org>
  * Part of GoldenDict. Licensed under GPLv3 or later, see the LICENSE file */
 
+#ifndef __UTF8_HH_INCLUDED__
+#define __UTF8_HH_INCLUDED__
+
 #include <cstdio>
 #include <string>
 #include "ex.hh"
@@ -30,6 +33,41 @@ size_t encode( wchar const * in, size_t inSize, char * out );
 /// stored in the 'out' buffer. The result is not 0-terminated.
 long decode( char const * in, size_t inSize, wchar * out );
 
+/// Both of the above pass the runs of ASCII through with SSE2 or AVX2, where
+/// the processor has them, and handle everything else one character at a
+/// time. The results are the same either way.
+
+/// The versions encode() and decode() choose from.
+enum Version
+{
+  Scalar,
+  Sse2,
+  Avx2
+};
+
+/// Returns true if the given version is built in and the processor can run
+/// it. The scalar one always is.
+bool hasVersion( Version );
+
+/// Same as encode() and decode(), but done by the given version, which must
+/// be there. Used to check the versions against each other.
+size_t encodeWith( Version, wchar const * in, size_t inSize, char * out );
+long decodeWith( Version, char const * in, size_t inSize, wchar * out );
+
+/// Returns the number of bytes encode() would store for the given UCS-4.
+size_t encodedSize( wchar const * in, size_t inSize );
+
+/// Appends the UTF-8 of the given UCS-4 to the string, growing it by exactly
+/// the size needed.
+void encodeAppend( wchar const * in, size_t inSize, string & out );
+
+inline void encodeAppend( wstring const & in, string & out )
+{ encodeAppend( in.data(), in.size(), out ); }
+
+/// Appends the decoded UTF-8 to the string. If the UTF-8 is invalid, the
+/// string is left as it was.
+void decodeAppend( char const * in, size_t inSize, wstring & out ) throw( exCantDecode );
+
 /// Versions for non time-critical code.
 string encode( wstring const & ) throw();
 wstring decode( string const & ) throw( exCantDecode );
@@ -40,3 +78,5 @@ wstring decode( string const & ) throw( exCantDecode );
 bool isspace( int c );
 
 }
+
+#endif